@@ -46,6 +46,9 @@ our $EXPERIMENTAL_DIR = "../experimental/";
 our $CUSTOM_DIR = "../custom/";
 
 our $MAX_CONDITIONS_LEN = 1;
+our $MAX_CONDITION_ATTRS = 1;
+our $MAX_ATTRS_MASK_WORDS = 1;
+our $MAX_OBJECT_TYPE_RANK = 0;
 
 our %SAI_ENUMS = ();
 our %SAI_UNIONS = ();
@@ -74,6 +77,11 @@ our %GLOBAL_APIS = ();
 our %OBJECT_TYPE_BULK_MAP = ();
 our %SAI_ENUMS_CUSTOM_RANGES = ();
 our %ATTR_API_VER = ();
+our %CONDITION_ATTRS = ();
+our %ATTR_DESCRIPTORS = ();
+our %CPP_ATTR_TRAITS = ();
+our %INTERNED_STRINGS = ();
+our %OBJECT_TYPE_RANKS = ();
 
 my $FLAGS = "MANDATORY_ON_CREATE|CREATE_ONLY|CREATE_AND_SET|READ_ONLY|KEY";
 my $ENUM_FLAGS_TYPES = "(none|strict|mixed|ranges|free)";
@@ -99,13 +107,14 @@ my %ATTR_TAGS = (
         );
 
 my %options = ();
-getopts("dsASl", \%options);
+getopts("dsASlL", \%options);
 
 our $optionPrintDebug        = 1 if defined $options{d};
 our $optionDisableAspell     = 1 if defined $options{A};
 our $optionUseXmlSimple      = 1 if defined $options{s};
 our $optionDisableStyleCheck = 1 if defined $options{S};
 our $optionShowLogCaller     = 1 if defined $options{l};
+our $optionLean              = 1 if defined $options{L};
 
 # LOGGING FUNCTIONS HELPERS
 
@@ -625,6 +634,8 @@ sub ProcessEnumSection
                 if ($initializer =~ /^= (SAI_\w+)$/)
                 {
                     LogError "initializer $1 not defined in $enumtypename before $enumvaluename" if not grep (/^$1$/, @arr);
+
+                    $SAI_ENUMS{$enumtypename}{ignorevalinit}{$enumvaluename} = $1;
                 }
                 else
                 {
@@ -1181,6 +1192,38 @@ sub ProcessFlagsType
     return "WRONG";
 }
 
+sub InternString
+{
+    my $str = shift;
+
+    return if not defined $optionLean or defined $INTERNED_STRINGS{$str};
+
+    # strings are enum value names, so they are valid identifiers and unique
+
+    WriteSource "static const char sai_metadata_str_${str}[] = \"$str\";";
+
+    $INTERNED_STRINGS{$str} = 1;
+}
+
+sub GetStringLiteral
+{
+    my ($str, $prefix) = @_;
+
+    my $offset = (defined $prefix and $str =~ /^(${prefix})/) ? length($1) : 0;
+
+    return "\"" . substr($str, $offset) . "\"" if not defined $optionLean;
+
+    if (not defined $INTERNED_STRINGS{$str})
+    {
+        LogError "string '$str' was not interned";
+        return "\"$str\"";
+    }
+
+    return "sai_metadata_str_$str" if $offset == 0;
+
+    return "sai_metadata_str_$str + $offset";
+}
+
 sub ProcessSingleEnum
 {
     my ($key, $typedef, $prefix) = @_;
@@ -1210,23 +1253,37 @@ sub ProcessSingleEnum
     WriteSource "-1"; # guard
     WriteSource "};";
 
+    InternString($_) for @values;
+
     WriteSource "const char* const sai_metadata_${typedef}_enum_values_names[] = {";
 
     for my $value (@values)
     {
-        WriteSource "\"$value\",";
+        WriteSource GetStringLiteral($value) . ",";
     }
 
     WriteSource "NULL";
     WriteSource "};";
 
+    # perl string compare without locale has the same order as strcmp
+
+    my @sortedindex = sort { $values[$a] cmp $values[$b] } 0..$#values;
+
+    WriteSource "const int sai_metadata_${typedef}_enum_values_names_sorted_index[] = {";
+
+    for my $index (@sortedindex)
+    {
+        WriteSource "$index,";
+    }
+
+    WriteSource "-1"; # guard
+    WriteSource "};";
+
     WriteSource "const char* const sai_metadata_${typedef}_enum_values_short_names[] = {";
 
     for my $value (@values)
     {
-        $value =~ s/^${prefix}//;
-
-        WriteSource "\"$value\",";
+        WriteSource GetStringLiteral($value, $prefix) . ",";
     }
 
     WriteSource "NULL";
@@ -1246,11 +1303,13 @@ sub ProcessSingleEnum
         WriteSource "-1"; # guard
         WriteSource "};";
 
+        InternString($_) for @ignoreval;
+
         WriteSource "const char* const sai_metadata_${typedef}_enum_ignore_values_names[] = {";
 
         for my $value (@ignoreval)
         {
-            WriteSource "\"$value\",";
+            WriteSource GetStringLiteral($value) . ",";
         }
 
         WriteSource "NULL";
@@ -1285,6 +1344,7 @@ sub ProcessSingleEnum
     #my $ot = ($typedef =~ /^sai_(\w+)_attr_(extensions_)?t/) ? uc("SAI_OBJECT_TYPE_$1") : "SAI_OBJECT_TYPE_NULL";
 
     WriteSource ".objecttype        = (sai_object_type_t)$ot,";
+    WriteSource ".valuesnamessortedindex = sai_metadata_${typedef}_enum_values_names_sorted_index,";
     WriteSource "};";
 
     return $count;
@@ -1550,6 +1610,26 @@ sub ProcessType
     return "";
 }
 
+sub GetAttrValueMember
+{
+    my ($attr, $type) = @_;
+
+    return "aclfield"   if $type =~ /^sai_acl_field_data_t (bool|sai_\w+_t)$/;
+    return "aclmask"    if $type =~ /^sai_acl_field_data_mask_t (bool|sai_\w+_t)$/;
+    return "aclaction"  if $type =~ /^sai_acl_action_data_t (bool|sai_\w+_t)$/;
+    return "s32list"    if $type =~ /^sai_s32_list_t sai_\w+_t$/;
+    return "booldata"   if $type eq "bool";
+    return "chardata"   if $type eq "char";
+    return "ptr"        if $type =~ /^sai_pointer_t sai_\w+_fn$/;
+
+    return $VALUE_TYPES{$type} if defined $VALUE_TYPES{$type};
+
+    return "s32" if $type =~ /^sai_\w+_t$/ and defined $SAI_ENUMS{$type};
+
+    LogError "unable to determine attribute value member for type '$type' on $attr";
+    return "";
+}
+
 sub ProcessFlags
 {
     my ($value,$flags) = @_;
@@ -1630,6 +1710,38 @@ sub ProcessObjects
     return "sai_metadata_${attr}_allowed_objects";
 }
 
+sub GetObjectTypeMaskWords
+{
+    # number of object types (including extensions) is upper bound for
+    # SAI_OBJECT_TYPE_MAX, so mask words will cover all regular object types
+
+    my $count = @{ $SAI_ENUMS{sai_object_type_t}{values} };
+
+    return int(($count + 63) / 64);
+}
+
+sub ProcessObjectsMask
+{
+    my ($attr, $objects) = @_;
+
+    return "NULL" if not defined $objects;
+
+    my $words = GetObjectTypeMaskWords();
+
+    WriteSource "const uint64_t sai_metadata_${attr}_allowed_objects_mask[] = {";
+
+    for my $word (0..($words - 1))
+    {
+        my @bits = map { "SAI_METADATA_OBJECT_TYPE_MASK_BIT($_, $word)" } @{ $objects };
+
+        WriteSource join(" | ", @bits) . ",";
+    }
+
+    WriteSource "};";
+
+    return "sai_metadata_${attr}_allowed_objects_mask";
+}
+
 sub ProcessObjectsLen
 {
     my ($value, $objects) = @_;
@@ -1871,6 +1983,46 @@ sub ProcessConditionType
     return @{$value}[0];
 }
 
+sub GetConditionAttrs
+{
+    #
+    # Returns list of attributes (in enum order) which are referenced by any
+    # condition or valid only condition of given attribute type, position on
+    # that list is attribute index used in generated conditions
+    #
+
+    my $type = shift;
+
+    return @{ $CONDITION_ATTRS{$type} } if defined $CONDITION_ATTRS{$type};
+
+    my %referenced = ();
+
+    for my $attr (keys %{ $METADATA{$type} })
+    {
+        my %meta = %{ $METADATA{$type}{$attr} };
+
+        next if defined $meta{ignore};
+
+        for my $conditions ($meta{condition}, $meta{validonly})
+        {
+            next if not defined $conditions;
+
+            for my $cond (@{ $conditions })
+            {
+                $referenced{$1} = 1 if $cond =~ /^(SAI_\w+) == /;
+            }
+        }
+    }
+
+    my @attrs = grep { defined $referenced{$_} } @{ $SAI_ENUMS{$type}{values} };
+
+    $CONDITION_ATTRS{$type} = \@attrs;
+
+    $MAX_CONDITION_ATTRS = scalar @attrs if $MAX_CONDITION_ATTRS < scalar @attrs;
+
+    return @attrs;
+}
+
 sub ProcessConditionsGeneric
 {
     my ($attr, $conditions, $enumtype, $name) = @_;
@@ -1938,19 +2090,25 @@ sub ProcessConditionsGeneric
             next;
         }
 
+        my @condattrs = GetConditionAttrs($attrType);
+
+        my ($attrindex) = grep { $condattrs[$_] eq $attrid } 0..$#condattrs;
+
         if ($val eq "true" or $val eq "false")
         {
             WriteSource ".attrid = $attrid,";
             WriteSource ".condition = { .booldata = $val },";
             WriteSource ".op = SAI_CONDITION_OPERATOR_EQ,";
-            WriteSource ".type = SAI_ATTR_CONDITION_TYPE_NONE";
+            WriteSource ".type = SAI_ATTR_CONDITION_TYPE_NONE,";
+            WriteSource ".attrindex = $attrindex";
         }
         elsif ($val =~ /^SAI_/)
         {
             WriteSource ".attrid = $attrid,";
             WriteSource ".condition = { .s32 = $val },";
             WriteSource ".op = SAI_CONDITION_OPERATOR_EQ,";
-            WriteSource ".type = SAI_ATTR_CONDITION_TYPE_NONE";
+            WriteSource ".type = SAI_ATTR_CONDITION_TYPE_NONE,";
+            WriteSource ".attrindex = $attrindex";
 
             my $attrType = lc("$1t") if $attrid =~ /^(SAI_\w+_ATTR_)/;
 
@@ -1983,7 +2141,8 @@ sub ProcessConditionsGeneric
             WriteSource ".attrid = $attrid,";
             WriteSource ".condition = { .$item = $val },";
             WriteSource ".op = SAI_CONDITION_OPERATOR_EQ,";
-            WriteSource ".type = SAI_ATTR_CONDITION_TYPE_NONE";
+            WriteSource ".type = SAI_ATTR_CONDITION_TYPE_NONE,";
+            WriteSource ".attrindex = $attrindex";
         }
         else
         {
@@ -2091,7 +2250,9 @@ sub ProcessAttrName
 {
     my ($attr, $type) = @_;
 
-    return "\"$attr\"";
+    InternString($attr);
+
+    return GetStringLiteral($attr);
 }
 
 sub ProcessIsCallback
@@ -2178,6 +2339,8 @@ sub ProcessBrief
         LogWarning "Long brief > 200 on $attr:\n - $brief";
     }
 
+    return "\"\"" if defined $optionLean;
+
     return "\"$brief\"";
 }
 
@@ -2381,6 +2544,7 @@ sub ProcessSingleObjectType
         my $allownull       = ProcessAllowNull($attr, $meta{allownull});
         my $objects         = ProcessObjects($attr, $meta{objects});
         my $objectslen      = ProcessObjectsLen($attr, $meta{objects});
+        my $objectsmask     = ProcessObjectsMask($attr, $meta{objects});
         my $allowrepeat     = ProcessAllowRepeat($attr, $meta{allowrepeat});
         my $allowmixed      = ProcessAllowMixed($attr, $meta{allowmixed});
         my $allowempty      = ProcessAllowEmpty($attr, $meta{allowempty}, $meta{default});
@@ -2477,9 +2641,32 @@ sub ProcessSingleObjectType
         WriteSource ".iscustom                      = ($attr >= 0x10000000) && ($attr < 0x20000000),";
         WriteSource ".apiversion                    = $apiversion,";
         WriteSource ".nextrelease                   = $nextrelease,";
+        WriteSource ".allowedobjecttypesmask        = $objectsmask,";
 
         WriteSource "};";
 
+        my @properties = ();
+
+        push @properties, "SAI_ATTR_DESCRIPTOR_PROPERTY_ENUM"           if $isenum eq "true";
+        push @properties, "SAI_ATTR_DESCRIPTOR_PROPERTY_ENUM_LIST"      if $isenumlist eq "true";
+        push @properties, "SAI_ATTR_DESCRIPTOR_PROPERTY_OID"            if $objectslen > 0;
+        push @properties, "SAI_ATTR_DESCRIPTOR_PROPERTY_CONDITIONAL"    if $conditionslen != 0;
+        push @properties, "SAI_ATTR_DESCRIPTOR_PROPERTY_VALID_ONLY"     if $validonlylen != 0;
+        push @properties, "SAI_ATTR_DESCRIPTOR_PROPERTY_PRIMITIVE"      if $isprimitive eq "true";
+        push @properties, "SAI_ATTR_DESCRIPTOR_PROPERTY_EXTENSION"      if $isextensionattr eq "true";
+        push @properties, "((($attr >= 0x10000000) && ($attr < 0x20000000)) ? SAI_ATTR_DESCRIPTOR_PROPERTY_CUSTOM : 0)";
+
+        my $properties = join("|", @properties);
+
+        push @{ $ATTR_DESCRIPTORS{$typedef} },
+             "{ .attrid = $attr, .attrvaluetype = (uint16_t)$type, .flags = (uint8_t)$flags, .properties = (uint8_t)($properties) },";
+
+        my $member = GetAttrValueMember($attr, $meta{type});
+
+        push @{ $CPP_ATTR_TRAITS{$typedef} },
+             "template <> struct sai_attr<$attr> : sai_attr_traits<$objecttype, $attr, $type, $flags, " .
+             "decltype(sai_attribute_value_t::$member), &sai_attribute_value_t::$member> {};";
+
         # check enum attributes if their names are ending on enum name
 
         CheckEnumNaming($attr, $meta{type}) if $isenum eq "true" or $isenumlist eq "true";
@@ -3002,156 +3189,530 @@ sub ProcessRevGraph
     return "sai_metadata_${objectType}_rev_graph_members";
 }
 
-sub ProcessRevGraphCount
+sub GetObjectTypeSortKey
 {
+    #
+    # Returns key which sorts object types the same way as their numeric
+    # values, custom and extensions object types are defined in their own
+    # ranges after SAI_OBJECT_TYPE_MAX
+    #
+
     my $objectType = shift;
 
-    return 0 if not defined $REVGRAPH{$objectType};
+    my @objects = @{ $SAI_ENUMS{sai_object_type_t}{values} };
 
-    return scalar @{ $REVGRAPH{$objectType} };
+    my ($pos) = grep { $objects[$_] eq $objectType } 0..$#objects;
+    my ($max) = grep { $objects[$_] eq "SAI_OBJECT_TYPE_MAX" } 0..$#objects;
+
+    return 0x20000000 + $pos if defined $CUSTOM_OBJECTS{$objectType};
+
+    return 0x40000000 + $pos if $pos > $max;
+
+    return $pos;
 }
 
-sub CreateStructNonObjectId
+sub ProcessRevGraphIndex
 {
-    my @objects = @{ $SAI_ENUMS{sai_object_type_t}{values} };
+    #
+    # Generates ranges of reverse graph members for each dependency object
+    # type, members are sorted by dependency object type name so each range
+    # is continuous, and ranges are sorted by dependency object type value so
+    # they can be binary searched
+    #
 
-    for my $ot (@objects)
+    my $objectType = shift;
+
+    return "NULL" if not defined $REVGRAPH{$objectType};
+
+    my @dep = sort @{ $REVGRAPH{$objectType} };
+
+    my %ranges = ();
+
+    for (my $idx = 0; $idx < scalar @dep; $idx++)
     {
-        if (not $ot =~ /^SAI_OBJECT_TYPE_(\w+)$/)
-        {
-            LogError "invalid object type '$ot'";
-            next;
-        }
+        my ($depObjectType, $attrId) = split/,/,$dep[$idx];
 
-        next if $1 eq "NULL" or $1 eq "MAX";
+        $ranges{$depObjectType} = [ $idx, 0 ] if not defined $ranges{$depObjectType};
 
-        my $type = "sai_" . lc($1) . "_attr_t";
+        $ranges{$depObjectType}[1]++;
+    }
 
-        my $enum  = "&sai_metadata_enum_${type}";
+    my @depots = sort { GetObjectTypeSortKey($a) <=> GetObjectTypeSortKey($b) } keys %ranges;
 
-        my $struct = $NON_OBJECT_ID_STRUCTS{$ot};
+    WriteSource "const sai_rev_graph_index_t sai_metadata_${objectType}_rev_graph_index[] = {";
 
-        my $structmembers = ProcessStructMembers($struct, $ot ,lc($1));
+    for my $depot (@depots)
+    {
+        my ($index, $count) = @{ $ranges{$depot} };
+
+        WriteSource "{ .depobjecttype = (sai_object_type_t)$depot, .index = $index, .count = $count },";
     }
+
+    WriteSource "};";
+
+    return "sai_metadata_${objectType}_rev_graph_index";
 }
 
-sub ProcessStructMembersName
+sub ProcessRevGraphIndexCount
 {
-    my ($struct, $ot, $rawname) = @_;
+    my $objectType = shift;
 
-    return "NULL" if not defined $struct;
+    return 0 if not defined $REVGRAPH{$objectType};
 
-    return "sai_metadata_struct_members_sai_${rawname}_t";
+    my %depots = map { (split/,/)[0] => 1 } @{ $REVGRAPH{$objectType} };
+
+    return scalar keys %depots;
 }
 
-sub ProcessCreate
+sub GetOidAttrs
 {
-    my $struct = shift;
-    my $ot = shift;
+    my $type = shift;
 
-    my $small = lc($1) if $ot =~ /SAI_OBJECT_TYPE_(\w+)/;
+    my @attrs = grep { not defined $METADATA{$type}{$_}{ignore} } @{ $SAI_ENUMS{$type}{values} };
 
-    my $api = $OBJTOAPIMAP{$ot};
+    return grep { ProcessObjectsLen($_, $METADATA{$type}{$_}{objects}) > 0 } @attrs;
+}
 
-    WriteSource "sai_status_t sai_metadata_generic_create_$ot(";
-    WriteSource "_Inout_ sai_object_meta_key_t *meta_key,";
-    WriteSource "_In_ sai_object_id_t switch_id,";
-    WriteSource "_In_ uint32_t attr_count,";
-    WriteSource "_In_ const sai_attribute_t *attr_list)";
-    WriteSource "{";
+sub ProcessOidAttrs
+{
+    my $type = shift;
 
-    if (IsSpecialObject($ot))
-    {
-        WriteSource "return SAI_STATUS_NOT_IMPLEMENTED;";
-    }
-    elsif (not defined $struct)
-    {
-        if ($small eq "switch")
-        {
-            WriteSource "return sai_metadata_sai_${api}_api->create_$small(&meta_key->objectkey.key.object_id, attr_count, attr_list);";
-        }
-        else
-        {
-            WriteSource "return sai_metadata_sai_${api}_api->create_$small(&meta_key->objectkey.key.object_id, switch_id, attr_count, attr_list);";
-        }
-    }
-    else
+    my @attrs = GetOidAttrs($type);
+
+    return "NULL" if scalar @attrs == 0;
+
+    WriteSource "const sai_attr_metadata_t* const sai_metadata_oid_attrs_${type}\[\] = {";
+
+    for my $attr (@attrs)
     {
-        WriteSource "return sai_metadata_sai_${api}_api->create_$small(&meta_key->objectkey.key.$small, attr_count, attr_list);";
+        WriteSource "&sai_metadata_attr_$attr,";
     }
 
-    WriteSource "}";
+    WriteSource "NULL";
+    WriteSource "};";
 
-    return "sai_metadata_generic_create_$ot";
+    return "sai_metadata_oid_attrs_${type}";
 }
 
-sub ProcessRemove
+sub ProcessOidAttrsCount
 {
-    my $struct = shift;
-    my $ot = shift;
+    my $type = shift;
 
-    my $small = lc($1) if $ot =~ /SAI_OBJECT_TYPE_(\w+)/;
+    my @attrs = GetOidAttrs($type);
 
-    my $api = $OBJTOAPIMAP{$ot};
+    return scalar @attrs;
+}
 
-    WriteSource "sai_status_t sai_metadata_generic_remove_$ot(";
-    WriteSource "_In_ const sai_object_meta_key_t *meta_key)";
-    WriteSource "{";
+sub GetObjectTypeDependencies
+{
+    #
+    # Object type depends on other object type if object id of that type can
+    # be passed on create. Create and set attributes which are not mandatory
+    # (or allow null) can be set after create, so they are soft dependencies
+    # which can be dropped to resolve cycles.
+    #
 
-    if (IsSpecialObject($ot))
-    {
-        WriteSource "return SAI_STATUS_NOT_IMPLEMENTED;";
-    }
-    elsif (not defined $struct)
+    my %hard = ();
+    my %soft = ();
+
+    my @objects = grep { not /^SAI_OBJECT_TYPE_(NULL|MAX)$/ } @{ $SAI_ENUMS{sai_object_type_t}{values} };
+
+    for my $ot (@objects)
     {
-        WriteSource "return sai_metadata_sai_${api}_api->remove_$small(meta_key->objectkey.key.object_id);";
+        $hard{$ot} = {};
+        $soft{$ot} = {};
+
+        # all objects are created on switch
+
+        $hard{$ot}{SAI_OBJECT_TYPE_SWITCH} = 1 if $ot ne "SAI_OBJECT_TYPE_SWITCH";
     }
-    else
+
+    for my $usedot (sort keys %REVGRAPH)
     {
-        WriteSource "return sai_metadata_sai_${api}_api->remove_$small(&meta_key->objectkey.key.$small);";
-    }
+        for my $dep (@{ $REVGRAPH{$usedot} })
+        {
+            my ($ot, $member) = split/,/,$dep;
 
-    WriteSource "}";
+            next if $ot eq $usedot;
 
-    return "sai_metadata_generic_remove_$ot";
+            if (not $member =~ /^SAI_\w+_ATTR_\w+/)
+            {
+                # non object id struct member is always required
+
+                $hard{$ot}{$usedot} = 1;
+                next;
+            }
+
+            my $typedef = "sai_" . lc($1) . "_attr_t" if $ot =~ /^SAI_OBJECT_TYPE_(\w+)$/;
+
+            my $meta = $METADATA{$typedef}{$member};
+
+            next if HasAttrFlag($meta, "READ_ONLY");
+
+            my $allownull = (defined $meta->{allownull} and $meta->{allownull} eq "true");
+
+            if (HasAttrFlag($meta, "CREATE_AND_SET") and (not HasAttrFlag($meta, "MANDATORY_ON_CREATE") or $allownull))
+            {
+                $soft{$ot}{$usedot} = 1;
+            }
+            else
+            {
+                $hard{$ot}{$usedot} = 1;
+            }
+        }
+    }
+
+    return (\%hard, \%soft);
 }
 
-sub ProcessSet
+sub IsObjectTypeDependent
 {
-    my $struct = shift;
-    my $ot = shift;
+    my ($deps, $ot, $dep, $visited) = @_;
 
-    my $small = lc($1) if $ot =~ /SAI_OBJECT_TYPE_(\w+)/;
+    return 1 if $ot eq $dep;
 
-    my $api = $OBJTOAPIMAP{$ot};
+    return 0 if defined $visited->{$ot};
 
-    WriteSource "sai_status_t sai_metadata_generic_set_$ot(";
-    WriteSource "_In_ const sai_object_meta_key_t *meta_key,";
-    WriteSource "_In_ const sai_attribute_t *attr)";
-    WriteSource "{";
+    $visited->{$ot} = 1;
 
-    if (IsSpecialObject($ot))
-    {
-        WriteSource "return SAI_STATUS_NOT_IMPLEMENTED;";
-    }
-    elsif (not defined $struct)
+    for my $next (keys %{ $deps->{$ot} })
     {
-        WriteSource "return sai_metadata_sai_${api}_api->set_${small}_attribute(meta_key->objectkey.key.object_id, attr);";
+        return 1 if IsObjectTypeDependent($deps, $next, $dep, $visited);
     }
-    else
+
+    return 0;
+}
+
+sub GetObjectTypeRank
+{
+    my ($deps, $ot, $ranks) = @_;
+
+    return $ranks->{$ot} if defined $ranks->{$ot};
+
+    my $rank = 0;
+
+    for my $dep (keys %{ $deps->{$ot} })
     {
-        WriteSource "return sai_metadata_sai_${api}_api->set_${small}_attribute(&meta_key->objectkey.key.$small, attr);";
+        my $deprank = GetObjectTypeRank($deps, $dep, $ranks) + 1;
+
+        $rank = $deprank if $rank < $deprank;
     }
 
-    WriteSource "}";
+    $ranks->{$ot} = $rank;
 
-    return "sai_metadata_generic_set_$ot";
+    return $rank;
 }
 
-sub ProcessGet
+sub GetObjectTypeRanks
 {
-    my $struct = shift;
-    my $ot = shift;
+    #
+    # Rank is longest dependency path from switch, objects can be created in
+    # ascending rank order and removed in descending rank order
+    #
+
+    return %OBJECT_TYPE_RANKS if scalar keys %OBJECT_TYPE_RANKS;
+
+    my ($hard, $soft) = GetObjectTypeDependencies();
+
+    my %deps = map { $_ => { %{ $hard->{$_} } } } keys %$hard;
+
+    for my $ot (sort keys %deps)
+    {
+        for my $dep (sort keys %{ $hard->{$ot} })
+        {
+            next if not IsObjectTypeDependent(\%deps, $dep, $ot, {});
+
+            LogError "$ot and $dep depend on each other on create, can't resolve cycle";
+
+            delete $deps{$ot}{$dep};
+        }
+    }
+
+    for my $ot (sort keys %deps)
+    {
+        for my $dep (sort keys %{ $soft->{$ot} })
+        {
+            # skip dependency which would introduce cycle
+
+            next if IsObjectTypeDependent(\%deps, $dep, $ot, {});
+
+            $deps{$ot}{$dep} = 1;
+        }
+    }
+
+    my %ranks = ();
+
+    for my $ot (sort keys %deps)
+    {
+        my $rank = GetObjectTypeRank(\%deps, $ot, \%ranks);
+
+        $MAX_OBJECT_TYPE_RANK = $rank if $MAX_OBJECT_TYPE_RANK < $rank;
+    }
+
+    %OBJECT_TYPE_RANKS = %ranks;
+
+    return %OBJECT_TYPE_RANKS;
+}
+
+sub ProcessObjectTypeRank
+{
+    my $ot = shift;
+
+    my %ranks = GetObjectTypeRanks();
+
+    return $ranks{$ot};
+}
+
+sub ProcessConditionAttrs
+{
+    my $type = shift;
+
+    my @attrs = GetConditionAttrs($type);
+
+    return "NULL" if scalar @attrs == 0;
+
+    WriteSource "const sai_attr_metadata_t* const sai_metadata_condition_attrs_${type}\[\] = {";
+
+    for my $attr (@attrs)
+    {
+        WriteSource "&sai_metadata_attr_$attr,";
+    }
+
+    WriteSource "NULL";
+    WriteSource "};";
+
+    return "sai_metadata_condition_attrs_${type}";
+}
+
+sub ProcessAttrDescriptors
+{
+    my $type = shift;
+
+    return "NULL" if not defined $ATTR_DESCRIPTORS{$type};
+
+    WriteSource "const sai_attr_descriptor_t sai_metadata_attr_descriptors_${type}\[\] = {";
+
+    for my $descriptor (@{ $ATTR_DESCRIPTORS{$type} })
+    {
+        WriteSource $descriptor;
+    }
+
+    WriteSource "};";
+
+    return "sai_metadata_attr_descriptors_${type}";
+}
+
+sub ProcessConditionAttrsCount
+{
+    my $type = shift;
+
+    my @attrs = GetConditionAttrs($type);
+
+    return scalar @attrs;
+}
+
+sub GetAttrsMaskWords
+{
+    my $type = shift;
+
+    my @attrs = grep { not defined $METADATA{$type}{$_}{ignore} } @{ $SAI_ENUMS{$type}{values} };
+
+    my $words = int((scalar @attrs + 63) / 64);
+
+    return ($words > 0) ? $words : 1;
+}
+
+sub ProcessAttrsMask
+{
+    #
+    # Generates bit mask of attributes matching predicate, bit position is
+    # attribute index in object type info attribute metadata array
+    #
+
+    my ($type, $name, $predicate) = @_;
+
+    my @attrs = grep { not defined $METADATA{$type}{$_}{ignore} } @{ $SAI_ENUMS{$type}{values} };
+
+    my @words = (0) x GetAttrsMaskWords($type);
+
+    for (my $idx = 0; $idx < scalar @attrs; $idx++)
+    {
+        my %meta = %{ $METADATA{$type}{$attrs[$idx]} };
+
+        $words[int($idx / 64)] |= (1 << ($idx % 64)) if $predicate->(\%meta);
+    }
+
+    WriteSource "const uint64_t sai_metadata_${name}_attrs_mask_${type}\[\] = {";
+
+    for my $word (@words)
+    {
+        WriteSource sprintf("UINT64_C(0x%016x),", $word);
+    }
+
+    WriteSource "};";
+
+    return "sai_metadata_${name}_attrs_mask_${type}";
+}
+
+sub HasAttrFlag
+{
+    my ($meta, $flag) = @_;
+
+    return 0 if not defined $meta->{flags};
+
+    return scalar grep { $_ eq $flag } @{ $meta->{flags} };
+}
+
+sub ProcessRevGraphCount
+{
+    my $objectType = shift;
+
+    return 0 if not defined $REVGRAPH{$objectType};
+
+    return scalar @{ $REVGRAPH{$objectType} };
+}
+
+sub CreateStructNonObjectId
+{
+    my @objects = @{ $SAI_ENUMS{sai_object_type_t}{values} };
+
+    for my $ot (@objects)
+    {
+        if (not $ot =~ /^SAI_OBJECT_TYPE_(\w+)$/)
+        {
+            LogError "invalid object type '$ot'";
+            next;
+        }
+
+        next if $1 eq "NULL" or $1 eq "MAX";
+
+        my $type = "sai_" . lc($1) . "_attr_t";
+
+        my $enum  = "&sai_metadata_enum_${type}";
+
+        my $struct = $NON_OBJECT_ID_STRUCTS{$ot};
+
+        my $structmembers = ProcessStructMembers($struct, $ot ,lc($1));
+    }
+}
+
+sub ProcessStructMembersName
+{
+    my ($struct, $ot, $rawname) = @_;
+
+    return "NULL" if not defined $struct;
+
+    return "sai_metadata_struct_members_sai_${rawname}_t";
+}
+
+sub ProcessCreate
+{
+    my $struct = shift;
+    my $ot = shift;
+
+    my $small = lc($1) if $ot =~ /SAI_OBJECT_TYPE_(\w+)/;
+
+    my $api = $OBJTOAPIMAP{$ot};
+
+    WriteSource "sai_status_t sai_metadata_generic_create_$ot(";
+    WriteSource "_Inout_ sai_object_meta_key_t *meta_key,";
+    WriteSource "_In_ sai_object_id_t switch_id,";
+    WriteSource "_In_ uint32_t attr_count,";
+    WriteSource "_In_ const sai_attribute_t *attr_list)";
+    WriteSource "{";
+
+    if (IsSpecialObject($ot))
+    {
+        WriteSource "return SAI_STATUS_NOT_IMPLEMENTED;";
+    }
+    elsif (not defined $struct)
+    {
+        if ($small eq "switch")
+        {
+            WriteSource "return sai_metadata_sai_${api}_api->create_$small(&meta_key->objectkey.key.object_id, attr_count, attr_list);";
+        }
+        else
+        {
+            WriteSource "return sai_metadata_sai_${api}_api->create_$small(&meta_key->objectkey.key.object_id, switch_id, attr_count, attr_list);";
+        }
+    }
+    else
+    {
+        WriteSource "return sai_metadata_sai_${api}_api->create_$small(&meta_key->objectkey.key.$small, attr_count, attr_list);";
+    }
+
+    WriteSource "}";
+
+    return "sai_metadata_generic_create_$ot";
+}
+
+sub ProcessRemove
+{
+    my $struct = shift;
+    my $ot = shift;
+
+    my $small = lc($1) if $ot =~ /SAI_OBJECT_TYPE_(\w+)/;
+
+    my $api = $OBJTOAPIMAP{$ot};
+
+    WriteSource "sai_status_t sai_metadata_generic_remove_$ot(";
+    WriteSource "_In_ const sai_object_meta_key_t *meta_key)";
+    WriteSource "{";
+
+    if (IsSpecialObject($ot))
+    {
+        WriteSource "return SAI_STATUS_NOT_IMPLEMENTED;";
+    }
+    elsif (not defined $struct)
+    {
+        WriteSource "return sai_metadata_sai_${api}_api->remove_$small(meta_key->objectkey.key.object_id);";
+    }
+    else
+    {
+        WriteSource "return sai_metadata_sai_${api}_api->remove_$small(&meta_key->objectkey.key.$small);";
+    }
+
+    WriteSource "}";
+
+    return "sai_metadata_generic_remove_$ot";
+}
+
+sub ProcessSet
+{
+    my $struct = shift;
+    my $ot = shift;
+
+    my $small = lc($1) if $ot =~ /SAI_OBJECT_TYPE_(\w+)/;
+
+    my $api = $OBJTOAPIMAP{$ot};
+
+    WriteSource "sai_status_t sai_metadata_generic_set_$ot(";
+    WriteSource "_In_ const sai_object_meta_key_t *meta_key,";
+    WriteSource "_In_ const sai_attribute_t *attr)";
+    WriteSource "{";
+
+    if (IsSpecialObject($ot))
+    {
+        WriteSource "return SAI_STATUS_NOT_IMPLEMENTED;";
+    }
+    elsif (not defined $struct)
+    {
+        WriteSource "return sai_metadata_sai_${api}_api->set_${small}_attribute(meta_key->objectkey.key.object_id, attr);";
+    }
+    else
+    {
+        WriteSource "return sai_metadata_sai_${api}_api->set_${small}_attribute(&meta_key->objectkey.key.$small, attr);";
+    }
+
+    WriteSource "}";
+
+    return "sai_metadata_generic_set_$ot";
+}
+
+sub ProcessGet
+{
+    my $struct = shift;
+    my $ot = shift;
 
     my $small = lc($1) if $ot =~ /SAI_OBJECT_TYPE_(\w+)/;
 
@@ -3869,6 +4430,45 @@ sub CreateGenericQuadBulkApi
     WriteSource "}";
 }
 
+sub CreateMixedBulkApi
+{
+    # implementation is in saimetadatautils.c, declared here since it
+    # requires sai_apis_t
+
+    WriteHeader "\n/* Mixed Bulk API */\n";
+
+    WriteHeader "/* objects are executed in object type rank order, grouped by object type */";
+    WriteHeader "";
+
+    WriteHeader "sai_status_t sai_metadata_mixed_bulk_create(";
+    WriteHeader "    _In_ const sai_apis_t* apis,";
+    WriteHeader "    _In_ sai_object_id_t switch_id,";
+    WriteHeader "    _In_ uint32_t object_count,";
+    WriteHeader "    _Inout_ sai_object_meta_key_t *meta_key,";
+    WriteHeader "    _In_ const uint32_t *attr_count,";
+    WriteHeader "    _In_ const sai_attribute_t **attr_list,";
+    WriteHeader "    _In_ sai_bulk_op_error_mode_t mode,";
+    WriteHeader "    _Out_ sai_status_t *object_statuses);";
+    WriteHeader "";
+
+    WriteHeader "sai_status_t sai_metadata_mixed_bulk_remove(";
+    WriteHeader "    _In_ const sai_apis_t* apis,";
+    WriteHeader "    _In_ uint32_t object_count,";
+    WriteHeader "    _In_ const sai_object_meta_key_t *meta_key,";
+    WriteHeader "    _In_ sai_bulk_op_error_mode_t mode,";
+    WriteHeader "    _Out_ sai_status_t *object_statuses);";
+    WriteHeader "";
+
+    WriteHeader "sai_status_t sai_metadata_mixed_bulk_set(";
+    WriteHeader "    _In_ const sai_apis_t* apis,";
+    WriteHeader "    _In_ uint32_t object_count,";
+    WriteHeader "    _In_ const sai_object_meta_key_t *meta_key,";
+    WriteHeader "    _In_ const sai_attribute_t *attr_list,";
+    WriteHeader "    _In_ sai_bulk_op_error_mode_t mode,";
+    WriteHeader "    _Out_ sai_status_t *object_statuses);";
+    WriteHeader "";
+}
+
 sub CreateApisQuery
 {
     WriteSectionComment "SAI API query";
@@ -4045,10 +4645,25 @@ sub CreateObjectInfo
         my $structmemberscount  = ProcessStructMembersCount($struct, $ot);
         my $revgraph            = ProcessRevGraph($ot);
         my $revgraphcount       = ProcessRevGraphCount($ot);
+        my $revgraphindex       = ProcessRevGraphIndex($ot);
+        my $revgraphindexcount  = ProcessRevGraphIndexCount($ot);
         my $isexperimental      = ProcessIsExperimental($ot);
         my $statenum            = ProcessStatEnum($shortot);
         my $iscustom            = ProcessIsCustom($ot);
         my $attrmetalength      = @{ $SAI_ENUMS{$type}{values} };
+        my $condattrs           = ProcessConditionAttrs($type);
+        my $condattrscount      = ProcessConditionAttrsCount($type);
+        my $attrsmaskwords      = GetAttrsMaskWords($type);
+        my $mandatorymask       = ProcessAttrsMask($type, "mandatory", sub { HasAttrFlag($_[0], "MANDATORY_ON_CREATE") });
+        my $createonlymask      = ProcessAttrsMask($type, "createonly", sub { HasAttrFlag($_[0], "CREATE_ONLY") });
+        my $readonlymask        = ProcessAttrsMask($type, "readonly", sub { HasAttrFlag($_[0], "READ_ONLY") });
+        my $conditionalmask     = ProcessAttrsMask($type, "conditional", sub { defined $_[0]->{condition} });
+        my $attrdescriptors     = ProcessAttrDescriptors($type);
+        my $oidattrs            = ProcessOidAttrs($type);
+        my $oidattrscount       = ProcessOidAttrsCount($type);
+        my $rank                = ProcessObjectTypeRank($ot);
+
+        $MAX_ATTRS_MASK_WORDS = $attrsmaskwords if $MAX_ATTRS_MASK_WORDS < $attrsmaskwords;
 
         my $create      = ProcessCreate($struct, $ot);
         my $remove      = ProcessRemove($struct, $ot);
@@ -4064,7 +4679,7 @@ sub CreateObjectInfo
         WriteSource "const sai_object_type_info_t sai_metadata_object_type_info_$ot = {";
 
         WriteSource ".objecttype           = (sai_object_type_t)$ot,";
-        WriteSource ".objecttypename       = \"$ot\",";
+        WriteSource ".objecttypename       = " . GetStringLiteral($ot) . ",";
         WriteSource ".attridstart          = $start,";
         WriteSource ".attridend            = $end,";
         WriteSource ".enummetadata         = $enum,";
@@ -4086,6 +4701,19 @@ sub CreateObjectInfo
         WriteSource ".isexperimental       = $isexperimental,";
         WriteSource ".statenum             = $statenum,";
         WriteSource ".iscustom             = $iscustom,";
+        WriteSource ".conditionattrs       = $condattrs,";
+        WriteSource ".conditionattrscount  = $condattrscount,";
+        WriteSource ".attrsmaskwords       = $attrsmaskwords,";
+        WriteSource ".mandatoryattrsmask   = $mandatorymask,";
+        WriteSource ".createonlyattrsmask  = $createonlymask,";
+        WriteSource ".readonlyattrsmask    = $readonlymask,";
+        WriteSource ".conditionalattrsmask = $conditionalmask,";
+        WriteSource ".attrdescriptors      = $attrdescriptors,";
+        WriteSource ".revgraphindex        = $revgraphindex,";
+        WriteSource ".revgraphindexcount   = $revgraphindexcount,";
+        WriteSource ".oidattrs             = $oidattrs,";
+        WriteSource ".oidattrscount        = $oidattrscount,";
+        WriteSource ".rank                 = $rank,";
 
         WriteSource "};";
     }
@@ -4209,73 +4837,280 @@ sub GetHashOfAllAttributes
     # list will be used to find attribute metadata
     # based on attribute string name
 
-    my %ATTRIBUTES = ();
+    my %ATTRIBUTES = ();
+
+    for my $key (sort keys %SAI_ENUMS)
+    {
+        next if not $key =~ /^(sai_(\w+)_attr_t)$/;
+
+        my $typedef = $1;
+
+        my $enum = $SAI_ENUMS{$typedef};
+
+        my @values = @{ $enum->{values} };
+
+        for my $attr (@values)
+        {
+            if (not defined $METADATA{$typedef} or not defined $METADATA{$typedef}{$attr})
+            {
+                LogError "metadata is missing for $attr";
+                next;
+            }
+
+            next if defined $METADATA{$typedef}{$attr}{ignore};
+
+            $ATTRIBUTES{$attr} = 1;
+        }
+    }
+
+    return %ATTRIBUTES;
+}
+
+sub CheckCapabilities
+{
+    my %ATTRIBUTES = GetHashOfAllAttributes();
+
+    for my $attr (keys %CAPABILITIES)
+    {
+        next if defined $ATTRIBUTES{$attr};
+
+        LogError "capability attribute $attr not found on all attributes list";
+    }
+}
+
+sub CreateListOfAllAttributes
+{
+    # list will be used to find attribute metadata
+    # based on attribute string name
+
+    WriteSectionComment "List of all attributes";
+
+    my %ATTRIBUTES = GetHashOfAllAttributes();
+
+    WriteHeader "extern const sai_attr_metadata_t* const sai_metadata_attr_sorted_by_id_name[];";
+    WriteSource "const sai_attr_metadata_t* const sai_metadata_attr_sorted_by_id_name[] = {";
+
+    my @keys = sort keys %ATTRIBUTES;
+
+    for my $attr (@keys)
+    {
+        WriteSource "&sai_metadata_attr_$attr,";
+    }
+
+    my $count = @keys;
+
+    WriteSource "NULL";
+    WriteSource "};";
+
+    WriteSource "const size_t sai_metadata_attr_sorted_by_id_name_count = $count;";
+    WriteHeader "extern const size_t sai_metadata_attr_sorted_by_id_name_count;";
+
+    CreateAttrIdNameHash(@keys);
+
+    CreateListOfIgnoredAttributes();
+}
+
+sub CreateListOfIgnoredAttributes
+{
+    # list will be used to find replacement attribute metadata
+    # based on ignored attribute string name
+
+    WriteSectionComment "List of ignored attributes";
+
+    my %IGNORED = ();
+
+    for my $ot (@{ $SAI_ENUMS{sai_object_type_t}{values} })
+    {
+        next if not $ot =~ /^SAI_OBJECT_TYPE_(\w+)$/;
+
+        my $type = "sai_" . lc($1) . "_attr_t";
+
+        next if not defined $SAI_ENUMS{$type}{ignoreval};
+
+        for my $ignored (@{ $SAI_ENUMS{$type}{ignoreval} })
+        {
+            my $replacement = $SAI_ENUMS{$type}{ignorevalinit}{$ignored};
+
+            # ignored value can be initialized by other ignored value
+
+            $replacement = $SAI_ENUMS{$type}{ignorevalinit}{$replacement}
+                while defined $replacement and defined $SAI_ENUMS{$type}{ignorevalinit}{$replacement};
+
+            if (not defined $replacement)
+            {
+                LogError "ignored attribute $ignored has no replacement attribute";
+                next;
+            }
+
+            $IGNORED{$ignored} = $replacement;
+        }
+    }
+
+    my @keys = sort keys %IGNORED;
+
+    WriteHeader "extern const char* const sai_metadata_ignored_attr_sorted_by_id_name[];";
+    WriteSource "const char* const sai_metadata_ignored_attr_sorted_by_id_name[] = {";
+
+    for my $attr (@keys)
+    {
+        WriteSource "\"$attr\",";
+    }
+
+    WriteSource "NULL";
+    WriteSource "};";
+
+    WriteHeader "extern const sai_attr_metadata_t* const sai_metadata_ignored_attr_replacement[];";
+    WriteSource "const sai_attr_metadata_t* const sai_metadata_ignored_attr_replacement[] = {";
+
+    for my $attr (@keys)
+    {
+        WriteSource "&sai_metadata_attr_$IGNORED{$attr},";
+    }
+
+    WriteSource "NULL";
+    WriteSource "};";
+
+    my $count = @keys;
+
+    WriteSource "const size_t sai_metadata_ignored_attr_sorted_by_id_name_count = $count;";
+    WriteHeader "extern const size_t sai_metadata_ignored_attr_sorted_by_id_name_count;";
+}
+
+sub GetAttrIdNameHash
+{
+    #
+    # FNV-1a 32 bit hash, must be the same as hash computed in
+    # sai_metadata_attr_id_name_hash_lookup in saimetadatautils.c
+    #
+
+    my $name = shift;
+
+    my $hash = 0x811c9dc5;
+
+    for my $c (unpack("C*", $name))
+    {
+        $hash ^= $c;
+        $hash = ($hash * 0x01000193) & 0xffffffff;
+    }
+
+    return $hash;
+}
+
+sub CreateAttrIdNameHash
+{
+    #
+    # Generate perfect hash (hash and displace) over attribute id names
+    # sorted array. Hash selects bucket, and displacement of that bucket is
+    # xored with slot computed from multiplied hash, multiplier (seed) and
+    # displacements are searched here, so that each name has unique slot.
+    # Slot contains index to sai_metadata_attr_sorted_by_id_name, empty slots
+    # point to NULL guard at the end of that array.
+    #
+
+    my @keys = @_;
+
+    my $count = @keys;
+
+    my $size = 1;
+
+    $size <<= 1 while $size < 2 * $count;
+
+    my $bucketscount = 1;
+
+    $bucketscount <<= 1 while 4 * $bucketscount < $count;
+
+    LogError "too many attributes for attr id name hash: $count" if $bucketscount > 0x10000;
+
+    my @hashes = map { GetAttrIdNameHash($_) } @keys;
+
+    my $seed = 0x5bd1e995;
+
+    my @displacement = ();
+    my @index = ();
+
+    SEED: for my $try (1..1000)
+    {
+        my @buckets = map { [] } 1..$bucketscount;
+
+        for my $idx (0..$#keys)
+        {
+            my $hash = $hashes[$idx];
+
+            my $slot = ((($hash * $seed) & 0xffffffff) >> 16) & ($size - 1);
 
-    for my $key (sort keys %SAI_ENUMS)
-    {
-        next if not $key =~ /^(sai_(\w+)_attr_t)$/;
+            push @{ $buckets[($hash >> 16) & ($bucketscount - 1)] }, [ $idx, $slot ];
+        }
 
-        my $typedef = $1;
+        @displacement = (0) x $bucketscount;
+        @index = ($count) x $size;
 
-        my $enum = $SAI_ENUMS{$typedef};
+        # place largest buckets first, while table is still empty
 
-        my @values = @{ $enum->{values} };
+        my @order = sort { scalar(@{ $buckets[$b] }) <=> scalar(@{ $buckets[$a] }) or $a <=> $b } 0..($bucketscount - 1);
 
-        for my $attr (@values)
+        for my $bucket (@order)
         {
-            if (not defined $METADATA{$typedef} or not defined $METADATA{$typedef}{$attr})
+            my @items = @{ $buckets[$bucket] };
+
+            next if scalar(@items) == 0;
+
+            my $placed = 0;
+
+            DISPLACEMENT: for my $d (0..($size - 1))
             {
-                LogError "metadata is missing for $attr";
-                next;
-            }
+                my %slots = ();
 
-            next if defined $METADATA{$typedef}{$attr}{ignore};
+                for my $item (@items)
+                {
+                    my $slot = $item->[1] ^ $d;
 
-            $ATTRIBUTES{$attr} = 1;
-        }
-    }
+                    next DISPLACEMENT if $index[$slot] != $count or defined $slots{$slot};
 
-    return %ATTRIBUTES;
-}
+                    $slots{$slot} = 1;
+                }
 
-sub CheckCapabilities
-{
-    my %ATTRIBUTES = GetHashOfAllAttributes();
+                $index[$_->[1] ^ $d] = $_->[0] for @items;
 
-    for my $attr (keys %CAPABILITIES)
-    {
-        next if defined $ATTRIBUTES{$attr};
+                $displacement[$bucket] = $d;
 
-        LogError "capability attribute $attr not found on all attributes list";
-    }
-}
+                $placed = 1;
 
-sub CreateListOfAllAttributes
-{
-    # list will be used to find attribute metadata
-    # based on attribute string name
+                last;
+            }
 
-    WriteSectionComment "List of all attributes";
+            if (not $placed)
+            {
+                $seed = ($seed + 0x1e3779b8) & 0x7fffffff;
 
-    my %ATTRIBUTES = GetHashOfAllAttributes();
+                next SEED;
+            }
+        }
 
-    WriteHeader "extern const sai_attr_metadata_t* const sai_metadata_attr_sorted_by_id_name[];";
-    WriteSource "const sai_attr_metadata_t* const sai_metadata_attr_sorted_by_id_name[] = {";
+        LogInfo "attr id name hash: $count names, $size slots, $bucketscount buckets, $try tries";
 
-    my @keys = sort keys %ATTRIBUTES;
+        WriteSource "const uint32_t sai_metadata_attr_id_name_hash_seed = $seed;";
+        WriteHeader "extern const uint32_t sai_metadata_attr_id_name_hash_seed;";
 
-    for my $attr (@keys)
-    {
-        WriteSource "&sai_metadata_attr_$attr,";
-    }
+        WriteHeader "extern const uint32_t sai_metadata_attr_id_name_hash_displacement[];";
+        WriteSource "const uint32_t sai_metadata_attr_id_name_hash_displacement[] = {";
+        WriteSource "$_," for @displacement;
+        WriteSource "};";
 
-    my $count = @keys;
+        WriteSource "const size_t sai_metadata_attr_id_name_hash_displacement_count = $bucketscount;";
+        WriteHeader "extern const size_t sai_metadata_attr_id_name_hash_displacement_count;";
 
-    WriteSource "NULL";
-    WriteSource "};";
+        WriteHeader "extern const uint32_t sai_metadata_attr_id_name_hash_index[];";
+        WriteSource "const uint32_t sai_metadata_attr_id_name_hash_index[] = {";
+        WriteSource "$_," for @index;
+        WriteSource "};";
 
-    WriteSource "const size_t sai_metadata_attr_sorted_by_id_name_count = $count;";
-    WriteHeader "extern const size_t sai_metadata_attr_sorted_by_id_name_count;";
+        WriteSource "const size_t sai_metadata_attr_id_name_hash_index_count = $size;";
+        WriteHeader "extern const size_t sai_metadata_attr_id_name_hash_index_count;";
+
+        return;
+    }
+
+    LogError "failed to generate attr id name perfect hash for $count attributes";
 }
 
 sub CheckApiStructNames
@@ -5264,6 +6099,114 @@ sub CreateSwitchPointersAttributesList
     WriteHeader "#define SAI_METADATA_SWITCH_POINTERS_ATTR_COUNT $count";
 }
 
+sub CreateCppHeader
+{
+    WriteCppHeader "/* AUTOGENERATED FILE! DO NOT EDIT */";
+    WriteCppHeader "";
+    WriteCppHeader "#ifndef __SAI_METADATA_HPP__";
+    WriteCppHeader "#define __SAI_METADATA_HPP__";
+    WriteCppHeader "";
+    WriteCppHeader "#if __cplusplus < 201703L";
+    WriteCppHeader "#error \"saimetadata.hpp requires C++17\"";
+    WriteCppHeader "#endif";
+    WriteCppHeader "";
+    WriteCppHeader "#include <cstring>";
+    WriteCppHeader "#include <type_traits>";
+    WriteCppHeader "";
+    WriteCppHeader "extern \"C\" {";
+    WriteCppHeader "#include \"saimetadata.h\"";
+    WriteCppHeader "}";
+    WriteCppHeader "";
+    WriteCppHeader "/**";
+    WriteCppHeader " * \@brief Compile time attribute traits.";
+    WriteCppHeader " *";
+    WriteCppHeader " * Carries the same information as sai_attr_metadata_t for object type,";
+    WriteCppHeader " * attribute id, value type and flags, but as constant expressions, and";
+    WriteCppHeader " * binds the attribute to its sai_attribute_value_t union member, so";
+    WriteCppHeader " * values can be accessed with the proper C type without a switch on";
+    WriteCppHeader " * attribute value type.";
+    WriteCppHeader " */";
+    WriteCppHeader "template <sai_object_type_t OT, sai_attr_id_t ID, sai_attr_value_type_t VT, sai_attr_flags_t FLAGS,";
+    WriteCppHeader "         typename T, T sai_attribute_value_t::*MEMBER>";
+    WriteCppHeader "struct sai_attr_traits";
+    WriteCppHeader "{";
+    WriteCppHeader "typedef T type;";
+    WriteCppHeader "";
+    WriteCppHeader "static constexpr sai_object_type_t objecttype = OT;";
+    WriteCppHeader "static constexpr sai_attr_id_t attrid = ID;";
+    WriteCppHeader "static constexpr sai_attr_value_type_t attrvaluetype = VT;";
+    WriteCppHeader "static constexpr sai_attr_flags_t flags = FLAGS;";
+    WriteCppHeader "static constexpr T sai_attribute_value_t::*member = MEMBER;";
+    WriteCppHeader "";
+    WriteCppHeader "static constexpr bool has_flag(_In_ sai_attr_flags_t flag)";
+    WriteCppHeader "{";
+    WriteCppHeader "return (FLAGS & flag) == flag;";
+    WriteCppHeader "}";
+    WriteCppHeader "";
+    WriteCppHeader "static constexpr T& get(_In_ sai_attribute_t& attr)";
+    WriteCppHeader "{";
+    WriteCppHeader "return attr.value.*MEMBER;";
+    WriteCppHeader "}";
+    WriteCppHeader "";
+    WriteCppHeader "static constexpr const T& get(_In_ const sai_attribute_t& attr)";
+    WriteCppHeader "{";
+    WriteCppHeader "return attr.value.*MEMBER;";
+    WriteCppHeader "}";
+    WriteCppHeader "";
+    WriteCppHeader "static constexpr void set(_Inout_ sai_attribute_t& attr, _In_ const T& value)";
+    WriteCppHeader "{";
+    WriteCppHeader "attr.id = ID;";
+    WriteCppHeader "";
+    WriteCppHeader "/* arrays like chardata or mac can't be assigned */";
+    WriteCppHeader "";
+    WriteCppHeader "if constexpr (std::is_array_v<T>)";
+    WriteCppHeader "{";
+    WriteCppHeader "std::memcpy(attr.value.*MEMBER, value, sizeof(T));";
+    WriteCppHeader "}";
+    WriteCppHeader "else";
+    WriteCppHeader "{";
+    WriteCppHeader "attr.value.*MEMBER = value;";
+    WriteCppHeader "}";
+    WriteCppHeader "}";
+    WriteCppHeader "";
+    WriteCppHeader "static const sai_attr_metadata_t* metadata()";
+    WriteCppHeader "{";
+    WriteCppHeader "return sai_metadata_get_attr_metadata(OT, ID);";
+    WriteCppHeader "}";
+    WriteCppHeader "};";
+    WriteCppHeader "";
+    WriteCppHeader "/**";
+    WriteCppHeader " * \@brief Attribute traits keyed by attribute enum value.";
+    WriteCppHeader " *";
+    WriteCppHeader " * Since each object type has its own attribute enum type, attributes of";
+    WriteCppHeader " * different object types sharing the same numeric value are distinct keys.";
+    WriteCppHeader " *";
+    WriteCppHeader " * Example: sai_attr<SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID>::get(attr)";
+    WriteCppHeader " */";
+    WriteCppHeader "template <auto A>";
+    WriteCppHeader "struct sai_attr;";
+
+    my @objects = @{ $SAI_ENUMS{sai_object_type_t}{values} };
+
+    for my $ot (@objects)
+    {
+        next if not $ot =~ /^SAI_OBJECT_TYPE_(\w+)$/;
+
+        my $typedef = "sai_" . lc($1) . "_attr_t";
+
+        next if not defined $CPP_ATTR_TRAITS{$typedef};
+
+        WriteCppHeader "";
+        WriteCppHeader "/* $typedef */";
+        WriteCppHeader "";
+
+        WriteCppHeader $_ for @{ $CPP_ATTR_TRAITS{$typedef} };
+    }
+
+    WriteCppHeader "";
+    WriteCppHeader "#endif /* __SAI_METADATA_HPP__ */";
+}
+
 sub WriteHeaderHeader
 {
     WriteSectionComment "AUTOGENERATED FILE! DO NOT EDIT";
@@ -5658,6 +6601,10 @@ sub CreateSaiSwigApiStructs
     my @exheaders = GetExperimentalHeaderFiles();
     my @cuheaders = GetCustomHeaderFiles();
 
+    # trace library is not part of metadata library
+
+    @metaheaders = grep { not /^saitrace/ } @metaheaders;
+
     push(@metaheaders, "saimetadata.h");
 
     my @merged = (@headers, @metaheaders, @exheaders, @cuheaders);
@@ -5674,6 +6621,304 @@ sub CreateSaiSwigApiStructs
     }
 }
 
+sub GetTraceArgNames
+{
+    my $params = shift;
+
+    $params =~ s/^\s*\(\s*|\s*\)\s*$//g;
+
+    return () if $params eq "void";
+
+    my @names = ();
+
+    for my $param (split/,/,$params)
+    {
+        if (not $param =~ /(\w+)\s*(\[\w*\])?\s*$/)
+        {
+            LogError "failed to extract argument name from '$param'";
+            next;
+        }
+
+        push @names, $1;
+    }
+
+    return @names;
+}
+
+sub GetTraceObjectTypeAndOp
+{
+    my ($api, $name, $type) = @_;
+
+    #
+    # object type and operation are derived from member name, like
+    # create_route_entry, create_route_entries or get_port_stats_ext, longest
+    # object type is matched first, so next_hop_group is not taken as next_hop
+    #
+
+    my @objects = sort { length($b) <=> length($a) or $a cmp $b } @{ $APITOOBJMAP{$api} // [] };
+
+    for my $ot (@objects)
+    {
+        next if not $ot =~ /^SAI_OBJECT_TYPE_(\w+)$/;
+
+        my $short = lc($1);
+
+        my $plural = $short;
+
+        $plural =~ s/y$/ie/;
+
+        next if not $name =~ /^([a-z]+)_(?:$short|${short}s|${short}es|${plural}s)(?:_(\w+))?$/;
+
+        my $op = $1;
+
+        $op .= "_$2" if defined $2 and $2 ne "attribute";
+
+        $op = "bulk_$op" if $type =~ /^sai_bulk_/;
+
+        return ($ot, $op);
+    }
+
+    return (undef, $name);
+}
+
+sub CreateTraceSource
+{
+    #
+    # trace library exports all global functions and forwards them to vendor
+    # library, api method tables returned by sai_api_query are replaced with
+    # tables of wrappers, which record latency of each call
+    #
+
+    my @fns = ();
+    my @apis = ();
+
+    for my $name (sort keys %GLOBAL_APIS)
+    {
+        my $short = $1 if $name =~ /^sai_(\w+)/;
+
+        push @fns, { id => "SAI_TRACE_FN_GLOBAL_" . uc($short), api => "global", name => $name, op => $short };
+    }
+
+    for my $Api (@{ $SAI_ENUMS{sai_api_t}{values} })
+    {
+        $Api =~ /^SAI_API_(\w+)/;
+
+        my $api = lc($1);
+
+        next if $api =~ /unspecified/;
+
+        my $structname = "sai_${api}_api_t";
+
+        my %struct = ExtractStructInfo($structname, "struct_");
+
+        my @members = ();
+
+        for my $member (GetStructKeysInOrder(\%struct))
+        {
+            my $type = $struct{$member}{type};
+            my $name = $struct{$member}{name};
+
+            if (not defined $FUNCTION_DEF{$type})
+            {
+                LogError "function type $type is not defined for $api.$name";
+                next;
+            }
+
+            if (not $FUNCTION_DEF{$type} =~ /^typedef (\S+)\(\* $type\) \((.+)\)$/)
+            {
+                LogError "failed to match function proto type $type is not defined for $api.$name";
+                next;
+            }
+
+            my $ret = $1;
+            my $params = $2;
+
+            my ($ot, $op) = GetTraceObjectTypeAndOp($api, $name, $type);
+
+            my %fn = (id => uc("SAI_TRACE_FN_${api}_$name"), api => $api, name => $name, ot => $ot, op => $op,
+                ret => $ret, params => $params, args => join(", ", GetTraceArgNames($params)));
+
+            push @fns, \%fn;
+            push @members, \%fn;
+        }
+
+        push @apis, { Api => $Api, api => $api, struct => $structname, members => \@members };
+    }
+
+    WriteTrace "/* AUTOGENERATED FILE! DO NOT EDIT */";
+    WriteTrace "";
+    WriteTrace "#include <pthread.h>";
+    WriteTrace "#include <stddef.h>";
+    WriteTrace "#include \"saimetadata.h\"";
+    WriteTrace "#include \"saitraceutils.h\"";
+    WriteTrace "";
+
+    WriteTrace "typedef enum _sai_trace_fn_t {";
+
+    WriteTrace "$_->{id}," for @fns;
+
+    WriteTrace "SAI_TRACE_FN_COUNT";
+    WriteTrace "} sai_trace_fn_t;";
+    WriteTrace "";
+
+    WriteTrace "const sai_trace_fn_info_t sai_trace_fn_info[] = {";
+
+    for my $fn (@fns)
+    {
+        my $ot = defined $fn->{ot} ? "\"$fn->{ot}\"" : "NULL";
+
+        WriteTrace "{ \"$fn->{name}\", \"$fn->{api}\", $ot, \"$fn->{op}\" },";
+    }
+
+    WriteTrace "};";
+    WriteTrace "";
+    WriteTrace "const size_t sai_trace_fn_info_count = SAI_TRACE_FN_COUNT;";
+    WriteTrace "";
+
+    for my $api (@apis)
+    {
+        my $struct = $api->{struct};
+        my $short = $api->{api};
+
+        WriteTrace "static $struct *sai_trace_real_${short}_api = NULL;";
+        WriteTrace "static $struct sai_trace_${short}_api;";
+        WriteTrace "";
+
+        for my $fn (@{ $api->{members} })
+        {
+            my $call = "sai_trace_real_${short}_api->$fn->{name}($fn->{args})";
+
+            WriteTrace "static $fn->{ret} sai_trace_${short}_$fn->{name}($fn->{params})";
+            WriteTrace "{";
+            WriteTrace "uint64_t start = sai_trace_begin();";
+
+            if ($fn->{ret} eq "sai_status_t")
+            {
+                WriteTrace "sai_status_t status = $call;";
+                WriteTrace "sai_trace_end($fn->{id}, start, status);";
+                WriteTrace "return status;";
+            }
+            elsif ($fn->{ret} eq "void")
+            {
+                WriteTrace "$call;";
+                WriteTrace "sai_trace_end($fn->{id}, start, SAI_STATUS_SUCCESS);";
+            }
+            else
+            {
+                WriteTrace "$fn->{ret} result = $call;";
+                WriteTrace "sai_trace_end($fn->{id}, start, SAI_STATUS_SUCCESS);";
+                WriteTrace "return result;";
+            }
+
+            WriteTrace "}";
+            WriteTrace "";
+        }
+    }
+
+    # vendor can return new table after uninitialize, so tables are updated
+    # on each query, under lock since query can be called from many threads
+
+    WriteTrace "static pthread_mutex_t sai_trace_wrap_mutex = PTHREAD_MUTEX_INITIALIZER;";
+    WriteTrace "";
+    WriteTrace "static void sai_trace_wrap_api(";
+    WriteTrace "_In_ sai_api_t api,";
+    WriteTrace "_Inout_ void **api_method_table)";
+    WriteTrace "{";
+    WriteTrace "pthread_mutex_lock(&sai_trace_wrap_mutex);";
+    WriteTrace "switch (api)";
+    WriteTrace "{";
+
+    for my $api (@apis)
+    {
+        my $struct = $api->{struct};
+        my $short = $api->{api};
+
+        WriteTrace "case $api->{Api}:";
+        WriteTrace "    sai_trace_real_${short}_api = ($struct*)*api_method_table;";
+
+        for my $fn (@{ $api->{members} })
+        {
+            my $name = $fn->{name};
+
+            WriteTrace "    sai_trace_${short}_api.$name = sai_trace_real_${short}_api->$name ? sai_trace_${short}_$name : NULL;";
+        }
+
+        WriteTrace "    *api_method_table = &sai_trace_${short}_api;";
+        WriteTrace "    break;";
+    }
+
+    WriteTrace "default:";
+    WriteTrace "    break;";
+    WriteTrace "}";
+    WriteTrace "pthread_mutex_unlock(&sai_trace_wrap_mutex);";
+    WriteTrace "}";
+    WriteTrace "";
+
+    WriteTrace "static sai_global_apis_t sai_trace_global_apis;";
+    WriteTrace "static pthread_once_t sai_trace_global_apis_once = PTHREAD_ONCE_INIT;";
+    WriteTrace "";
+    WriteTrace "static void sai_trace_global_apis_load(void)";
+    WriteTrace "{";
+
+    for my $name (sort keys %GLOBAL_APIS)
+    {
+        my $short = $1 if $name =~ /^sai_(\w+)/;
+
+        WriteTrace "*(void **) (&sai_trace_global_apis.$short) = sai_trace_dlsym(\"$name\");";
+    }
+
+    WriteTrace "}";
+    WriteTrace "";
+
+    for my $fn (grep { $_->{api} eq "global" } @fns)
+    {
+        my $name = $fn->{name};
+        my $short = $fn->{op};
+        my $type = $GLOBAL_APIS{$name}{type};
+        my $args = $GLOBAL_APIS{$name}{args};
+
+        my @names = GetTraceArgNames($args);
+
+        my $call = "sai_trace_global_apis.$short(" . join(", ", @names) . ")";
+
+        my $missing = ($type eq "sai_status_t") ? "SAI_STATUS_NOT_IMPLEMENTED" : "($type)0";
+
+        WriteTrace "$type $name$args";
+        WriteTrace "{";
+        WriteTrace "pthread_once(&sai_trace_global_apis_once, sai_trace_global_apis_load);";
+        WriteTrace "if (sai_trace_global_apis.$short == NULL)";
+        WriteTrace "{";
+        WriteTrace "return $missing;";
+        WriteTrace "}";
+        WriteTrace "uint64_t start = sai_trace_begin();";
+
+        if ($type eq "sai_status_t")
+        {
+            WriteTrace "sai_status_t status = $call;";
+            WriteTrace "sai_trace_end($fn->{id}, start, status);";
+
+            if ($name eq "sai_api_query")
+            {
+                WriteTrace "if (status == SAI_STATUS_SUCCESS && $names[1] != NULL && *$names[1] != NULL)";
+                WriteTrace "{";
+                WriteTrace "sai_trace_wrap_api($names[0], $names[1]);";
+                WriteTrace "}";
+            }
+
+            WriteTrace "return status;";
+        }
+        else
+        {
+            WriteTrace "$type result = $call;";
+            WriteTrace "sai_trace_end($fn->{id}, start, SAI_STATUS_SUCCESS);";
+            WriteTrace "return result;";
+        }
+
+        WriteTrace "}";
+        WriteTrace "";
+    }
+}
+
 sub CreateDefineMaxConditionsLen
 {
     WriteSectionComment "Define SAI_METADATA_MAX_CONDITIONS_LEN";
@@ -5681,6 +6926,43 @@ sub CreateDefineMaxConditionsLen
     WriteHeader "#define SAI_METADATA_MAX_CONDITIONS_LEN $MAX_CONDITIONS_LEN";
 }
 
+sub CreateDefineMaxConditionAttrs
+{
+    WriteSectionComment "Define SAI_METADATA_MAX_CONDITION_ATTRS";
+
+    WriteHeader "#define SAI_METADATA_MAX_CONDITION_ATTRS $MAX_CONDITION_ATTRS";
+}
+
+sub CreateDefineMaxAttrsMaskWords
+{
+    WriteSectionComment "Define SAI_METADATA_MAX_ATTRS_MASK_WORDS";
+
+    WriteHeader "#define SAI_METADATA_MAX_ATTRS_MASK_WORDS $MAX_ATTRS_MASK_WORDS";
+}
+
+sub CreateDefineMaxObjectTypeRank
+{
+    WriteSectionComment "Define SAI_METADATA_MAX_OBJECT_TYPE_RANK";
+
+    my %ranks = GetObjectTypeRanks();
+
+    WriteHeader "#define SAI_METADATA_MAX_OBJECT_TYPE_RANK $MAX_OBJECT_TYPE_RANK";
+}
+
+sub CreateDefineObjectTypeMaskWords
+{
+    WriteSectionComment "Define SAI_METADATA_OBJECT_TYPE_MASK_WORDS";
+
+    my $words = GetObjectTypeMaskWords();
+
+    WriteHeader "#define SAI_METADATA_OBJECT_TYPE_MASK_WORDS $words";
+
+    # object types beyond SAI_OBJECT_TYPE_MAX (extensions) are not in mask
+
+    WriteHeader "#define SAI_METADATA_OBJECT_TYPE_MASK_BIT(ot, word) \\";
+    WriteHeader "    ((((ot) < SAI_OBJECT_TYPE_MAX) && ((ot) / 64 == (word))) ? (UINT64_C(1) << ((ot) % 64)) : 0)";
+}
+
 #
 # MAIN
 #
@@ -5735,6 +7017,10 @@ CreateMetadataForAttributes();
 
 CreateDefineMaxConditionsLen();
 
+CreateDefineMaxConditionAttrs();
+
+CreateDefineObjectTypeMaskWords();
+
 CreateEnumHelperMethods();
 
 ProcessNonObjectIdObjects();
@@ -5757,12 +7043,18 @@ CreateGenericStatsApi();
 
 CreateGenericQuadBulkApi();
 
+CreateMixedBulkApi();
+
 CreateApisQuery();
 
 CreateGlobalApisQuery();
 
 CreateObjectInfo();
 
+CreateDefineMaxAttrsMaskWords();
+
+CreateDefineMaxObjectTypeRank();
+
 CreateListOfAllAttributes();
 
 CheckCapabilities();
@@ -5801,6 +7093,10 @@ CreateSaiSwigGetApiHelperFunctions();
 
 CreateSaiSwigApiStructs();
 
+CreateCppHeader();
+
+CreateTraceSource();
+
 WriteHeaderFotter();
 
 CreateSourcePragmaPop();
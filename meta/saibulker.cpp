@@ -0,0 +1,466 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saibulker.cpp
+ *
+ * @brief   This module defines SAI Bulker, calls coalescing into bulk API
+ */
+
+#include "saibulker.hpp"
+
+#include <algorithm>
+
+#define SAI_BULKER_KEY_BUFFER_SIZE 256
+
+sai_bulker::sai_bulker(
+        _In_ const sai_apis_t* apis,
+        _In_ sai_object_id_t switch_id,
+        _In_ size_t max_bulk_size,
+        _In_ std::chrono::microseconds max_delay,
+        _In_ sai_bulk_op_error_mode_t mode):
+    m_apis(apis),
+    m_switch_id(switch_id),
+    m_max_bulk_size(max_bulk_size == 0 ? 1 : max_bulk_size),
+    m_max_delay(max_delay),
+    m_mode(mode),
+    m_pending(0),
+    m_stats()
+{
+}
+
+sai_bulker::~sai_bulker()
+{
+    flush();
+}
+
+void sai_bulker::create(
+        _In_ const sai_object_meta_key_t& meta_key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ callback_t callback)
+{
+    enqueue(SAI_COMMON_API_CREATE, meta_key, attr_count, attr_list, callback);
+}
+
+void sai_bulker::remove(
+        _In_ const sai_object_meta_key_t& meta_key,
+        _In_ callback_t callback)
+{
+    enqueue(SAI_COMMON_API_REMOVE, meta_key, 0, NULL, callback);
+}
+
+void sai_bulker::set(
+        _In_ const sai_object_meta_key_t& meta_key,
+        _In_ const sai_attribute_t& attr,
+        _In_ callback_t callback)
+{
+    enqueue(SAI_COMMON_API_SET, meta_key, 1, &attr, callback);
+}
+
+size_t sai_bulker::poll()
+{
+    clock_type::time_point now = clock_type::now();
+
+    size_t count = 0;
+
+    for (const auto& id: get_flush_order())
+    {
+        auto it = m_queues.find(id);
+
+        if (it == m_queues.end() || it->second.entries.empty() || it->second.deadline > now)
+        {
+            continue;
+        }
+
+        m_stats.deadline_flushes++;
+
+        count += flush_until(id);
+    }
+
+    return count;
+}
+
+size_t sai_bulker::flush()
+{
+    size_t count = 0;
+
+    // callbacks can queue new operations, so repeat until all are executed
+
+    while (m_pending)
+    {
+        for (const auto& id: get_flush_order())
+        {
+            count += flush_queue(id);
+        }
+    }
+
+    return count;
+}
+
+sai_bulker::clock_type::time_point sai_bulker::next_deadline() const
+{
+    clock_type::time_point deadline = clock_type::time_point::max();
+
+    for (const auto& kv: m_queues)
+    {
+        if (!kv.second.entries.empty())
+        {
+            deadline = std::min(deadline, kv.second.deadline);
+        }
+    }
+
+    return deadline;
+}
+
+size_t sai_bulker::pending() const
+{
+    return m_pending;
+}
+
+const sai_bulker_stats_t& sai_bulker::stats() const
+{
+    return m_stats;
+}
+
+void sai_bulker::enqueue(
+        _In_ sai_common_api_t api,
+        _In_ const sai_object_meta_key_t& meta_key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ callback_t callback)
+{
+    const sai_object_type_info_t* info = sai_metadata_get_object_type_info(meta_key.objecttype);
+
+    uint64_t key = 0;
+
+    // object id is not known before create, so there is nothing to order on
+
+    bool has_key = !(api == SAI_COMMON_API_CREATE && info && info->isobjectid) && get_key_hash(meta_key, key);
+
+    queue_id_t id(api, meta_key.objecttype);
+
+    if (has_key)
+    {
+        auto it = m_keys.find(key);
+
+        if (it != m_keys.end())
+        {
+            queue_id_t other = it->second;
+
+            if (other == id || is_flushed_after(other, id))
+            {
+                m_stats.key_flushes++;
+
+                flush_until(other);
+            }
+            else
+            {
+                m_queues[id].after.insert(other);
+            }
+        }
+    }
+
+    queue_t& queue = m_queues[id];
+
+    if (queue.entries.empty())
+    {
+        queue.deadline = clock_type::now() + m_max_delay;
+    }
+
+    queue.entries.emplace_back();
+
+    entry_t& entry = queue.entries.back();
+
+    entry.meta_key = meta_key;
+    entry.attr_index = queue.attrs.size();
+    entry.attr_count = attr_count;
+    entry.has_key = has_key;
+    entry.key = key;
+    entry.callback = std::move(callback);
+
+    queue.attrs.insert(queue.attrs.end(), attr_list, attr_list + attr_count);
+
+    if (has_key)
+    {
+        m_keys[key] = id;
+    }
+
+    m_pending++;
+
+    m_stats.queued++;
+
+    if (queue.entries.size() >= m_max_bulk_size)
+    {
+        m_stats.size_flushes++;
+
+        flush_until(id);
+    }
+}
+
+size_t sai_bulker::flush_until(
+        _In_ const queue_id_t& id)
+{
+    // queues before this one in flush order can contain operations
+    // referencing its objects, like route set or remove queued before
+    // remove of its next hop, so they can't be left pending
+
+    size_t count = 0;
+
+    for (const auto& other: get_flush_order())
+    {
+        count += flush_queue(other);
+
+        if (other == id)
+        {
+            break;
+        }
+    }
+
+    return count;
+}
+
+size_t sai_bulker::flush_queue(
+        _In_ const queue_id_t& id)
+{
+    auto it = m_queues.find(id);
+
+    if (it == m_queues.end() || it->second.entries.empty())
+    {
+        return 0;
+    }
+
+    std::set<queue_id_t> after;
+
+    after.swap(it->second.after);
+
+    size_t executed = 0;
+
+    for (const auto& other: after)
+    {
+        executed += flush_queue(other);
+    }
+
+    if (it->second.entries.empty())
+    {
+        // already flushed by callback of queue flushed before
+
+        return executed;
+    }
+
+    // swap before execute, so callbacks can safely queue new operations,
+    // spare buffers are reused to avoid reallocation on each flush
+
+    std::vector<entry_t> entries;
+    std::vector<sai_attribute_t> attrs;
+
+    entries.swap(m_spare_entries);
+    attrs.swap(m_spare_attrs);
+
+    entries.swap(it->second.entries);
+    attrs.swap(it->second.attrs);
+
+    m_pending -= entries.size();
+
+    for (auto& kv: m_queues)
+    {
+        kv.second.after.erase(id);
+    }
+
+    for (const auto& entry: entries)
+    {
+        auto kit = entry.has_key ? m_keys.find(entry.key) : m_keys.end();
+
+        // key could be queued again in other queue
+
+        if (kit != m_keys.end() && kit->second == id)
+        {
+            m_keys.erase(kit);
+        }
+    }
+
+    uint32_t count = (uint32_t)entries.size();
+
+    std::vector<sai_object_meta_key_t> meta_keys(count);
+    std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+    uint32_t idx = 0;
+
+    for (; idx < count; idx++)
+    {
+        meta_keys[idx] = entries[idx].meta_key;
+    }
+
+    sai_status_t status;
+
+    switch (id.first)
+    {
+        case SAI_COMMON_API_CREATE:
+            {
+                std::vector<uint32_t> attr_count(count);
+                std::vector<const sai_attribute_t*> attr_list(count);
+
+                for (idx = 0; idx < count; idx++)
+                {
+                    attr_count[idx] = entries[idx].attr_count;
+                    attr_list[idx] = attrs.data() + entries[idx].attr_index;
+                }
+
+                status = sai_metadata_mixed_bulk_create(m_apis, m_switch_id, count, meta_keys.data(),
+                        attr_count.data(), attr_list.data(), m_mode, statuses.data());
+            }
+            break;
+
+        case SAI_COMMON_API_REMOVE:
+
+            status = sai_metadata_mixed_bulk_remove(m_apis, count, meta_keys.data(), m_mode, statuses.data());
+            break;
+
+        default:
+
+            // set entries have exactly one attribute each
+
+            status = sai_metadata_mixed_bulk_set(m_apis, count, meta_keys.data(), attrs.data(), m_mode, statuses.data());
+            break;
+    }
+
+    if (status != SAI_STATUS_SUCCESS && status != SAI_STATUS_FAILURE)
+    {
+        // whole bulk failed, for example on invalid object type
+
+        std::fill(statuses.begin(), statuses.end(), status);
+    }
+
+    m_stats.flushes++;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        if (entries[idx].callback)
+        {
+            entries[idx].callback(statuses[idx], meta_keys[idx]);
+        }
+    }
+
+    entries.clear();
+    attrs.clear();
+
+    m_spare_entries.swap(entries);
+    m_spare_attrs.swap(attrs);
+
+    return executed + count;
+}
+
+bool sai_bulker::is_flushed_after(
+        _In_ const queue_id_t& id,
+        _In_ const queue_id_t& other) const
+{
+    auto it = m_queues.find(id);
+
+    if (it == m_queues.end())
+    {
+        return false;
+    }
+
+    for (const auto& dep: it->second.after)
+    {
+        if (dep == other || is_flushed_after(dep, other))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<sai_bulker::queue_id_t> sai_bulker::get_flush_order() const
+{
+    std::vector<queue_id_t> order;
+
+    for (const auto& kv: m_queues)
+    {
+        if (!kv.second.entries.empty())
+        {
+            order.push_back(kv.first);
+        }
+    }
+
+    // create and set in dependency order, remove in reverse dependency order
+
+    auto phase = [](sai_common_api_t api) {
+        return api == SAI_COMMON_API_CREATE ? 0 : (api == SAI_COMMON_API_SET ? 1 : 2);
+    };
+
+    auto rank = [](const queue_id_t& id) {
+        int r = sai_metadata_get_object_type_rank(id.second);
+        return id.first == SAI_COMMON_API_REMOVE ? -r : r;
+    };
+
+    std::stable_sort(order.begin(), order.end(), [&](const queue_id_t& a, const queue_id_t& b) {
+            if (phase(a.first) != phase(b.first))
+            {
+                return phase(a.first) < phase(b.first);
+            }
+
+            return rank(a) < rank(b);
+        });
+
+    return order;
+}
+
+bool sai_bulker::get_key_hash(
+        _In_ const sai_object_meta_key_t& meta_key,
+        _Out_ uint64_t& hash) const
+{
+    // binary serialize only serializes meaningful bytes, so padding and
+    // unused union members don't make same keys different
+
+    uint8_t buffer[SAI_BULKER_KEY_BUFFER_SIZE];
+
+    std::vector<uint8_t> large;
+
+    uint8_t* data = buffer;
+
+    int size = sai_serialize_binary_object(buffer, sizeof(buffer), &meta_key, 0, NULL);
+
+    if (size > (int)sizeof(buffer))
+    {
+        large.resize((size_t)size);
+
+        data = large.data();
+
+        size = sai_serialize_binary_object(data, large.size(), &meta_key, 0, NULL);
+    }
+
+    if (size < 0)
+    {
+        return false;
+    }
+
+    // FNV-1a
+
+    hash = UINT64_C(0xcbf29ce484222325);
+
+    int idx = 0;
+
+    for (; idx < size; idx++)
+    {
+        hash = (hash ^ data[idx]) * UINT64_C(0x100000001b3);
+    }
+
+    return true;
+}
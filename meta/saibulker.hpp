@@ -0,0 +1,311 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saibulker.hpp
+ *
+ * @brief   This module defines SAI Bulker, calls coalescing into bulk API
+ */
+
+#ifndef __SAIBULKER_HPP_
+#define __SAIBULKER_HPP_
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#define SAI_BULKER_DEFAULT_MAX_BULK_SIZE 1024
+
+#define SAI_BULKER_DEFAULT_MAX_DELAY_US 1000
+
+/**
+ * @brief Bulker statistics.
+ */
+typedef struct _sai_bulker_stats_t
+{
+    /**
+     * @brief Number of queued create, remove and set calls.
+     */
+    uint64_t queued;
+
+    /**
+     * @brief Number of executed bulk calls.
+     */
+    uint64_t flushes;
+
+    /**
+     * @brief Number of flushes caused by reaching max bulk size.
+     */
+    uint64_t size_flushes;
+
+    /**
+     * @brief Number of flushes caused by expired deadline.
+     */
+    uint64_t deadline_flushes;
+
+    /**
+     * @brief Number of flushes caused by operation on already queued key.
+     */
+    uint64_t key_flushes;
+
+} sai_bulker_stats_t;
+
+/**
+ * @brief Coalesces single create, remove and set calls into bulk calls.
+ *
+ * Calls are queued per object type and operation, and queue is executed
+ * using sai_metadata_mixed_bulk_* when it reaches max bulk size, when its
+ * deadline expires (checked by poll) or on explicit flush. Object types
+ * without native bulk API are executed one by one.
+ *
+ * Operations on the same object key are executed in the order they were
+ * queued. When key is already queued in other queue, new operation queue is
+ * marked to be flushed after that queue, and when key is already queued in
+ * the same queue (or marking would create a cycle), that queue is flushed
+ * before new operation is queued. Key of object id object created by bulker
+ * is known only after flush, so it can be passed to remove and set only
+ * after create callback was called.
+ *
+ * Flush executes create queues in ascending object type rank, then set
+ * queues, then remove queues in descending object type rank. Queue flushed
+ * because of max bulk size, deadline or queued key is not flushed alone,
+ * all queues before it in this order are flushed first, since they can
+ * reference its objects, for example routes set or removed before their
+ * next hop is removed.
+ *
+ * Attributes are copied shallow, so memory referenced by attribute lists
+ * must be valid until operation callback is called. Bulker is not thread
+ * safe, callbacks are called from the thread calling bulker methods.
+ */
+class sai_bulker
+{
+    public:
+
+        /**
+         * @brief Operation completion callback.
+         *
+         * @param[in] status Operation status.
+         * @param[in] meta_key Object meta key, for create contains created object id.
+         */
+        typedef std::function<void(sai_status_t status, const sai_object_meta_key_t& meta_key)> callback_t;
+
+        typedef std::chrono::steady_clock clock_type;
+
+        /**
+         * @brief Create bulker.
+         *
+         * @param[in] apis SAI APIs.
+         * @param[in] switch_id Switch id used to create object id objects.
+         * @param[in] max_bulk_size Max number of operations in single bulk call.
+         * @param[in] max_delay Max time operation is queued before poll flushes it.
+         * @param[in] mode Bulk operation error handling mode.
+         */
+        sai_bulker(
+                _In_ const sai_apis_t* apis,
+                _In_ sai_object_id_t switch_id,
+                _In_ size_t max_bulk_size = SAI_BULKER_DEFAULT_MAX_BULK_SIZE,
+                _In_ std::chrono::microseconds max_delay = std::chrono::microseconds(SAI_BULKER_DEFAULT_MAX_DELAY_US),
+                _In_ sai_bulk_op_error_mode_t mode = SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+
+        /**
+         * @brief Destroy bulker, all queued operations are flushed.
+         */
+        ~sai_bulker();
+
+        sai_bulker(const sai_bulker&) = delete;
+        sai_bulker& operator=(const sai_bulker&) = delete;
+
+    public:
+
+        /**
+         * @brief Queue object create.
+         *
+         * @param[in] meta_key Object meta key, object id is ignored for object id objects.
+         * @param[in] attr_count Number of attributes.
+         * @param[in] attr_list List of attributes.
+         * @param[in] callback Callback called after object create was executed.
+         */
+        void create(
+                _In_ const sai_object_meta_key_t& meta_key,
+                _In_ uint32_t attr_count,
+                _In_ const sai_attribute_t *attr_list,
+                _In_ callback_t callback = callback_t());
+
+        /**
+         * @brief Queue object remove.
+         *
+         * @param[in] meta_key Object meta key.
+         * @param[in] callback Callback called after object remove was executed.
+         */
+        void remove(
+                _In_ const sai_object_meta_key_t& meta_key,
+                _In_ callback_t callback = callback_t());
+
+        /**
+         * @brief Queue object attribute set.
+         *
+         * @param[in] meta_key Object meta key.
+         * @param[in] attr Attribute to set.
+         * @param[in] callback Callback called after attribute set was executed.
+         */
+        void set(
+                _In_ const sai_object_meta_key_t& meta_key,
+                _In_ const sai_attribute_t& attr,
+                _In_ callback_t callback = callback_t());
+
+        /**
+         * @brief Flush queues with expired deadline.
+         *
+         * Should be called periodically from event loop, see next_deadline.
+         *
+         * @return Number of executed operations.
+         */
+        size_t poll();
+
+        /**
+         * @brief Flush all queues.
+         *
+         * @return Number of executed operations.
+         */
+        size_t flush();
+
+        /**
+         * @brief Get earliest deadline of queued operations.
+         *
+         * @return Earliest deadline or clock_type::time_point::max() if nothing is queued.
+         */
+        clock_type::time_point next_deadline() const;
+
+        /**
+         * @brief Get number of queued operations.
+         *
+         * @return Number of queued operations.
+         */
+        size_t pending() const;
+
+        /**
+         * @brief Get bulker statistics.
+         *
+         * @return Bulker statistics.
+         */
+        const sai_bulker_stats_t& stats() const;
+
+    private:
+
+        typedef struct _entry_t
+        {
+            sai_object_meta_key_t meta_key;
+
+            /**
+             * @brief Index of first attribute in queue attributes.
+             */
+            size_t attr_index;
+
+            uint32_t attr_count;
+
+            bool has_key;
+
+            /**
+             * @brief Hash of serialized object key.
+             */
+            uint64_t key;
+
+            callback_t callback;
+
+        } entry_t;
+
+        typedef std::pair<sai_common_api_t, sai_object_type_t> queue_id_t;
+
+        typedef struct _queue_t
+        {
+            std::vector<entry_t> entries;
+
+            std::vector<sai_attribute_t> attrs;
+
+            clock_type::time_point deadline;
+
+            /**
+             * @brief Queues which must be flushed before this queue.
+             */
+            std::set<queue_id_t> after;
+
+        } queue_t;
+
+        void enqueue(
+                _In_ sai_common_api_t api,
+                _In_ const sai_object_meta_key_t& meta_key,
+                _In_ uint32_t attr_count,
+                _In_ const sai_attribute_t *attr_list,
+                _In_ callback_t callback);
+
+        size_t flush_until(
+                _In_ const queue_id_t& id);
+
+        size_t flush_queue(
+                _In_ const queue_id_t& id);
+
+        bool is_flushed_after(
+                _In_ const queue_id_t& id,
+                _In_ const queue_id_t& other) const;
+
+        std::vector<queue_id_t> get_flush_order() const;
+
+        bool get_key_hash(
+                _In_ const sai_object_meta_key_t& meta_key,
+                _Out_ uint64_t& hash) const;
+
+    private:
+
+        const sai_apis_t* m_apis;
+
+        sai_object_id_t m_switch_id;
+
+        size_t m_max_bulk_size;
+
+        std::chrono::microseconds m_max_delay;
+
+        sai_bulk_op_error_mode_t m_mode;
+
+        std::map<queue_id_t, queue_t> m_queues;
+
+        /**
+         * @brief Object key hash to last queue containing it.
+         *
+         * Hash collision only causes unnecessary ordering or flush, so
+         * operations are never reordered.
+         */
+        std::unordered_map<uint64_t, queue_id_t> m_keys;
+
+        std::vector<entry_t> m_spare_entries;
+
+        std::vector<sai_attribute_t> m_spare_attrs;
+
+        size_t m_pending;
+
+        sai_bulker_stats_t m_stats;
+};
+
+#endif /** __SAIBULKER_HPP_ */
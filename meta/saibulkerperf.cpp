@@ -0,0 +1,544 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saibulkerperf.cpp
+ *
+ * @brief   This module defines SAI Bulker performance test
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <arpa/inet.h>
+
+#include <vector>
+
+#include "saibulker.hpp"
+
+#define DEFAULT_ROUTES 1000000
+#define SET_EVERY 10
+#define ROUTE_BASE 0x0a000000
+#define NEXT_HOPS 2048
+#define NEXT_HOP_BASE 0x4000000000000
+
+/*
+ * Stub route api counts calls crossing API boundary and checks that every
+ * set and remove is executed on existing route, so reordering of operations
+ * on the same route by bulker is detected.
+ *
+ * Stub next hop api counts routes referencing next hop, and fails next hop
+ * remove while it's referenced, so reordering of operations on different
+ * object types by bulker is detected.
+ */
+
+static uint64_t perf_calls;
+static uint64_t perf_order_errors;
+static uint64_t perf_failures;
+
+static std::vector<uint8_t> perf_created;
+
+static std::vector<sai_object_id_t> perf_route_next_hop;
+
+static std::vector<uint32_t> perf_next_hop_refs;
+
+static std::vector<uint8_t> perf_next_hop_created;
+
+static uint32_t perf_routes = DEFAULT_ROUTES;
+
+static void perf_route_set_next_hop(
+        _In_ uint32_t idx,
+        _In_ sai_object_id_t next_hop_id)
+{
+    if (perf_route_next_hop[idx] != SAI_NULL_OBJECT_ID)
+    {
+        perf_next_hop_refs[perf_route_next_hop[idx] - NEXT_HOP_BASE]--;
+    }
+
+    if (next_hop_id != SAI_NULL_OBJECT_ID)
+    {
+        perf_next_hop_refs[next_hop_id - NEXT_HOP_BASE]++;
+    }
+
+    perf_route_next_hop[idx] = next_hop_id;
+}
+
+static sai_status_t perf_route_op(
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ sai_common_api_t api,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    uint32_t idx = ntohl(route_entry->destination.addr.ip4) - ROUTE_BASE;
+
+    if (idx >= perf_created.size())
+    {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if ((api == SAI_COMMON_API_CREATE) == (perf_created[idx] != 0))
+    {
+        perf_order_errors++;
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    uint32_t i = 0;
+
+    for (; i < attr_count; i++)
+    {
+        if (attr_list[i].id != SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID || attr_list[i].value.oid == SAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        uint64_t nh = attr_list[i].value.oid - NEXT_HOP_BASE;
+
+        if (nh >= perf_next_hop_created.size() || !perf_next_hop_created[nh])
+        {
+            perf_order_errors++;
+
+            return SAI_STATUS_INVALID_ATTR_VALUE_0;
+        }
+
+        perf_route_set_next_hop(idx, attr_list[i].value.oid);
+    }
+
+    if (api == SAI_COMMON_API_REMOVE)
+    {
+        perf_route_set_next_hop(idx, SAI_NULL_OBJECT_ID);
+    }
+
+    if (api != SAI_COMMON_API_SET)
+    {
+        perf_created[idx] = (api == SAI_COMMON_API_CREATE);
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t perf_create_route_entry(
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    perf_calls++;
+
+    return perf_route_op(route_entry, SAI_COMMON_API_CREATE, attr_count, attr_list);
+}
+
+static sai_status_t perf_remove_route_entry(
+        _In_ const sai_route_entry_t *route_entry)
+{
+    perf_calls++;
+
+    return perf_route_op(route_entry, SAI_COMMON_API_REMOVE, 0, NULL);
+}
+
+static sai_status_t perf_set_route_entry_attribute(
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ const sai_attribute_t *attr)
+{
+    perf_calls++;
+
+    return perf_route_op(route_entry, SAI_COMMON_API_SET, 1, attr);
+}
+
+static sai_status_t perf_bulk_route_op(
+        _In_ uint32_t object_count,
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ sai_common_api_t api,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ const sai_attribute_t *attr,
+        _Out_ sai_status_t *object_statuses)
+{
+    perf_calls++;
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    uint32_t idx = 0;
+
+    for (; idx < object_count; idx++)
+    {
+        if (api == SAI_COMMON_API_CREATE)
+        {
+            object_statuses[idx] = perf_route_op(&route_entry[idx], api, attr_count[idx], attr_list[idx]);
+        }
+        else if (api == SAI_COMMON_API_SET)
+        {
+            object_statuses[idx] = perf_route_op(&route_entry[idx], api, 1, &attr[idx]);
+        }
+        else
+        {
+            object_statuses[idx] = perf_route_op(&route_entry[idx], api, 0, NULL);
+        }
+
+        if (object_statuses[idx] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+static sai_status_t perf_create_route_entries(
+        _In_ uint32_t object_count,
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return perf_bulk_route_op(object_count, route_entry, SAI_COMMON_API_CREATE, attr_count, attr_list, NULL, object_statuses);
+}
+
+static sai_status_t perf_remove_route_entries(
+        _In_ uint32_t object_count,
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return perf_bulk_route_op(object_count, route_entry, SAI_COMMON_API_REMOVE, NULL, NULL, NULL, object_statuses);
+}
+
+static sai_status_t perf_set_route_entries_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return perf_bulk_route_op(object_count, route_entry, SAI_COMMON_API_SET, NULL, NULL, attr_list, object_statuses);
+}
+
+static sai_status_t perf_remove_next_hop(
+        _In_ sai_object_id_t next_hop_id)
+{
+    perf_calls++;
+
+    uint64_t idx = next_hop_id - NEXT_HOP_BASE;
+
+    if (idx >= perf_next_hop_created.size() || !perf_next_hop_created[idx])
+    {
+        return SAI_STATUS_INVALID_OBJECT_ID;
+    }
+
+    if (perf_next_hop_refs[idx])
+    {
+        perf_order_errors++;
+
+        return SAI_STATUS_OBJECT_IN_USE;
+    }
+
+    perf_next_hop_created[idx] = 0;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void perf_route_meta_key(
+        _In_ uint32_t idx,
+        _Out_ sai_object_meta_key_t *meta_key)
+{
+    memset(meta_key, 0, sizeof(sai_object_meta_key_t));
+
+    meta_key->objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+
+    sai_route_entry_t *re = &meta_key->objectkey.key.route_entry;
+
+    re->switch_id = 0x21000000000000;
+    re->vr_id = 0x3000000000001;
+    re->destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    re->destination.addr.ip4 = htonl(ROUTE_BASE + idx);
+    re->destination.mask.ip4 = 0xffffffff;
+}
+
+static void perf_report(
+        _In_ const char *name,
+        _In_ clock_t start)
+{
+    double ms = (double)(clock() - start) * 1e3 / CLOCKS_PER_SEC;
+
+    printf("%-30s %10" PRIu64 " calls %10.1f ms %" PRIu64 " order errors %" PRIu64 " failures\n",
+            name, perf_calls, ms, perf_order_errors, perf_failures);
+}
+
+static void perf_reset()
+{
+    perf_calls = 0;
+    perf_order_errors = 0;
+    perf_failures = 0;
+
+    perf_created.assign(perf_routes, 0);
+    perf_route_next_hop.assign(perf_routes, SAI_NULL_OBJECT_ID);
+    perf_next_hop_refs.assign(NEXT_HOPS, 0);
+    perf_next_hop_created.assign(NEXT_HOPS, 0);
+}
+
+static void perf_single(
+        _In_ sai_route_api_t *route_api)
+{
+    perf_reset();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    sai_object_meta_key_t mk;
+
+    clock_t start = clock();
+
+    uint32_t idx = 0;
+
+    for (; idx < perf_routes; idx++)
+    {
+        perf_route_meta_key(idx, &mk);
+
+        perf_failures += route_api->create_route_entry(&mk.objectkey.key.route_entry, 1, &attr) != SAI_STATUS_SUCCESS;
+
+        if (idx % SET_EVERY == 0)
+        {
+            perf_failures += route_api->set_route_entry_attribute(&mk.objectkey.key.route_entry, &attr) != SAI_STATUS_SUCCESS;
+        }
+    }
+
+    for (idx = 0; idx < perf_routes; idx++)
+    {
+        perf_route_meta_key(idx, &mk);
+
+        perf_failures += route_api->remove_route_entry(&mk.objectkey.key.route_entry) != SAI_STATUS_SUCCESS;
+    }
+
+    perf_report("single calls", start);
+}
+
+static void perf_bulker(
+        _In_ const sai_apis_t *apis,
+        _In_ size_t max_bulk_size)
+{
+    perf_reset();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attr.value.s32 = SAI_PACKET_ACTION_FORWARD;
+
+    sai_object_meta_key_t mk;
+
+    uint64_t completed = 0;
+
+    auto callback = [&](sai_status_t status, const sai_object_meta_key_t& meta_key) {
+        completed++;
+        perf_failures += status != SAI_STATUS_SUCCESS;
+    };
+
+    clock_t start = clock();
+
+    sai_bulker bulker(apis, SAI_NULL_OBJECT_ID, max_bulk_size);
+
+    uint32_t idx = 0;
+
+    for (; idx < perf_routes; idx++)
+    {
+        perf_route_meta_key(idx, &mk);
+
+        bulker.create(mk, 1, &attr, callback);
+
+        if (idx % SET_EVERY == 0)
+        {
+            bulker.set(mk, attr, callback);
+        }
+    }
+
+    for (idx = 0; idx < perf_routes; idx++)
+    {
+        perf_route_meta_key(idx, &mk);
+
+        bulker.remove(mk, callback);
+    }
+
+    bulker.flush();
+
+    char name[64];
+
+    snprintf(name, sizeof(name), "bulker size %zu", max_bulk_size);
+
+    perf_report(name, start);
+
+    const sai_bulker_stats_t& stats = bulker.stats();
+
+    printf("%-30s %10" PRIu64 " queued %" PRIu64 " flushes (%" PRIu64 " size, %" PRIu64 " key) %" PRIu64 " completed\n",
+            "", stats.queued, stats.flushes, stats.size_flushes, stats.key_flushes, completed);
+
+    if (completed != stats.queued)
+    {
+        perf_failures++;
+    }
+}
+
+static void perf_bulker_next_hops(
+        _In_ const sai_apis_t *apis,
+        _In_ size_t max_bulk_size)
+{
+    perf_reset();
+
+    // every route uses one of first half of next hops, then routes are
+    // removed or moved to second half, and first half is removed
+
+    uint32_t half = NEXT_HOPS / 2;
+
+    uint32_t idx = 0;
+
+    for (; idx < NEXT_HOPS; idx++)
+    {
+        perf_next_hop_created[idx] = 1;
+    }
+
+    for (idx = 0; idx < perf_routes; idx++)
+    {
+        perf_created[idx] = 1;
+
+        perf_route_set_next_hop(idx, NEXT_HOP_BASE + idx % half);
+    }
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+
+    sai_object_meta_key_t mk;
+
+    uint64_t completed = 0;
+
+    auto callback = [&](sai_status_t status, const sai_object_meta_key_t& meta_key) {
+        completed++;
+        perf_failures += status != SAI_STATUS_SUCCESS;
+    };
+
+    clock_t start = clock();
+
+    sai_bulker bulker(apis, SAI_NULL_OBJECT_ID, max_bulk_size);
+
+    for (idx = 0; idx < perf_routes; idx++)
+    {
+        perf_route_meta_key(idx, &mk);
+
+        if (idx % 2)
+        {
+            attr.value.oid = NEXT_HOP_BASE + half + idx % half;
+
+            bulker.set(mk, attr, callback);
+        }
+        else
+        {
+            bulker.remove(mk, callback);
+        }
+    }
+
+    memset(&mk, 0, sizeof(mk));
+
+    mk.objecttype = SAI_OBJECT_TYPE_NEXT_HOP;
+
+    for (idx = 0; idx < half; idx++)
+    {
+        mk.objectkey.key.object_id = NEXT_HOP_BASE + idx;
+
+        bulker.remove(mk, callback);
+    }
+
+    bulker.flush();
+
+    char name[64];
+
+    snprintf(name, sizeof(name), "bulker next hops size %zu", max_bulk_size);
+
+    perf_report(name, start);
+
+    if (completed != bulker.stats().queued)
+    {
+        perf_failures++;
+    }
+}
+
+int main(
+        _In_ int argc,
+        _In_ char **argv)
+{
+    if (argc > 1)
+    {
+        perf_routes = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    printf("routes: %u\n", perf_routes);
+
+    sai_route_api_t route_api;
+
+    memset(&route_api, 0, sizeof(route_api));
+
+    route_api.create_route_entry = perf_create_route_entry;
+    route_api.remove_route_entry = perf_remove_route_entry;
+    route_api.set_route_entry_attribute = perf_set_route_entry_attribute;
+    route_api.create_route_entries = perf_create_route_entries;
+    route_api.remove_route_entries = perf_remove_route_entries;
+    route_api.set_route_entries_attribute = perf_set_route_entries_attribute;
+
+    sai_apis_t apis;
+
+    memset(&apis, 0, sizeof(apis));
+
+    apis.route_api = &route_api;
+
+    sai_next_hop_api_t next_hop_api;
+
+    memset(&next_hop_api, 0, sizeof(next_hop_api));
+
+    next_hop_api.remove_next_hop = perf_remove_next_hop;
+
+    apis.next_hop_api = &next_hop_api;
+
+    uint64_t errors = 0;
+
+    perf_single(&route_api);
+
+    errors += perf_order_errors + perf_failures;
+
+    perf_bulker(&apis, 1);
+
+    errors += perf_order_errors + perf_failures;
+
+    perf_bulker(&apis, 64);
+
+    errors += perf_order_errors + perf_failures;
+
+    perf_bulker(&apis, SAI_BULKER_DEFAULT_MAX_BULK_SIZE);
+
+    errors += perf_order_errors + perf_failures;
+
+    perf_bulker_next_hops(&apis, 64);
+
+    errors += perf_order_errors + perf_failures;
+
+    perf_bulker_next_hops(&apis, SAI_BULKER_DEFAULT_MAX_BULK_SIZE);
+
+    errors += perf_order_errors + perf_failures;
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saimetadatahpptest.cpp
+ *
+ * @brief   This module defines SAI Metadata C++ Header Test
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+#include "saimetadata.hpp"
+
+#define ASSERT_TRUE(x,fmt,...)                              \
+    if (!(x)){                                              \
+        fprintf(stderr,                                     \
+                "ASSERT TRUE FAILED(%s:%d): %s: " fmt "\n", \
+                __func__, __LINE__, #x, ##__VA_ARGS__);     \
+        exit(1);}
+
+static_assert(std::is_same<sai_attr<SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID>::type, sai_object_id_t>::value,
+        "next hop id should be object id");
+static_assert(std::is_same<sai_attr<SAI_PORT_ATTR_HW_LANE_LIST>::type, sai_u32_list_t>::value,
+        "hw lane list should be u32 list");
+static_assert(std::is_same<sai_attr<SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION>::type, int32_t>::value,
+        "enum attributes should be stored in s32");
+static_assert(std::is_same<sai_attr<SAI_ACL_ENTRY_ATTR_FIELD_SRC_IP>::type, sai_acl_field_data_t>::value,
+        "acl field should be stored in aclfield");
+
+static_assert(sai_attr<SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID>::objecttype == SAI_OBJECT_TYPE_ROUTE_ENTRY,
+        "wrong object type");
+static_assert(sai_attr<SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID>::attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID,
+        "wrong attribute value type");
+static_assert(sai_attr<SAI_PORT_ATTR_HW_LANE_LIST>::has_flag(SAI_ATTR_FLAGS_MANDATORY_ON_CREATE),
+        "hw lane list should be mandatory on create");
+static_assert(!sai_attr<SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID>::has_flag(SAI_ATTR_FLAGS_READ_ONLY),
+        "next hop id should not be read only");
+
+/* attributes with the same numeric value on different object types are distinct */
+
+static_assert((sai_attr_id_t)SAI_PORT_ATTR_TYPE == (sai_attr_id_t)SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION,
+        "expected attributes to share the same value");
+static_assert(sai_attr<SAI_PORT_ATTR_TYPE>::objecttype != sai_attr<SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION>::objecttype,
+        "attributes of different object types should not collide");
+
+template <auto A>
+void test_traits_match_metadata()
+{
+    const sai_attr_metadata_t* md = sai_attr<A>::metadata();
+
+    ASSERT_TRUE(md != NULL, "metadata not found for attr %d", (int)A);
+    ASSERT_TRUE(md->objecttype == sai_attr<A>::objecttype, "object type mismatch on %s", md->attridname);
+    ASSERT_TRUE(md->attrid == sai_attr<A>::attrid, "attr id mismatch on %s", md->attridname);
+    ASSERT_TRUE(md->attrvaluetype == sai_attr<A>::attrvaluetype, "value type mismatch on %s", md->attridname);
+    ASSERT_TRUE(md->flags == sai_attr<A>::flags, "flags mismatch on %s", md->attridname);
+}
+
+void test_traits()
+{
+    test_traits_match_metadata<SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID>();
+    test_traits_match_metadata<SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION>();
+    test_traits_match_metadata<SAI_PORT_ATTR_TYPE>();
+    test_traits_match_metadata<SAI_PORT_ATTR_HW_LANE_LIST>();
+    test_traits_match_metadata<SAI_ACL_ENTRY_ATTR_FIELD_SRC_IP>();
+    test_traits_match_metadata<SAI_HOSTIF_ATTR_NAME>();
+}
+
+void test_get_set()
+{
+    sai_attribute_t attr;
+
+    memset(&attr, 0, sizeof(attr));
+
+    sai_attr<SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID>::set(attr, 0x1234);
+
+    ASSERT_TRUE(attr.id == SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID, "set should assign attr id");
+    ASSERT_TRUE(attr.value.oid == 0x1234, "set should assign oid");
+    ASSERT_TRUE(sai_attr<SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID>::get(attr) == 0x1234, "get should read oid");
+
+    sai_attr<SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION>::get(attr) = SAI_PACKET_ACTION_TRAP;
+
+    ASSERT_TRUE(attr.value.s32 == SAI_PACKET_ACTION_TRAP, "get should return reference to s32");
+
+    const sai_attribute_t& cattr = attr;
+
+    ASSERT_TRUE(&sai_attr<SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION>::get(cattr) == &attr.value.s32,
+            "const get should refer to union member");
+
+    attr.id = SAI_HOSTIF_ATTR_NAME;
+
+    strncpy(sai_attr<SAI_HOSTIF_ATTR_NAME>::get(attr), "Ethernet0", SAI_HOSTIF_NAME_SIZE - 1);
+
+    ASSERT_TRUE(strcmp(attr.value.chardata, "Ethernet0") == 0, "get should return chardata array");
+}
+
+void test_set_array()
+{
+    sai_attribute_t attr;
+
+    memset(&attr, 0, sizeof(attr));
+
+    sai_mac_t mac = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55 };
+
+    sai_attr<SAI_SWITCH_ATTR_SRC_MAC_ADDRESS>::set(attr, mac);
+
+    ASSERT_TRUE(attr.id == SAI_SWITCH_ATTR_SRC_MAC_ADDRESS, "set should assign attr id");
+    ASSERT_TRUE(memcmp(attr.value.mac, mac, sizeof(sai_mac_t)) == 0, "set should copy mac");
+
+    /* value is whole chardata array, not just host interface name size */
+
+    sai_attr<SAI_HOSTIF_ATTR_NAME>::type name;
+
+    memset(name, 0, sizeof(name));
+
+    strncpy(name, "Ethernet4", SAI_HOSTIF_NAME_SIZE - 1);
+
+    sai_attr<SAI_HOSTIF_ATTR_NAME>::set(attr, name);
+
+    ASSERT_TRUE(attr.id == SAI_HOSTIF_ATTR_NAME, "set should assign attr id");
+    ASSERT_TRUE(strcmp(attr.value.chardata, "Ethernet4") == 0, "set should copy chardata");
+}
+
+int main()
+{
+    test_traits();
+    test_get_set();
+    test_set_array();
+
+    return 0;
+}
@@ -767,6 +767,15 @@ typedef struct _sai_attr_condition_t
      */
     sai_attr_condition_type_t           type;
 
+    /**
+     * @brief Index of condition attribute in object type info condition
+     * attributes list.
+     *
+     * Valid only if type is NONE. Allows to evaluate condition against
+     * attribute values collected in single pass over attribute list.
+     */
+    size_t                              attrindex;
+
 } sai_attr_condition_t;
 
 /**
@@ -881,6 +890,15 @@ typedef struct _sai_enum_metadata_t
      */
     sai_object_type_t               objecttype;
 
+    /**
+     * @brief Array of indexes to values names sorted by name.
+     *
+     * Indexes point to values and valuesnames arrays, and are sorted in
+     * ascending strcmp order of corresponding values names, so enum value can
+     * be found by name using binary search. Array is terminated by -1.
+     */
+    const int* const                valuesnamessortedindex;
+
 } sai_enum_metadata_t;
 
 /**
@@ -940,6 +958,8 @@ typedef struct _sai_attr_metadata_t
 
     /**
      * @brief Extracted brief description from Doxygen comment.
+     *
+     * Empty string when metadata was generated in lean mode.
      */
     const char* const                           brief;
 
@@ -1320,8 +1340,111 @@ typedef struct _sai_attr_metadata_t
      */
     bool                                        nextrelease;
 
+    /**
+     * @brief Bit mask of allowed object types.
+     *
+     * Contains SAI_METADATA_OBJECT_TYPE_MASK_WORDS words, object type is
+     * allowed when bit (object type % 64) is set in word (object type / 64).
+     * Only object types below SAI_OBJECT_TYPE_MAX are present in mask, so
+     * extensions object types must be checked on allowed object types list.
+     *
+     * If attribute is not object id attribute, then mask is NULL.
+     */
+    const uint64_t* const                       allowedobjecttypesmask;
+
 } sai_attr_metadata_t;
 
+/**
+ * @brief Attribute descriptor properties.
+ *
+ * @flags strict
+ */
+typedef enum _sai_attr_descriptor_property_t
+{
+    /**
+     * @brief Attribute value is enum.
+     */
+    SAI_ATTR_DESCRIPTOR_PROPERTY_ENUM          = (1 << 0),
+
+    /**
+     * @brief Attribute value is enum list.
+     */
+    SAI_ATTR_DESCRIPTOR_PROPERTY_ENUM_LIST     = (1 << 1),
+
+    /**
+     * @brief Attribute value is object id or object id list.
+     */
+    SAI_ATTR_DESCRIPTOR_PROPERTY_OID           = (1 << 2),
+
+    /**
+     * @brief Attribute is conditional.
+     */
+    SAI_ATTR_DESCRIPTOR_PROPERTY_CONDITIONAL   = (1 << 3),
+
+    /**
+     * @brief Attribute is valid only.
+     */
+    SAI_ATTR_DESCRIPTOR_PROPERTY_VALID_ONLY    = (1 << 4),
+
+    /**
+     * @brief Attribute value is primitive.
+     */
+    SAI_ATTR_DESCRIPTOR_PROPERTY_PRIMITIVE     = (1 << 5),
+
+    /**
+     * @brief Attribute is custom range attribute.
+     */
+    SAI_ATTR_DESCRIPTOR_PROPERTY_CUSTOM        = (1 << 6),
+
+    /**
+     * @brief Attribute is extensions range attribute.
+     */
+    SAI_ATTR_DESCRIPTOR_PROPERTY_EXTENSION     = (1 << 7),
+
+} sai_attr_descriptor_property_t;
+
+/**
+ * @def Defines helper to check if attribute descriptor has property.
+ */
+#define SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, p)  (((d)->properties & (p)) == (p))
+
+/**
+ * @def Defines helper to check if attribute descriptor has flag.
+ */
+#define SAI_ATTR_DESCRIPTOR_HAS_FLAG(d, f)      (((d)->flags & (f)) == (f))
+
+/**
+ * @brief Attribute descriptor
+ *
+ * Compact copy of attribute metadata fields used by hot paths. Descriptors
+ * of object type are stored in array indexed the same way as object type
+ * info attribute metadata, so iterating over attributes of object type
+ * don't need to touch attribute metadata.
+ */
+typedef struct _sai_attr_descriptor_t
+{
+    /**
+     * @brief Attribute id.
+     */
+    sai_attr_id_t                       attrid;
+
+    /**
+     * @brief Attribute value type (sai_attr_value_type_t).
+     */
+    uint16_t                            attrvaluetype;
+
+    /**
+     * @brief Attribute flags (sai_attr_flags_t).
+     */
+    uint8_t                             flags;
+
+    /**
+     * @brief Attribute properties (sai_attr_descriptor_property_t).
+     */
+    uint8_t                             properties;
+
+} sai_attr_descriptor_t;
+
 /*
  * TODO since non object id members can have different type and can be located
  * at different object_key union position, we need to find a way to extract
@@ -1467,6 +1590,31 @@ typedef struct _sai_rev_graph_member_t
 
 } sai_rev_graph_member_t;
 
+/**
+ * @brief SAI reverse graph index
+ *
+ * Range of reverse graph members of object type which
+ * are used by single dependency object type.
+ */
+typedef struct _sai_rev_graph_index_t
+{
+    /**
+     * @brief Defines dependency object type.
+     */
+    sai_object_type_t                       depobjecttype;
+
+    /**
+     * @brief Index of first member in reverse graph members.
+     */
+    uint32_t                                index;
+
+    /**
+     * @brief Number of members.
+     */
+    uint32_t                                count;
+
+} sai_rev_graph_index_t;
+
 /*
  * Generic QUAD API definitions. All APIs can be called using this quad generic
  * functions.
@@ -1658,8 +1806,124 @@ typedef struct _sai_object_type_info_t
      */
     bool                                            iscustom;
 
+    /**
+     * @brief Attributes referenced by conditions and valid only conditions.
+     *
+     * Sorted by attribute id, condition attribute index points to this list.
+     */
+    const sai_attr_metadata_t* const* const         conditionattrs;
+
+    /**
+     * @brief Defines count of condition attributes.
+     */
+    size_t                                          conditionattrscount;
+
+    /**
+     * @brief Defines number of 64 bit words in attributes masks.
+     *
+     * Bit position in each mask is attribute index in attributes metadata.
+     */
+    size_t                                          attrsmaskwords;
+
+    /**
+     * @brief Mask of attributes with MANDATORY_ON_CREATE flag.
+     */
+    const uint64_t* const                           mandatoryattrsmask;
+
+    /**
+     * @brief Mask of attributes with CREATE_ONLY flag.
+     */
+    const uint64_t* const                           createonlyattrsmask;
+
+    /**
+     * @brief Mask of attributes with READ_ONLY flag.
+     */
+    const uint64_t* const                           readonlyattrsmask;
+
+    /**
+     * @brief Mask of conditional attributes.
+     */
+    const uint64_t* const                           conditionalattrsmask;
+
+    /**
+     * @brief Attributes descriptors.
+     *
+     * Array of attribute metadata length, indexed the same way as attribute
+     * metadata.
+     */
+    const sai_attr_descriptor_t* const              attrdescriptors;
+
+    /**
+     * @brief Reverse dependency graph index.
+     *
+     * Ranges of reverse graph members grouped by dependency object type,
+     * sorted by dependency object type value.
+     */
+    const sai_rev_graph_index_t* const              revgraphindex;
+
+    /**
+     * @brief Reverse dependency graph index count.
+     */
+    size_t                                          revgraphindexcount;
+
+    /**
+     * @brief Attributes which can hold object id (NULL terminated).
+     *
+     * Attributes are in the same order as in attribute metadata.
+     */
+    const sai_attr_metadata_t* const* const         oidattrs;
+
+    /**
+     * @brief Attributes which can hold object id count.
+     */
+    size_t                                          oidattrscount;
+
+    /**
+     * @brief Dependency rank of object type.
+     *
+     * Object type can only depend on object types with lower rank, so objects
+     * can be created in ascending rank order and removed in descending rank
+     * order. Dependencies on create and set attributes which would introduce
+     * cycle are not taken into account.
+     */
+    uint32_t                                        rank;
+
 } sai_object_type_info_t;
 
+/**
+ * @brief Attribute list index
+ *
+ * Built once per attribute list, allows to find attribute on the list by
+ * attribute id without scanning the list.
+ */
+typedef struct _sai_attr_list_index_t
+{
+    /**
+     * @brief Object type info of indexed attributes.
+     */
+    const sai_object_type_info_t*                   objecttypeinfo;
+
+    /**
+     * @brief Number of attributes on indexed list.
+     */
+    uint32_t                                        attrcount;
+
+    /**
+     * @brief Indexed attribute list.
+     */
+    const sai_attribute_t*                          attrlist;
+
+    /**
+     * @brief Slots indexed the same way as object type info attribute
+     * metadata.
+     *
+     * Each slot holds attribute position on the list plus one, or zero if
+     * attribute is not on the list.
+     */
+    const uint16_t*                                 slots;
+
+} sai_attr_list_index_t;
+
 /**
  * @}
  */
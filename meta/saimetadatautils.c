@@ -23,6 +23,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sai.h>
 #include "saimetadatautils.h"
@@ -37,6 +38,16 @@ bool sai_metadata_is_allowed_object_type(
         return false;
     }
 
+    if (metadata->allowedobjecttypesmask != NULL &&
+            object_type >= SAI_OBJECT_TYPE_NULL && object_type < SAI_OBJECT_TYPE_MAX)
+    {
+        uint32_t ot = (uint32_t)object_type;
+
+        return (metadata->allowedobjecttypesmask[ot / 64] >> (ot % 64)) & 1;
+    }
+
+    /* extensions object types are not present in mask */
+
     size_t i = 0;
 
     for (; i < metadata->allowedobjecttypeslength; ++i)
@@ -59,33 +70,100 @@ bool sai_metadata_is_allowed_enum_value(
         return false;
     }
 
-    size_t i = 0;
+    return sai_metadata_get_enum_value_name(metadata->enummetadata, value) != NULL;
+}
+
+bool sai_metadata_validate_enum_list(
+        _In_ const sai_attr_metadata_t* metadata,
+        _In_ uint32_t count,
+        _In_ const int32_t* list)
+{
+    if (metadata == NULL || metadata->enummetadata == NULL || (list == NULL && count != 0))
+    {
+        return false;
+    }
 
     const sai_enum_metadata_t *emd = metadata->enummetadata;
 
-    for (; i < emd->valuescount; ++i)
+    if (emd->valuescount == 0)
+    {
+        return count == 0;
+    }
+
+    uint32_t idx;
+
+    int first = emd->values[0];
+    int last = emd->values[emd->valuescount - 1];
+
+    if (first <= last && (int64_t)last - first == (int64_t)emd->valuescount - 1)
     {
-        if (emd->values[i] == value)
+        /*
+         * Values are contiguous, so each list item only needs range check,
+         * this loop has no branches and can be vectorized by compiler.
+         */
+
+        uint32_t span = (uint32_t)last - (uint32_t)first;
+
+        uint32_t invalid = 0;
+
+        for (idx = 0; idx < count; idx++)
         {
-            return true;
+            invalid |= ((uint32_t)list[idx] - (uint32_t)first) > span;
         }
+
+        return invalid == 0;
     }
 
-    return false;
+    for (idx = 0; idx < count; idx++)
+    {
+        if (sai_metadata_get_enum_value_name(emd, list[idx]) == NULL)
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
-const sai_attr_metadata_t* sai_metadata_get_attr_metadata(
-        _In_ sai_object_type_t objecttype,
-        _In_ sai_attr_id_t attrid)
+bool sai_metadata_validate_object_list(
+        _In_ const sai_attr_metadata_t* metadata,
+        _In_ uint32_t count,
+        _In_ const sai_object_type_t* object_type_list)
 {
-    const sai_object_type_info_t* oi = sai_metadata_get_object_type_info(objecttype);
+    if (metadata == NULL || metadata->allowedobjecttypes == NULL || (object_type_list == NULL && count != 0))
+    {
+        return false;
+    }
 
-    if (oi == NULL)
+    const uint64_t *mask = metadata->allowedobjecttypesmask;
+
+    uint32_t idx;
+
+    for (idx = 0; idx < count; idx++)
     {
-        return NULL;
+        uint32_t ot = (uint32_t)object_type_list[idx];
+
+        if (mask != NULL && ot < (uint32_t)SAI_OBJECT_TYPE_MAX)
+        {
+            if (((mask[ot / 64] >> (ot % 64)) & 1) == 0)
+            {
+                return false;
+            }
+        }
+        else if (!sai_metadata_is_allowed_object_type(metadata, object_type_list[idx]))
+        {
+            return false;
+        }
     }
 
-    const sai_attr_metadata_t* const* const md = oi->attrmetadata;
+    return true;
+}
+
+static ssize_t sai_metadata_get_attr_metadata_index(
+        _In_ const sai_object_type_info_t* oi,
+        _In_ sai_attr_id_t attrid)
+{
+    const sai_attr_descriptor_t* const d = oi->attrdescriptors;
 
     /*
      * Most object attributes are not flags, so we can use direct index to
@@ -94,21 +172,138 @@ const sai_attr_metadata_t* sai_metadata_get_attr_metadata(
 
     if (!oi->enummetadata->containsflags && attrid < oi->attridend)
     {
-        return md[attrid];
+        return (ssize_t)attrid;
     }
 
-    /* otherwise search one by one */
+    /*
+     * Otherwise (flags, extensions or custom range attributes) use binary
+     * search, attribute metadata array is sorted by attribute id in strictly
+     * increasing order, this is enforced by sanity check. Search is using
+     * descriptors, so only single array is touched.
+     */
 
-    size_t index = 0;
+    size_t first = 0;
+    size_t last = oi->attrmetadatalength;
 
-    for (; md[index] != NULL; index++)
+    while (first < last)
     {
-        if (md[index]->attrid == attrid)
+        size_t middle = first + (last - first) / 2;
+
+        if (d[middle].attrid == attrid)
+        {
+            return (ssize_t)middle;
+        }
+
+        if (d[middle].attrid < attrid)
+        {
+            first = middle + 1;
+        }
+        else
         {
-            return md[index];
+            last = middle;
         }
     }
 
+    return -1;
+}
+
+const sai_attr_metadata_t* sai_metadata_get_attr_metadata(
+        _In_ sai_object_type_t objecttype,
+        _In_ sai_attr_id_t attrid)
+{
+    const sai_object_type_info_t* oi = sai_metadata_get_object_type_info(objecttype);
+
+    if (oi == NULL)
+    {
+        return NULL;
+    }
+
+    ssize_t idx = sai_metadata_get_attr_metadata_index(oi, attrid);
+
+    if (idx < 0)
+    {
+        return NULL;
+    }
+
+    return oi->attrmetadata[idx];
+}
+
+const sai_attr_descriptor_t* sai_metadata_get_attr_descriptor(
+        _In_ sai_object_type_t objecttype,
+        _In_ sai_attr_id_t attrid)
+{
+    const sai_object_type_info_t* oi = sai_metadata_get_object_type_info(objecttype);
+
+    if (oi == NULL)
+    {
+        return NULL;
+    }
+
+    ssize_t idx = sai_metadata_get_attr_metadata_index(oi, attrid);
+
+    if (idx < 0)
+    {
+        return NULL;
+    }
+
+    return &oi->attrdescriptors[idx];
+}
+
+const sai_attr_metadata_t* sai_metadata_get_attr_metadata_by_descriptor(
+        _In_ sai_object_type_t objecttype,
+        _In_ const sai_attr_descriptor_t *descriptor)
+{
+    const sai_object_type_info_t* oi = sai_metadata_get_object_type_info(objecttype);
+
+    if (oi == NULL || descriptor == NULL || oi->attrdescriptors == NULL ||
+            descriptor < oi->attrdescriptors || descriptor >= oi->attrdescriptors + oi->attrmetadatalength)
+    {
+        return NULL;
+    }
+
+    return oi->attrmetadata[descriptor - oi->attrdescriptors];
+}
+
+/*
+ * Attribute id names are looked up using perfect hash generated by parse.pl
+ * (CreateAttrIdNameHash), hash function must be the same as in parse.pl.
+ *
+ * Attribute id names contain only [A-Z0-9_] characters (enforced by parse.pl),
+ * so hash is computed up to first character outside that set. Returned
+ * candidate must be compared with requested name, since name not present in
+ * metadata will be hashed into some slot as well.
+ */
+static const sai_attr_metadata_t* sai_metadata_attr_id_name_hash_lookup(
+        _In_ const char *attr_id_name,
+        _Out_ size_t *len)
+{
+    uint32_t hash = 0x811c9dc5;
+
+    const char *c = attr_id_name;
+
+    for (; (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9') || *c == '_'; c++)
+    {
+        hash ^= (uint32_t)(uint8_t)*c;
+        hash *= 0x01000193;
+    }
+
+    *len = (size_t)(c - attr_id_name);
+
+    uint32_t bucket = (hash >> 16) & (uint32_t)(sai_metadata_attr_id_name_hash_displacement_count - 1);
+
+    uint32_t slot = ((hash * sai_metadata_attr_id_name_hash_seed) >> 16) & (uint32_t)(sai_metadata_attr_id_name_hash_index_count - 1);
+
+    slot ^= sai_metadata_attr_id_name_hash_displacement[bucket];
+
+    /* empty slots point to NULL guard */
+
+    const sai_attr_metadata_t* md = sai_metadata_attr_sorted_by_id_name[sai_metadata_attr_id_name_hash_index[slot]];
+
+    if (md != NULL && strncmp(md->attridname, attr_id_name, *len) == 0 && md->attridname[*len] == 0)
+    {
+        return md;
+    }
+
     return NULL;
 }
 
@@ -120,31 +315,13 @@ const sai_attr_metadata_t* sai_metadata_get_attr_metadata_by_attr_id_name(
         return NULL;
     }
 
-    /* use binary search */
+    size_t len;
 
-    ssize_t first = 0;
-    ssize_t last = (ssize_t)(sai_metadata_attr_sorted_by_id_name_count - 1);
+    const sai_attr_metadata_t* md = sai_metadata_attr_id_name_hash_lookup(attr_id_name, &len);
 
-    while (first <= last)
+    if (md != NULL && attr_id_name[len] == 0)
     {
-        ssize_t middle = (first + last) / 2;
-
-        int res = strcmp(attr_id_name, sai_metadata_attr_sorted_by_id_name[middle]->attridname);
-
-        if (res > 0)
-        {
-            first = middle + 1;
-        }
-        else if (res < 0)
-        {
-            last = middle - 1;
-        }
-        else
-        {
-            /* found */
-
-            return sai_metadata_attr_sorted_by_id_name[middle];
-        }
+        return md;
     }
 
     /* not found */
@@ -152,36 +329,29 @@ const sai_attr_metadata_t* sai_metadata_get_attr_metadata_by_attr_id_name(
     return NULL;
 }
 
-static int sai_metadata_attr_id_name_cmp(
-        _In_ const char * str1,
-        _In_ const char * str2)
+const sai_attr_metadata_t* sai_metadata_get_attr_metadata_by_attr_id_name_ext(
+        _In_ const char *attr_id_name)
 {
-    char c1 = 0;
-    char c2 = 0;
-
-    while (true)
+    if (attr_id_name == NULL)
     {
-        c1 = *str1++;
-        c2 = *str2++;
+        return NULL;
+    }
 
-        if (sai_serialize_is_char_allowed(c1) || sai_serialize_is_char_allowed(c2) || c1 != c2)
-        {
-            if (sai_serialize_is_char_allowed(c1))
-            {
-                c1 = 0;
-            }
+    size_t len;
 
-            if (sai_serialize_is_char_allowed(c2))
-            {
-                c2 = 0;
-            }
+    const sai_attr_metadata_t* md = sai_metadata_attr_id_name_hash_lookup(attr_id_name, &len);
 
-            return c1 - c2;
-        }
+    if (md != NULL && sai_serialize_is_char_allowed(attr_id_name[len]))
+    {
+        return md;
     }
+
+    /* not found */
+
+    return NULL;
 }
 
-const sai_attr_metadata_t* sai_metadata_get_attr_metadata_by_attr_id_name_ext(
+const sai_attr_metadata_t* sai_metadata_get_ignored_attr_metadata_by_attr_id_name(
         _In_ const char *attr_id_name)
 {
     if (attr_id_name == NULL)
@@ -192,13 +362,13 @@ const sai_attr_metadata_t* sai_metadata_get_attr_metadata_by_attr_id_name_ext(
     /* use binary search */
 
     ssize_t first = 0;
-    ssize_t last = (ssize_t)(sai_metadata_attr_sorted_by_id_name_count - 1);
+    ssize_t last = (ssize_t)sai_metadata_ignored_attr_sorted_by_id_name_count - 1;
 
     while (first <= last)
     {
         ssize_t middle = (first + last) / 2;
 
-        int res = sai_metadata_attr_id_name_cmp(attr_id_name, sai_metadata_attr_sorted_by_id_name[middle]->attridname);
+        int res = strcmp(attr_id_name, sai_metadata_ignored_attr_sorted_by_id_name[middle]);
 
         if (res > 0)
         {
@@ -212,7 +382,7 @@ const sai_attr_metadata_t* sai_metadata_get_attr_metadata_by_attr_id_name_ext(
         {
             /* found */
 
-            return sai_metadata_attr_sorted_by_id_name[middle];
+            return sai_metadata_ignored_attr_replacement[middle];
         }
     }
 
@@ -221,86 +391,88 @@ const sai_attr_metadata_t* sai_metadata_get_attr_metadata_by_attr_id_name_ext(
     return NULL;
 }
 
-const sai_attr_metadata_t* sai_metadata_get_ignored_attr_metadata_by_attr_id_name(
-        _In_ const char *attr_id_name)
+static ssize_t sai_metadata_get_enum_value_index(
+        _In_ const sai_enum_metadata_t* metadata,
+        _In_ int value)
 {
-    if (attr_id_name == NULL)
+    if (metadata == NULL || metadata->valuescount == 0)
     {
-        return NULL;
+        return -1;
     }
 
-    int idx = 1;
-
     /*
-     * Since we don't have list of ignored attributes, enumerate all objects
-     * and attribute enums to find ignored values.
+     * Enum values are strictly increasing, except sai_status_t which values
+     * are strictly decreasing (this is enforced by sanity check). Most of the
+     * enums are also contiguous, so distance from first value can be used as
+     * direct index to values array. For sparse enums like flags, or enums
+     * with custom ranges, binary search is performed.
      */
 
-    for (; sai_metadata_all_object_type_infos[idx]; idx++)
-    {
-        const sai_enum_metadata_t* em = sai_metadata_all_object_type_infos[idx]->enummetadata;
+    const int* values = metadata->values;
 
-        if (em->ignorevaluesnames)
-        {
-            size_t i;
+    ssize_t first = 0;
+    ssize_t last = (ssize_t)metadata->valuescount - 1;
 
-            for (i = 0; em->ignorevaluesnames[i] != NULL; i++)
-            {
-                if (strcmp(attr_id_name, em->ignorevaluesnames[i]) == 0)
-                {
-                    const char* name = sai_metadata_get_enum_value_name(em, em->ignorevalues[i]);
+    bool ascending = values[first] <= values[last];
 
-                    return sai_metadata_get_attr_metadata_by_attr_id_name(name);
-                }
-            }
-        }
+    if (ascending ? (value < values[first] || value > values[last])
+                  : (value > values[first] || value < values[last]))
+    {
+        return -1;
     }
 
-    return NULL;
-}
+    int64_t offset = ascending ? (int64_t)value - values[first] : (int64_t)values[first] - value;
 
-const char* sai_metadata_get_enum_value_name(
-        _In_ const sai_enum_metadata_t* metadata,
-        _In_ int value)
-{
-    if (metadata == NULL)
+    if (offset <= last)
     {
-        return NULL;
-    }
+        if (values[offset] == value)
+        {
+            return (ssize_t)offset;
+        }
 
-    size_t i = 0;
+        /* values are strictly monotonic, so value can't be after offset */
+
+        last = (ssize_t)offset;
+    }
 
-    for (; i < metadata->valuescount; ++i)
+    while (first <= last)
     {
-        if (metadata->values[i] == value)
+        ssize_t middle = (first + last) / 2;
+
+        if (values[middle] == value)
+        {
+            return middle;
+        }
+
+        if ((values[middle] < value) == ascending)
+        {
+            first = middle + 1;
+        }
+        else
         {
-            return metadata->valuesnames[i];
+            last = middle - 1;
         }
     }
 
-    return NULL;
+    return -1;
 }
 
-const char* sai_metadata_get_enum_value_short_name(
+const char* sai_metadata_get_enum_value_name(
         _In_ const sai_enum_metadata_t* metadata,
         _In_ int value)
 {
-    if (metadata == NULL)
-    {
-        return NULL;
-    }
+    ssize_t idx = sai_metadata_get_enum_value_index(metadata, value);
 
-    size_t i = 0;
+    return (idx < 0) ? NULL : metadata->valuesnames[idx];
+}
 
-    for (; i < metadata->valuescount; ++i)
-    {
-        if (metadata->values[i] == value)
-        {
-            return metadata->valuesshortnames[i];
-        }
-    }
+const char* sai_metadata_get_enum_value_short_name(
+        _In_ const sai_enum_metadata_t* metadata,
+        _In_ int value)
+{
+    ssize_t idx = sai_metadata_get_enum_value_index(metadata, value);
 
-    return NULL;
+    return (idx < 0) ? NULL : metadata->valuesshortnames[idx];
 }
 
 const sai_attribute_t* sai_metadata_get_attr_by_id(
@@ -366,38 +538,463 @@ bool sai_metadata_is_object_type_valid(
     return sai_metadata_get_object_type_info(object_type) != NULL;
 }
 
-static bool sai_metadata_is_condition_value_eq(
-        _In_ sai_attr_value_type_t attrvaluetype,
-        _In_ const sai_attribute_value_t* cvalue,
-        _In_ const sai_attribute_value_t* value)
+const sai_rev_graph_member_t* const* sai_metadata_get_rev_graph_members(
+        _In_ sai_object_type_t object_type,
+        _In_ sai_object_type_t dep_object_type,
+        _Out_ size_t *count)
 {
-    if (cvalue == NULL || value == NULL)
+    *count = 0;
+
+    const sai_object_type_info_t* oti = sai_metadata_get_object_type_info(object_type);
+
+    if (oti == NULL || oti->revgraphindex == NULL)
     {
-        return false;
+        return NULL;
     }
 
-    switch (attrvaluetype)
-    {
-        case SAI_ATTR_VALUE_TYPE_BOOL:
-            return cvalue->booldata == value->booldata;
+    /* index is sorted by dependency object type */
 
-        case SAI_ATTR_VALUE_TYPE_INT8:
-            return cvalue->s8 == value->s8;
+    size_t low = 0;
+    size_t high = oti->revgraphindexcount;
 
-        case SAI_ATTR_VALUE_TYPE_INT16:
-            return cvalue->s16 == value->s16;
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
 
-        case SAI_ATTR_VALUE_TYPE_INT32:
-            return cvalue->s32 == value->s32;
+        const sai_rev_graph_index_t* ri = &oti->revgraphindex[mid];
 
-        case SAI_ATTR_VALUE_TYPE_INT64:
-            return cvalue->s64 == value->s64;
+        if (ri->depobjecttype == dep_object_type)
+        {
+            *count = ri->count;
 
-        case SAI_ATTR_VALUE_TYPE_UINT8:
-            return cvalue->u8 == value->u8;
+            return &oti->revgraphmembers[ri->index];
+        }
 
-        case SAI_ATTR_VALUE_TYPE_UINT16:
-            return cvalue->u16 == value->u16;
+        if (ri->depobjecttype < dep_object_type)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return NULL;
+}
+
+int sai_metadata_get_object_type_rank(
+        _In_ sai_object_type_t object_type)
+{
+    const sai_object_type_info_t* oti = sai_metadata_get_object_type_info(object_type);
+
+    if (oti == NULL)
+    {
+        return -1;
+    }
+
+    return (int)oti->rank;
+}
+
+sai_status_t sai_metadata_sort_by_object_type_rank(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_type_t *object_type,
+        _In_ bool reverse,
+        _Out_ size_t *order,
+        _Out_ size_t *wave,
+        _Out_ size_t *wave_count)
+{
+    *wave_count = 0;
+
+    /* bucket start positions, counting sort keeps operations order within rank */
+
+    size_t start[SAI_METADATA_MAX_OBJECT_TYPE_RANK + 2] = { 0 };
+
+    sai_object_type_t last_object_type = SAI_OBJECT_TYPE_NULL;
+
+    int rank = -1;
+
+    uint32_t idx = 0;
+
+    for (; idx < object_count; idx++)
+    {
+        /* batches usually contain runs of the same object type */
+
+        if (rank < 0 || object_type[idx] != last_object_type)
+        {
+            last_object_type = object_type[idx];
+
+            rank = sai_metadata_get_object_type_rank(last_object_type);
+
+            if (rank < 0)
+            {
+                return SAI_STATUS_INVALID_OBJECT_TYPE;
+            }
+        }
+
+        /* wave is used as temporary rank storage */
+
+        wave[idx] = reverse ? (size_t)(SAI_METADATA_MAX_OBJECT_TYPE_RANK - rank) : (size_t)rank;
+
+        start[wave[idx] + 1]++;
+    }
+
+    size_t r = 0;
+
+    for (; r <= SAI_METADATA_MAX_OBJECT_TYPE_RANK; r++)
+    {
+        start[r + 1] += start[r];
+    }
+
+    size_t next[SAI_METADATA_MAX_OBJECT_TYPE_RANK + 1];
+
+    memcpy(next, start, sizeof(next));
+
+    for (idx = 0; idx < object_count; idx++)
+    {
+        order[next[wave[idx]]++] = idx;
+    }
+
+    for (r = 0; r <= SAI_METADATA_MAX_OBJECT_TYPE_RANK; r++)
+    {
+        if (start[r] == start[r + 1])
+        {
+            continue;
+        }
+
+        size_t pos = start[r];
+
+        for (; pos < start[r + 1]; pos++)
+        {
+            wave[pos] = *wave_count;
+        }
+
+        (*wave_count)++;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t sai_metadata_mixed_bulk_execute(
+        _In_ const sai_apis_t *apis,
+        _In_ sai_common_api_t api,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _Inout_ sai_object_meta_key_t *meta_key,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ const sai_attribute_t *attr,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    sai_status_t status = SAI_STATUS_NOT_SUPPORTED;
+
+    switch (api)
+    {
+        case SAI_COMMON_API_CREATE:
+            status = sai_metadata_generic_bulk_create(apis, switch_id, object_count, meta_key, attr_count, attr_list, mode, object_statuses);
+            break;
+
+        case SAI_COMMON_API_REMOVE:
+            status = sai_metadata_generic_bulk_remove(apis, object_count, meta_key, mode, object_statuses);
+            break;
+
+        case SAI_COMMON_API_SET:
+            status = sai_metadata_generic_bulk_set(apis, object_count, meta_key, attr, mode, object_statuses);
+            break;
+
+        default:
+            return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    if (status != SAI_STATUS_NOT_SUPPORTED && status != SAI_STATUS_NOT_IMPLEMENTED)
+    {
+        return status;
+    }
+
+    /* no native bulk api for this object type, fall back to generic quad api */
+
+    status = SAI_STATUS_SUCCESS;
+
+    uint32_t idx = 0;
+
+    for (; idx < object_count; idx++)
+    {
+        switch (api)
+        {
+            case SAI_COMMON_API_CREATE:
+                object_statuses[idx] = sai_metadata_generic_create(apis, &meta_key[idx], switch_id, attr_count[idx], attr_list[idx]);
+                break;
+
+            case SAI_COMMON_API_REMOVE:
+                object_statuses[idx] = sai_metadata_generic_remove(apis, &meta_key[idx]);
+                break;
+
+            default:
+                object_statuses[idx] = sai_metadata_generic_set(apis, &meta_key[idx], &attr[idx]);
+                break;
+        }
+
+        if (object_statuses[idx] == SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        status = SAI_STATUS_FAILURE;
+
+        if (mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+        {
+            for (idx++; idx < object_count; idx++)
+            {
+                object_statuses[idx] = SAI_STATUS_NOT_EXECUTED;
+            }
+
+            break;
+        }
+    }
+
+    return status;
+}
+
+static sai_status_t sai_metadata_mixed_bulk(
+        _In_ const sai_apis_t *apis,
+        _In_ sai_common_api_t api,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_meta_key_t *meta_key,
+        _Out_ sai_object_meta_key_t *created_meta_key,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ const sai_attribute_t *attr,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    uint32_t idx = 0;
+
+    for (; idx < object_count; idx++)
+    {
+        object_statuses[idx] = SAI_STATUS_NOT_EXECUTED;
+    }
+
+    if (object_count == 0)
+    {
+        return SAI_STATUS_SUCCESS;
+    }
+
+    /*
+     * Per object buffers: object types, execution order, waves and single
+     * object type group copied from caller arrays into continuous arrays.
+     */
+
+    sai_object_type_t* object_type = calloc(object_count, sizeof(sai_object_type_t));
+    size_t* order = calloc(object_count, sizeof(size_t));
+    size_t* wave = calloc(object_count, sizeof(size_t));
+    size_t* group = calloc(object_count, sizeof(size_t));
+    sai_object_meta_key_t* group_meta_key = calloc(object_count, sizeof(sai_object_meta_key_t));
+    uint32_t* group_attr_count = calloc(object_count, sizeof(uint32_t));
+    const sai_attribute_t** group_attr_list = calloc(object_count, sizeof(sai_attribute_t*));
+    sai_attribute_t* group_attr = calloc(object_count, sizeof(sai_attribute_t));
+    sai_status_t* group_statuses = calloc(object_count, sizeof(sai_status_t));
+
+    sai_status_t status = SAI_STATUS_NO_MEMORY;
+
+    if (object_type == NULL || order == NULL || wave == NULL || group == NULL || group_meta_key == NULL ||
+            group_attr_count == NULL || group_attr_list == NULL || group_attr == NULL || group_statuses == NULL)
+    {
+        goto cleanup;
+    }
+
+    for (idx = 0; idx < object_count; idx++)
+    {
+        object_type[idx] = meta_key[idx].objecttype;
+    }
+
+    size_t wave_count = 0;
+
+    status = sai_metadata_sort_by_object_type_rank(object_count, object_type, api == SAI_COMMON_API_REMOVE, order, wave, &wave_count);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        goto cleanup;
+    }
+
+    bool stop = false;
+
+    size_t start = 0;
+
+    while (start < object_count && !stop)
+    {
+        size_t wave_end = start;
+
+        while (wave_end < object_count && wave[wave_end] == wave[start])
+        {
+            wave_end++;
+        }
+
+        size_t end = wave_end;
+
+        while (start < end && !stop)
+        {
+            /*
+             * Move objects of object type of first object in wave to group,
+             * and compact remaining objects, both keeping original order.
+             */
+
+            sai_object_type_t ot = object_type[order[start]];
+
+            uint32_t count = 0;
+
+            size_t pos = start;
+            size_t rest = start;
+
+            for (; pos < end; pos++)
+            {
+                if (object_type[order[pos]] == ot)
+                {
+                    group[count++] = order[pos];
+                }
+                else
+                {
+                    order[rest++] = order[pos];
+                }
+            }
+
+            end = rest;
+
+            for (idx = 0; idx < count; idx++)
+            {
+                group_meta_key[idx] = meta_key[group[idx]];
+
+                if (api == SAI_COMMON_API_CREATE)
+                {
+                    group_attr_count[idx] = attr_count[group[idx]];
+                    group_attr_list[idx] = attr_list[group[idx]];
+                }
+                else if (api == SAI_COMMON_API_SET)
+                {
+                    group_attr[idx] = attr[group[idx]];
+                }
+
+                /* execute can return early, don't leak statuses of previous group */
+
+                group_statuses[idx] = SAI_STATUS_NOT_EXECUTED;
+            }
+
+            sai_status_t group_status = sai_metadata_mixed_bulk_execute(apis, api, switch_id, count,
+                    group_meta_key, group_attr_count, group_attr_list, group_attr, mode, group_statuses);
+
+            for (idx = 0; idx < count; idx++)
+            {
+                /* whole group failed, for example on missing api or invalid object type */
+
+                if (group_status != SAI_STATUS_SUCCESS && group_status != SAI_STATUS_FAILURE)
+                {
+                    group_statuses[idx] = group_status;
+                }
+
+                object_statuses[group[idx]] = group_statuses[idx];
+
+                if (created_meta_key != NULL)
+                {
+                    created_meta_key[group[idx]] = group_meta_key[idx];
+                }
+            }
+
+            if (group_status != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+
+                stop = (mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR);
+            }
+        }
+
+        start = wave_end;
+    }
+
+cleanup:
+
+    free(object_type);
+    free(order);
+    free(wave);
+    free(group);
+    free(group_meta_key);
+    free(group_attr_count);
+    free(group_attr_list);
+    free(group_attr);
+    free(group_statuses);
+
+    return status;
+}
+
+sai_status_t sai_metadata_mixed_bulk_create(
+        _In_ const sai_apis_t *apis,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _Inout_ sai_object_meta_key_t *meta_key,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_metadata_mixed_bulk(apis, SAI_COMMON_API_CREATE, switch_id, object_count, meta_key, meta_key,
+            attr_count, attr_list, NULL, mode, object_statuses);
+}
+
+sai_status_t sai_metadata_mixed_bulk_remove(
+        _In_ const sai_apis_t *apis,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_meta_key_t *meta_key,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_metadata_mixed_bulk(apis, SAI_COMMON_API_REMOVE, SAI_NULL_OBJECT_ID, object_count, meta_key, NULL,
+            NULL, NULL, NULL, mode, object_statuses);
+}
+
+sai_status_t sai_metadata_mixed_bulk_set(
+        _In_ const sai_apis_t *apis,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_meta_key_t *meta_key,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_metadata_mixed_bulk(apis, SAI_COMMON_API_SET, SAI_NULL_OBJECT_ID, object_count, meta_key, NULL,
+            NULL, NULL, attr_list, mode, object_statuses);
+}
+
+static bool sai_metadata_is_condition_value_eq(
+        _In_ sai_attr_value_type_t attrvaluetype,
+        _In_ const sai_attribute_value_t* cvalue,
+        _In_ const sai_attribute_value_t* value)
+{
+    if (cvalue == NULL || value == NULL)
+    {
+        return false;
+    }
+
+    switch (attrvaluetype)
+    {
+        case SAI_ATTR_VALUE_TYPE_BOOL:
+            return cvalue->booldata == value->booldata;
+
+        case SAI_ATTR_VALUE_TYPE_INT8:
+            return cvalue->s8 == value->s8;
+
+        case SAI_ATTR_VALUE_TYPE_INT16:
+            return cvalue->s16 == value->s16;
+
+        case SAI_ATTR_VALUE_TYPE_INT32:
+            return cvalue->s32 == value->s32;
+
+        case SAI_ATTR_VALUE_TYPE_INT64:
+            return cvalue->s64 == value->s64;
+
+        case SAI_ATTR_VALUE_TYPE_UINT8:
+            return cvalue->u8 == value->u8;
+
+        case SAI_ATTR_VALUE_TYPE_UINT16:
+            return cvalue->u16 == value->u16;
 
         case SAI_ATTR_VALUE_TYPE_UINT32:
             return cvalue->u32 == value->u32;
@@ -418,44 +1015,69 @@ static bool sai_metadata_is_condition_value_eq(
     }
 }
 
-static bool sai_metadata_is_single_condition_met(
-        _In_ sai_object_type_t objecttype,
-        _In_ const sai_attr_condition_t *condition,
+static void sai_metadata_collect_condition_values(
+        _In_ const sai_object_type_info_t *oi,
         _In_ uint32_t attr_count,
-        _In_ const sai_attribute_t *attr_list)
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ const sai_attribute_value_t **values)
 {
+    size_t idx = 0;
+
     /*
-     * Conditions may only be on the same object type.
-     *
-     * Default value may not exists if conditional object is marked as
+     * User may not pass conditional attribute, so start from default values.
+     * Default value may not exists if conditional attribute is marked as
      * MANDATORY_ON_CREATE.
      */
 
-    const sai_attr_metadata_t *cmd = sai_metadata_get_attr_metadata(objecttype, condition->attrid);
-
-    const sai_attribute_t *cattr = sai_metadata_get_attr_by_id(condition->attrid, attr_count, attr_list);
-
-    if (cattr == NULL)
+    for (; idx < oi->conditionattrscount; idx++)
     {
-        /*
-         * User didn't passed conditional attribute, so check if there is
-         * default value.
-         */
+        values[idx] = oi->conditionattrs[idx]->defaultvalue;
+    }
 
-        return sai_metadata_is_condition_value_eq(cmd->attrvaluetype, &condition->condition, cmd->defaultvalue);
+    if (attr_list == NULL || oi->conditionattrscount == 0)
+    {
+        return;
     }
-    else
+
+    /*
+     * Walk list backwards, so when multiple attributes with the same id are
+     * passed, first one wins, same as sai_metadata_get_attr_by_id.
+     */
+
+    while (attr_count--)
     {
-        return sai_metadata_is_condition_value_eq(cmd->attrvaluetype, &condition->condition, &cattr->value);
+        sai_attr_id_t id = attr_list[attr_count].id;
+
+        for (idx = 0; idx < oi->conditionattrscount; idx++)
+        {
+            if (oi->conditionattrs[idx]->attrid == id)
+            {
+                values[idx] = &attr_list[attr_count].value;
+                break;
+            }
+        }
     }
 }
 
+static bool sai_metadata_is_single_condition_met(
+        _In_ const sai_object_type_info_t *oi,
+        _In_ const sai_attr_condition_t *condition,
+        _In_ const sai_attribute_value_t* const *values)
+{
+    /*
+     * Conditions may only be on the same object type.
+     */
+
+    const sai_attr_metadata_t *cmd = oi->conditionattrs[condition->attrindex];
+
+    return sai_metadata_is_condition_value_eq(cmd->attrvaluetype, &condition->condition, values[condition->attrindex]);
+}
+
 static bool sai_metadata_is_and_condition_list_met(
-        _In_ const sai_attr_metadata_t *md,
+        _In_ const sai_object_type_info_t *oi,
         _In_ size_t length,
         _In_ const sai_attr_condition_t* const* list,
-        _In_ uint32_t attr_count,
-        _In_ const sai_attribute_t *attr_list)
+        _In_ const sai_attribute_value_t* const *values)
 {
     size_t idx = 0;
 
@@ -465,18 +1087,17 @@ static bool sai_metadata_is_and_condition_list_met(
     {
         const sai_attr_condition_t *condition = list[idx];
 
-        met &= sai_metadata_is_single_condition_met(md->objecttype, condition, attr_count, attr_list);
+        met &= sai_metadata_is_single_condition_met(oi, condition, values);
     }
 
     return met;
 }
 
 static bool sai_metadata_is_or_condition_list_met(
-        _In_ const sai_attr_metadata_t *md,
+        _In_ const sai_object_type_info_t *oi,
         _In_ size_t length,
         _In_ const sai_attr_condition_t* const* list,
-        _In_ uint32_t attr_count,
-        _In_ const sai_attribute_t *attr_list)
+        _In_ const sai_attribute_value_t* const *values)
 {
     size_t idx = 0;
 
@@ -486,7 +1107,7 @@ static bool sai_metadata_is_or_condition_list_met(
     {
         const sai_attr_condition_t *condition = list[idx];
 
-        met |= sai_metadata_is_single_condition_met(md->objecttype, condition, attr_count, attr_list);
+        met |= sai_metadata_is_single_condition_met(oi, condition, values);
     }
 
     return met;
@@ -497,10 +1118,10 @@ static bool sai_metadata_is_or_condition_list_met(
 
 static bool sai_metadata_is_mixed_condition_list_met(
         _In_ const sai_attr_metadata_t *md,
+        _In_ const sai_object_type_info_t *oi,
         _In_ size_t length,
         _In_ const sai_attr_condition_t* const* list,
-        _In_ uint32_t attr_count,
-        _In_ const sai_attribute_t *attr_list)
+        _In_ const sai_attribute_value_t* const *values)
 {
     int stack_size = 0;
 
@@ -514,7 +1135,7 @@ static bool sai_metadata_is_mixed_condition_list_met(
 
         if (c->type == SAI_ATTR_CONDITION_TYPE_NONE)
         {
-            bool value = sai_metadata_is_single_condition_met(md->objecttype, c, attr_count, attr_list);
+            bool value = sai_metadata_is_single_condition_met(oi, c, values);
 
             STACK_PUSH(value);
         }
@@ -550,6 +1171,31 @@ static bool sai_metadata_is_mixed_condition_list_met(
     return value;
 }
 
+static bool sai_metadata_is_condition_list_met(
+        _In_ const sai_attr_metadata_t *md,
+        _In_ const sai_object_type_info_t *oi,
+        _In_ sai_attr_condition_type_t type,
+        _In_ size_t length,
+        _In_ const sai_attr_condition_t* const* list,
+        _In_ const sai_attribute_value_t* const *values)
+{
+    switch (type)
+    {
+        case SAI_ATTR_CONDITION_TYPE_AND:
+            return sai_metadata_is_and_condition_list_met(oi, length, list, values);
+
+        case SAI_ATTR_CONDITION_TYPE_OR:
+            return sai_metadata_is_or_condition_list_met(oi, length, list, values);
+
+        case SAI_ATTR_CONDITION_TYPE_MIXED:
+            return sai_metadata_is_mixed_condition_list_met(md, oi, length, list, values);
+
+        default:
+            SAI_META_LOG_ERROR("condition type %d on %s is not supported yet, FIXME", type, md->attridname);
+            return false;
+    }
+}
+
 bool sai_metadata_is_condition_met(
         _In_ const sai_attr_metadata_t *md,
         _In_ uint32_t attr_count,
@@ -562,21 +1208,13 @@ bool sai_metadata_is_condition_met(
         return false;
     }
 
-    switch (md->conditiontype)
-    {
-        case SAI_ATTR_CONDITION_TYPE_AND:
-            return sai_metadata_is_and_condition_list_met(md, md->conditionslength, md->conditions, attr_count, attr_list);
+    const sai_object_type_info_t *oi = sai_metadata_get_object_type_info(md->objecttype);
 
-        case SAI_ATTR_CONDITION_TYPE_OR:
-            return sai_metadata_is_or_condition_list_met(md, md->conditionslength, md->conditions, attr_count, attr_list);
+    const sai_attribute_value_t *values[SAI_METADATA_MAX_CONDITION_ATTRS];
 
-        case SAI_ATTR_CONDITION_TYPE_MIXED:
-            return sai_metadata_is_mixed_condition_list_met(md, md->conditionslength, md->conditions, attr_count, attr_list);
+    sai_metadata_collect_condition_values(oi, attr_count, attr_list, values);
 
-        default:
-            SAI_META_LOG_ERROR("condition type %d on %s is not supported yet, FIXME", md->conditiontype, md->attridname);
-            return false;
-    }
+    return sai_metadata_is_condition_list_met(md, oi, md->conditiontype, md->conditionslength, md->conditions, values);
 }
 
 bool sai_metadata_is_validonly_met(
@@ -591,23 +1229,349 @@ bool sai_metadata_is_validonly_met(
         return false;
     }
 
-    switch (md->validonlytype)
+    const sai_object_type_info_t *oi = sai_metadata_get_object_type_info(md->objecttype);
+
+    const sai_attribute_value_t *values[SAI_METADATA_MAX_CONDITION_ATTRS];
+
+    sai_metadata_collect_condition_values(oi, attr_count, attr_list, values);
+
+    return sai_metadata_is_condition_list_met(md, oi, md->validonlytype, md->validonlylength, md->validonly, values);
+}
+
+bool sai_metadata_evaluate_conditions(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ bool *condition_met,
+        _Out_ bool *validonly_met)
+{
+    const sai_object_type_info_t *oi = sai_metadata_get_object_type_info(object_type);
+
+    if (oi == NULL || condition_met == NULL || validonly_met == NULL)
     {
-        case SAI_ATTR_CONDITION_TYPE_AND:
-            return sai_metadata_is_and_condition_list_met(md, md->validonlylength, md->validonly, attr_count, attr_list);
+        return false;
+    }
 
-        case SAI_ATTR_CONDITION_TYPE_OR:
-            return sai_metadata_is_or_condition_list_met(md, md->validonlylength, md->validonly, attr_count, attr_list);
+    const sai_attribute_value_t *values[SAI_METADATA_MAX_CONDITION_ATTRS];
 
-        case SAI_ATTR_CONDITION_TYPE_MIXED:
-            return sai_metadata_is_mixed_condition_list_met(md, md->validonlylength, md->validonly, attr_count, attr_list);
+    sai_metadata_collect_condition_values(oi, attr_count, attr_list, values);
 
-        default:
-            SAI_META_LOG_ERROR("validonly type %d on %s is not supported yet, FIXME", md->validonlytype, md->attridname);
-            return false;
+    size_t idx = 0;
+
+    for (; idx < oi->attrmetadatalength; idx++)
+    {
+        const sai_attr_descriptor_t *d = &oi->attrdescriptors[idx];
+
+        condition_met[idx] = false;
+        validonly_met[idx] = false;
+
+        /* attribute metadata is only needed for attributes with conditions */
+
+        if (SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_CONDITIONAL))
+        {
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            condition_met[idx] = sai_metadata_is_condition_list_met(md, oi, md->conditiontype, md->conditionslength, md->conditions, values);
+        }
+
+        if (SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_VALID_ONLY))
+        {
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            validonly_met[idx] = sai_metadata_is_condition_list_met(md, oi, md->validonlytype, md->validonlylength, md->validonly, values);
+        }
     }
 
-    return false;
+    return true;
+}
+
+#define ATTRS_MASK_WORD(idx) ((size_t)(idx) / 64)
+#define ATTRS_MASK_BIT(idx) (UINT64_C(1) << ((size_t)(idx) % 64))
+
+static sai_status_t sai_metadata_attr_index_status(
+        _In_ sai_status_t status,
+        _In_ uint32_t idx)
+{
+    /* status offset is attribute index on the list, limited by status range */
+
+    return status + (sai_status_t)(idx < 0xFFFF ? idx : 0xFFFF);
+}
+
+static sai_status_t sai_metadata_validate_attr_list(
+        _In_ const sai_object_type_info_t *oi,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ bool is_set,
+        _Out_ uint64_t *passed,
+        _Out_ sai_attr_id_t *err_attr_id)
+{
+    if (attr_count && attr_list == NULL)
+    {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    memset(passed, 0, oi->attrsmaskwords * sizeof(uint64_t));
+
+    uint32_t i = 0;
+
+    for (; i < attr_count; i++)
+    {
+        ssize_t idx = sai_metadata_get_attr_metadata_index(oi, attr_list[i].id);
+
+        if (idx < 0)
+        {
+            *err_attr_id = attr_list[i].id;
+
+            return sai_metadata_attr_index_status(SAI_STATUS_UNKNOWN_ATTRIBUTE_0, i);
+        }
+
+        size_t word = ATTRS_MASK_WORD(idx);
+        uint64_t bit = ATTRS_MASK_BIT(idx);
+
+        uint64_t forbidden = oi->readonlyattrsmask[word];
+
+        if (is_set)
+        {
+            forbidden |= oi->createonlyattrsmask[word];
+        }
+
+        if ((passed[word] | forbidden) & bit)
+        {
+            /* attribute is duplicated or not allowed in this operation */
+
+            *err_attr_id = attr_list[i].id;
+
+            return sai_metadata_attr_index_status(SAI_STATUS_INVALID_ATTRIBUTE_0, i);
+        }
+
+        passed[word] |= bit;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t sai_metadata_validate_create(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_attr_id_t *err_attr_id)
+{
+    const sai_object_type_info_t *oi = sai_metadata_get_object_type_info(object_type);
+
+    if (err_attr_id == NULL)
+    {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    *err_attr_id = SAI_INVALID_ATTRIBUTE_ID;
+
+    if (oi == NULL)
+    {
+        return SAI_STATUS_INVALID_OBJECT_TYPE;
+    }
+
+    uint64_t passed[SAI_METADATA_MAX_ATTRS_MASK_WORDS];
+
+    sai_status_t status = sai_metadata_validate_attr_list(oi, attr_count, attr_list, false, passed, err_attr_id);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    const sai_attribute_value_t *values[SAI_METADATA_MAX_CONDITION_ATTRS];
+
+    bool collected = false;
+
+    size_t word = 0;
+
+    for (; word < oi->attrsmaskwords; word++)
+    {
+        uint64_t missing = oi->mandatoryattrsmask[word] & ~passed[word];
+
+        size_t idx = word * 64;
+
+        for (; missing; missing >>= 1, idx++)
+        {
+            if ((missing & 1) == 0)
+            {
+                continue;
+            }
+
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            if (oi->conditionalattrsmask[word] & ATTRS_MASK_BIT(idx))
+            {
+                /* conditional attribute is mandatory only when condition is met */
+
+                if (!collected)
+                {
+                    sai_metadata_collect_condition_values(oi, attr_count, attr_list, values);
+
+                    collected = true;
+                }
+
+                if (!sai_metadata_is_condition_list_met(md, oi, md->conditiontype, md->conditionslength, md->conditions, values))
+                {
+                    continue;
+                }
+            }
+
+            *err_attr_id = md->attrid;
+
+            return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t sai_metadata_validate_set(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_attr_id_t *err_attr_id)
+{
+    const sai_object_type_info_t *oi = sai_metadata_get_object_type_info(object_type);
+
+    if (err_attr_id == NULL)
+    {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    *err_attr_id = SAI_INVALID_ATTRIBUTE_ID;
+
+    if (oi == NULL)
+    {
+        return SAI_STATUS_INVALID_OBJECT_TYPE;
+    }
+
+    uint64_t passed[SAI_METADATA_MAX_ATTRS_MASK_WORDS];
+
+    return sai_metadata_validate_attr_list(oi, attr_count, attr_list, true, passed, err_attr_id);
+}
+
+sai_status_t sai_metadata_attr_list_index_init(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ size_t slots_count,
+        _Out_ uint16_t *slots,
+        _Out_ sai_attr_list_index_t *index)
+{
+    const sai_object_type_info_t *oi = sai_metadata_get_object_type_info(object_type);
+
+    if (slots == NULL || index == NULL || (attr_count && attr_list == NULL) || attr_count >= 0xFFFF)
+    {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (oi == NULL)
+    {
+        return SAI_STATUS_INVALID_OBJECT_TYPE;
+    }
+
+    if (slots_count < oi->attrmetadatalength)
+    {
+        return SAI_STATUS_BUFFER_OVERFLOW;
+    }
+
+    memset(slots, 0, oi->attrmetadatalength * sizeof(uint16_t));
+
+    uint32_t i = 0;
+
+    for (; i < attr_count; i++)
+    {
+        ssize_t idx = sai_metadata_get_attr_metadata_index(oi, attr_list[i].id);
+
+        if (idx < 0)
+        {
+            return sai_metadata_attr_index_status(SAI_STATUS_UNKNOWN_ATTRIBUTE_0, i);
+        }
+
+        if (slots[idx] == 0)
+        {
+            slots[idx] = (uint16_t)(i + 1);
+        }
+    }
+
+    index->objecttypeinfo = oi;
+    index->attrcount = attr_count;
+    index->attrlist = attr_list;
+    index->slots = slots;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+const sai_attribute_t* sai_metadata_attr_list_index_get(
+        _In_ const sai_attr_list_index_t *index,
+        _In_ sai_attr_id_t id)
+{
+    if (index == NULL || index->objecttypeinfo == NULL)
+    {
+        return NULL;
+    }
+
+    ssize_t idx = sai_metadata_get_attr_metadata_index(index->objecttypeinfo, id);
+
+    if (idx < 0 || index->slots[idx] == 0)
+    {
+        return NULL;
+    }
+
+    return &index->attrlist[index->slots[idx] - 1];
+}
+
+static void sai_metadata_collect_condition_values_index(
+        _In_ const sai_attr_list_index_t *index,
+        _Out_ const sai_attribute_value_t **values)
+{
+    const sai_object_type_info_t *oi = index->objecttypeinfo;
+
+    size_t idx = 0;
+
+    for (; idx < oi->conditionattrscount; idx++)
+    {
+        const sai_attr_metadata_t *cmd = oi->conditionattrs[idx];
+
+        const sai_attribute_t *attr = sai_metadata_attr_list_index_get(index, cmd->attrid);
+
+        values[idx] = (attr == NULL) ? cmd->defaultvalue : &attr->value;
+    }
+}
+
+bool sai_metadata_is_condition_met_index(
+        _In_ const sai_attr_metadata_t *md,
+        _In_ const sai_attr_list_index_t *index)
+{
+    if (md == NULL || !md->isconditional || index == NULL || index->objecttypeinfo == NULL ||
+            index->objecttypeinfo->objecttype != md->objecttype)
+    {
+        return false;
+    }
+
+    const sai_attribute_value_t *values[SAI_METADATA_MAX_CONDITION_ATTRS];
+
+    sai_metadata_collect_condition_values_index(index, values);
+
+    return sai_metadata_is_condition_list_met(md, index->objecttypeinfo, md->conditiontype, md->conditionslength, md->conditions, values);
+}
+
+bool sai_metadata_is_validonly_met_index(
+        _In_ const sai_attr_metadata_t *md,
+        _In_ const sai_attr_list_index_t *index)
+{
+    if (md == NULL || !md->isvalidonly || index == NULL || index->objecttypeinfo == NULL ||
+            index->objecttypeinfo->objecttype != md->objecttype)
+    {
+        return false;
+    }
+
+    const sai_attribute_value_t *values[SAI_METADATA_MAX_CONDITION_ATTRS];
+
+    sai_metadata_collect_condition_values_index(index, values);
+
+    return sai_metadata_is_condition_list_met(md, index->objecttypeinfo, md->validonlytype, md->validonlylength, md->validonly, values);
 }
 
 sai_api_version_t sai_metadata_query_api_version(void)
@@ -57,6 +57,41 @@ extern bool sai_metadata_is_allowed_enum_value(
         _In_ const sai_attr_metadata_t *metadata,
         _In_ int value);
 
+/**
+ * @brief Validates enum list values
+ *
+ * All list items are checked in single pass, for contiguous enums only range
+ * of each item is checked.
+ *
+ * @param[in] metadata Attribute metadata
+ * @param[in] count Number of items on the list
+ * @param[in] list List of enum values to be checked
+ *
+ * @return True if all enum values are allowed on this attribute, false otherwise
+ */
+extern bool sai_metadata_validate_enum_list(
+        _In_ const sai_attr_metadata_t *metadata,
+        _In_ uint32_t count,
+        _In_ const int32_t *list);
+
+/**
+ * @brief Validates object list object types
+ *
+ * Object types of list items must be obtained by caller (for example using
+ * sai_object_type_query), and they are checked against allowed object types
+ * bit mask in single pass.
+ *
+ * @param[in] metadata Attribute metadata
+ * @param[in] count Number of items on the list
+ * @param[in] object_type_list Object types of object list items
+ *
+ * @return True if all object types are allowed on this attribute, false otherwise
+ */
+extern bool sai_metadata_validate_object_list(
+        _In_ const sai_attr_metadata_t *metadata,
+        _In_ uint32_t count,
+        _In_ const sai_object_type_t *object_type_list);
+
 /**
  * @brief Gets attribute metadata based on object type and attribute id
  *
@@ -69,6 +104,30 @@ extern const sai_attr_metadata_t* sai_metadata_get_attr_metadata(
         _In_ sai_object_type_t object_type,
         _In_ sai_attr_id_t attr_id);
 
+/**
+ * @brief Gets attribute descriptor based on object type and attribute id
+ *
+ * @param[in] object_type Object type
+ * @param[in] attr_id Attribute Id
+ *
+ * @return Pointer to attribute descriptor or NULL in case of failure
+ */
+extern const sai_attr_descriptor_t* sai_metadata_get_attr_descriptor(
+        _In_ sai_object_type_t object_type,
+        _In_ sai_attr_id_t attr_id);
+
+/**
+ * @brief Gets attribute metadata based on attribute descriptor
+ *
+ * @param[in] object_type Object type
+ * @param[in] descriptor Attribute descriptor of object type
+ *
+ * @return Pointer to attribute metadata or NULL in case of failure
+ */
+extern const sai_attr_metadata_t* sai_metadata_get_attr_metadata_by_descriptor(
+        _In_ sai_object_type_t object_type,
+        _In_ const sai_attr_descriptor_t *descriptor);
+
 /**
  * @brief Gets attribute metadata based on attribute id name
  *
@@ -171,6 +230,60 @@ extern bool sai_metadata_is_object_type_valid(
 extern bool sai_metadata_is_object_type_oid(
         _In_ sai_object_type_t object_type);
 
+/**
+ * @brief Gets reverse graph members of object type used by dependency object type.
+ *
+ * Members are attributes or non object id struct members of dependency
+ * object type on which object type can be used.
+ *
+ * @param[in] object_type Object type which is used.
+ * @param[in] dep_object_type Dependency object type.
+ * @param[out] count Number of members.
+ *
+ * @return Pointer to first member or NULL if object type is not used by
+ * dependency object type.
+ */
+extern const sai_rev_graph_member_t* const* sai_metadata_get_rev_graph_members(
+        _In_ sai_object_type_t object_type,
+        _In_ sai_object_type_t dep_object_type,
+        _Out_ size_t *count);
+
+/**
+ * @brief Gets dependency rank of object type.
+ *
+ * @param[in] object_type Object type.
+ *
+ * @return Rank of object type or -1 if object type is not valid.
+ */
+extern int sai_metadata_get_object_type_rank(
+        _In_ sai_object_type_t object_type);
+
+/**
+ * @brief Sorts batch of operations into dependency respecting waves.
+ *
+ * Operations are stable sorted by object type rank, ascending for create
+ * and descending for remove. Each wave contains operations of single rank,
+ * so all operations in wave can be executed in bulk once previous wave
+ * finished.
+ *
+ * @param[in] object_count Number of operations.
+ * @param[in] object_type Object type of each operation.
+ * @param[in] reverse Use descending rank order, used for remove.
+ * @param[out] order Operation indexes in execution order, object_count elements.
+ * @param[out] wave Wave of each element of order, object_count elements.
+ * @param[out] wave_count Number of waves.
+ *
+ * @return #SAI_STATUS_SUCCESS on success, #SAI_STATUS_INVALID_OBJECT_TYPE if
+ * any object type is not valid.
+ */
+extern sai_status_t sai_metadata_sort_by_object_type_rank(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_type_t *object_type,
+        _In_ bool reverse,
+        _Out_ size_t *order,
+        _Out_ size_t *wave,
+        _Out_ size_t *wave_count);
+
 /**
  * @brief Check if condition met.
  *
@@ -222,6 +335,157 @@ extern bool sai_metadata_is_validonly_met(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list);
 
+/**
+ * @brief Evaluates conditions and valid only conditions of all attributes.
+ *
+ * Attribute list is examined only once, values of all attributes referenced
+ * by conditions are collected and then all conditions of object type are
+ * evaluated against them. If condition attribute is not on the list, then
+ * default value will be examined.
+ *
+ * NOTE: When multiple attributes with the same ID are passed, only first one
+ * is selected, same as in sai_metadata_is_condition_met.
+ *
+ * @param[in] object_type Object type.
+ * @param[in] attr_count Number of attributes.
+ * @param[in] attr_list Attribute list to check. All attributes must
+ * belong to the same object type.
+ * @param[out] condition_met Array with item for each attribute of object
+ * type info, each item is set to result of sai_metadata_is_condition_met for
+ * attribute with the same index in object type info attribute metadata.
+ * @param[out] validonly_met Array with item for each attribute of object
+ * type info, each item is set to result of sai_metadata_is_validonly_met for
+ * attribute with the same index in object type info attribute metadata.
+ *
+ * @return True on success, false if object type is invalid or any of output
+ * pointers is NULL.
+ */
+extern bool sai_metadata_evaluate_conditions(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ bool *condition_met,
+        _Out_ bool *validonly_met);
+
+/**
+ * @brief Validates attribute list passed to create API.
+ *
+ * Attribute list is examined in single pass using object type attributes
+ * masks. Unknown, duplicated and read only attributes are reported, as well
+ * as missing mandatory attributes, conditional attributes are considered
+ * mandatory only when their condition is met.
+ *
+ * @param[in] object_type Object type.
+ * @param[in] attr_count Number of attributes.
+ * @param[in] attr_list Attribute list to check.
+ * @param[out] err_attr_id Id of attribute which caused failure, or
+ * #SAI_INVALID_ATTRIBUTE_ID if not attribute related.
+ *
+ * @return #SAI_STATUS_SUCCESS if attribute list is valid,
+ * #SAI_STATUS_UNKNOWN_ATTRIBUTE_0 or #SAI_STATUS_INVALID_ATTRIBUTE_0 plus
+ * index of failing attribute on the list, #SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING
+ * if mandatory attribute is missing, or failure status code on invalid input.
+ */
+extern sai_status_t sai_metadata_validate_create(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_attr_id_t *err_attr_id);
+
+/**
+ * @brief Validates attribute list passed to set API.
+ *
+ * Same as sai_metadata_validate_create, but create only attributes are
+ * also not allowed and mandatory attributes are not checked.
+ *
+ * @param[in] object_type Object type.
+ * @param[in] attr_count Number of attributes.
+ * @param[in] attr_list Attribute list to check.
+ * @param[out] err_attr_id Id of attribute which caused failure, or
+ * #SAI_INVALID_ATTRIBUTE_ID if not attribute related.
+ *
+ * @return #SAI_STATUS_SUCCESS if attribute list is valid,
+ * #SAI_STATUS_UNKNOWN_ATTRIBUTE_0 or #SAI_STATUS_INVALID_ATTRIBUTE_0 plus
+ * index of failing attribute on the list, or failure status code on invalid
+ * input.
+ */
+extern sai_status_t sai_metadata_validate_set(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _Out_ sai_attr_id_t *err_attr_id);
+
+/**
+ * @brief Builds attribute list index.
+ *
+ * Slots are indexed by attribute id for object types without flags
+ * attributes, custom and extensions range attributes are placed after them,
+ * same as in object type info attribute metadata. When multiple attributes
+ * with the same id are passed, only first one is indexed. Attribute list can
+ * have at most 0xFFFE attributes, same as attribute status codes range.
+ *
+ * @param[in] object_type Object type.
+ * @param[in] attr_count Number of attributes.
+ * @param[in] attr_list Attribute list to index, must be valid as long as
+ * index is used.
+ * @param[in] slots_count Number of slots, must be at least object type info
+ * attribute metadata length.
+ * @param[out] slots Slots storage, must be valid as long as index is used.
+ * @param[out] index Attribute list index.
+ *
+ * @return #SAI_STATUS_SUCCESS on success, #SAI_STATUS_UNKNOWN_ATTRIBUTE_0
+ * plus attribute position if attribute is not known for object type,
+ * #SAI_STATUS_BUFFER_OVERFLOW if there is not enough slots, or failure status
+ * code on invalid input.
+ */
+extern sai_status_t sai_metadata_attr_list_index_init(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list,
+        _In_ size_t slots_count,
+        _Out_ uint16_t *slots,
+        _Out_ sai_attr_list_index_t *index);
+
+/**
+ * @brief Gets attribute from indexed attribute list by attribute id.
+ *
+ * @param[in] index Attribute list index.
+ * @param[in] id Attribute id to be found.
+ *
+ * @return Attribute pointer with requested ID or NULL if not found.
+ */
+extern const sai_attribute_t* sai_metadata_attr_list_index_get(
+        _In_ const sai_attr_list_index_t *index,
+        _In_ sai_attr_id_t id);
+
+/**
+ * @brief Check if condition met using attribute list index.
+ *
+ * Same as sai_metadata_is_condition_met, but attribute list is not scanned.
+ *
+ * @param[in] metadata Metadata of attribute that we need to check.
+ * @param[in] index Attribute list index of the same object type as metadata.
+ *
+ * @return True if condition is in force, false otherwise.
+ */
+extern bool sai_metadata_is_condition_met_index(
+        _In_ const sai_attr_metadata_t *metadata,
+        _In_ const sai_attr_list_index_t *index);
+
+/**
+ * @brief Check if valid only condition is met using attribute list index.
+ *
+ * Same as sai_metadata_is_validonly_met, but attribute list is not scanned.
+ *
+ * @param[in] metadata Metadata of attribute that we need to check.
+ * @param[in] index Attribute list index of the same object type as metadata.
+ *
+ * @return True if valid only condition is in force, false otherwise.
+ */
+extern bool sai_metadata_is_validonly_met_index(
+        _In_ const sai_attr_metadata_t *metadata,
+        _In_ const sai_attr_list_index_t *index);
+
 /**
  * @brief Metadata query API version.
  *
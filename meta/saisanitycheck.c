@@ -352,6 +352,48 @@ void check_enums_ignore_values()
     }
 }
 
+void check_enums_names_sorted_index()
+{
+    META_LOG_ENTER();
+
+    size_t i = 0;
+
+    for (; i < sai_metadata_all_enums_count; ++i)
+    {
+        const sai_enum_metadata_t* emd = sai_metadata_all_enums[i];
+
+        META_LOG_DEBUG("enum: %s", emd->name);
+
+        META_ASSERT_NOT_NULL(emd->valuesnamessortedindex);
+
+        const char* last = NULL;
+
+        size_t j = 0;
+
+        for (; j < emd->valuescount; ++j)
+        {
+            int idx = emd->valuesnamessortedindex[j];
+
+            META_ASSERT_TRUE(idx >= 0 && (size_t)idx < emd->valuescount, "sorted index %d out of range in %s", idx, emd->name);
+
+            const char* name = emd->valuesnames[idx];
+
+            META_LOG_DEBUG(" value: %s", name);
+
+            /*
+             * Since names are strictly increasing, all indexes are different,
+             * so sorted index is permutation of values indexes.
+             */
+
+            META_ASSERT_TRUE(last == NULL || strcmp(last, name) < 0, "enum names are not sorted: %s %s", last, name);
+
+            last = name;
+        }
+
+        META_ASSERT_TRUE(emd->valuesnamessortedindex[j] == -1, "missing guard at the end of sorted index");
+    }
+}
+
 void check_sai_status()
 {
     META_LOG_ENTER();
@@ -4187,6 +4229,25 @@ void check_attr_sorted_by_id_name()
 
     META_ASSERT_NULL(sai_metadata_attr_sorted_by_id_name[i]);
 
+    /* check perfect hash, table sizes must be power of 2 */
+
+    size_t hcount = sai_metadata_attr_id_name_hash_index_count;
+    size_t dcount = sai_metadata_attr_id_name_hash_displacement_count;
+
+    META_ASSERT_TRUE(hcount > 0 && (hcount & (hcount - 1)) == 0, "hash index count must be power of 2");
+    META_ASSERT_TRUE(dcount > 0 && (dcount & (dcount - 1)) == 0, "hash displacement count must be power of 2");
+    META_ASSERT_TRUE(hcount >= sai_metadata_attr_sorted_by_id_name_count, "hash index count must be at least attributes count");
+
+    for (i = 0; i < hcount; ++i)
+    {
+        META_ASSERT_TRUE(sai_metadata_attr_id_name_hash_index[i] <= sai_metadata_attr_sorted_by_id_name_count, "hash index out of range");
+    }
+
+    for (i = 0; i < dcount; ++i)
+    {
+        META_ASSERT_TRUE(sai_metadata_attr_id_name_hash_displacement[i] < hcount, "hash displacement out of range");
+    }
+
     /* check search */
 
     for (i = 0; i < sai_metadata_attr_sorted_by_id_name_count; ++i)
@@ -4207,6 +4268,13 @@ void check_attr_sorted_by_id_name()
 
         META_ASSERT_TRUE(strcmp(found_ext->attridname, am->attridname) == 0, "search attr by id name ext failed to find");
 
+        char buf[256];
+
+        sprintf(buf, "%s\",", am->attridname);
+
+        META_ASSERT_TRUE(sai_metadata_get_attr_metadata_by_attr_id_name_ext(buf) == am, "search attr by id name ext with terminator failed");
+
+        META_ASSERT_NULL(sai_metadata_get_attr_metadata_by_attr_id_name(buf));
     }
 
     META_ASSERT_NULL(sai_metadata_get_attr_metadata_by_attr_id_name(NULL));     /* null pointer */
@@ -5691,6 +5759,39 @@ void check_attr_get_outside_range()
             }
         }
     }
+
+    /*
+     * Probe ids around each attribute, this will cover gaps between regular,
+     * custom and extensions ranges where lookup is using binary search.
+     */
+
+    size_t i = 1;
+
+    for (; sai_metadata_all_object_type_infos[i]; i++)
+    {
+        const sai_object_type_info_t* oti = sai_metadata_all_object_type_infos[i];
+
+        size_t index = 0;
+
+        for (; index < oti->attrmetadatalength; index++)
+        {
+            sai_attr_id_t attrid = oti->attrmetadata[index]->attrid;
+
+            sai_attr_id_t probe[] = { attrid - 1, attrid + 1, CUSTOM_ATTR_RANGE_START - 1, CUSTOM_ATTR_RANGE_START + 0x1000 };
+
+            size_t p = 0;
+
+            for (; p < sizeof(probe)/sizeof(probe[0]); p++)
+            {
+                const sai_attr_metadata_t* md = sai_metadata_get_attr_metadata(oti->objecttype, probe[p]);
+
+                if (md != NULL && md->attrid != probe[p])
+                {
+                    META_MD_ASSERT_FAIL(md, "attr %u expected to be %u", md->attrid, probe[p]);
+                }
+            }
+        }
+    }
 }
 
 void check_custom_range_attributes()
@@ -5837,6 +5938,60 @@ void check_ignored_attributes()
 
     META_ASSERT_TRUE(strcmp(meta->attridname, "SAI_BUFFER_PROFILE_ATTR_RESERVED_BUFFER_SIZE") == 0,
             "expected attribute was SAI_BUFFER_PROFILE_ATTR_RESERVED_BUFFER_SIZE");
+
+    /* check ignored attributes list against attribute enums */
+
+    size_t count = 0;
+
+    size_t idx = 1;
+
+    for (; sai_metadata_all_object_type_infos[idx]; idx++)
+    {
+        const sai_enum_metadata_t* em = sai_metadata_all_object_type_infos[idx]->enummetadata;
+
+        if (em->ignorevaluesnames == NULL)
+        {
+            continue;
+        }
+
+        size_t i = 0;
+
+        for (; em->ignorevaluesnames[i] != NULL; i++, count++)
+        {
+            const char* name = sai_metadata_get_enum_value_name(em, em->ignorevalues[i]);
+
+            META_ASSERT_NOT_NULL(name);
+
+            const sai_attr_metadata_t* md = sai_metadata_get_ignored_attr_metadata_by_attr_id_name(em->ignorevaluesnames[i]);
+
+            META_ASSERT_NOT_NULL(md);
+
+            META_ASSERT_TRUE(md == sai_metadata_get_attr_metadata_by_attr_id_name(name),
+                    "wrong replacement attribute of ignored attribute %s", em->ignorevaluesnames[i]);
+        }
+    }
+
+    META_ASSERT_TRUE(count == sai_metadata_ignored_attr_sorted_by_id_name_count, "ignored attributes count mismatch");
+
+    for (idx = 0; idx < sai_metadata_ignored_attr_sorted_by_id_name_count; idx++)
+    {
+        const char* name = sai_metadata_ignored_attr_sorted_by_id_name[idx];
+
+        META_ASSERT_NOT_NULL(name);
+        META_ASSERT_NOT_NULL(sai_metadata_ignored_attr_replacement[idx]);
+
+        META_ASSERT_NULL(sai_metadata_get_attr_metadata_by_attr_id_name(name));
+
+        if (idx > 0 && strcmp(sai_metadata_ignored_attr_sorted_by_id_name[idx - 1], name) >= 0)
+        {
+            META_ASSERT_FAIL("ignored attribute %s is not sorted alphabetical", name);
+        }
+    }
+
+    META_ASSERT_NULL(sai_metadata_ignored_attr_sorted_by_id_name[idx]);
+
+    META_ASSERT_NULL(sai_metadata_get_ignored_attr_metadata_by_attr_id_name(NULL));
+    META_ASSERT_NULL(sai_metadata_get_ignored_attr_metadata_by_attr_id_name("SAI_BUFFER_PROFILE_ATTR_RESERVED_BUFFER_SIZE"));
 }
 
 #define RANGE_BASE 0x1000
@@ -6358,6 +6513,857 @@ void check_api_extensions()
     META_ASSERT_TRUE(api == 0x20000000, "api should be correctly assigned");
 }
 
+void check_allowed_object_types_mask()
+{
+    META_LOG_ENTER();
+
+    META_ASSERT_TRUE(SAI_OBJECT_TYPE_MAX <= 64 * SAI_METADATA_OBJECT_TYPE_MASK_WORDS, "object type mask is too small");
+
+    size_t idx = 0;
+
+    for (; sai_metadata_attr_sorted_by_id_name[idx] != NULL; idx++)
+    {
+        const sai_attr_metadata_t* md = sai_metadata_attr_sorted_by_id_name[idx];
+
+        if (md->allowedobjecttypes == NULL)
+        {
+            META_ASSERT_NULL(md->allowedobjecttypesmask);
+            continue;
+        }
+
+        META_ASSERT_NOT_NULL(md->allowedobjecttypesmask);
+
+        int ot = SAI_OBJECT_TYPE_NULL;
+
+        for (; ot < SAI_OBJECT_TYPE_MAX; ot++)
+        {
+            bool allowed = false;
+
+            size_t i = 0;
+
+            for (; i < md->allowedobjecttypeslength; i++)
+            {
+                allowed |= (md->allowedobjecttypes[i] == (sai_object_type_t)ot);
+            }
+
+            bool bit = (md->allowedobjecttypesmask[ot / 64] >> (ot % 64)) & 1;
+
+            if (bit != allowed)
+            {
+                META_MD_ASSERT_FAIL(md, "object type %s mask bit don't match allowed object types",
+                        sai_metadata_get_object_type_name((sai_object_type_t)ot));
+            }
+
+            META_ASSERT_TRUE(sai_metadata_is_allowed_object_type(md, (sai_object_type_t)ot) == allowed, "wrong allowed object type");
+        }
+
+        META_ASSERT_TRUE(sai_metadata_validate_object_list(md, (uint32_t)md->allowedobjecttypeslength, md->allowedobjecttypes),
+                "all allowed object types should be valid");
+    }
+}
+
+void check_validate_enum_list()
+{
+    META_LOG_ENTER();
+
+    size_t idx = 0;
+
+    for (; sai_metadata_attr_sorted_by_id_name[idx] != NULL; idx++)
+    {
+        const sai_attr_metadata_t* md = sai_metadata_attr_sorted_by_id_name[idx];
+
+        const sai_enum_metadata_t* emd = md->enummetadata;
+
+        if (emd == NULL)
+        {
+            continue;
+        }
+
+        META_ASSERT_TRUE(sai_metadata_validate_enum_list(md, (uint32_t)emd->valuescount, emd->values), "all enum values should be valid");
+
+        size_t i = 0;
+
+        for (; i < emd->valuescount; i++)
+        {
+            int32_t values[2] = { emd->values[i], emd->values[i] + 1 };
+
+            bool valid = sai_metadata_is_allowed_enum_value(md, values[1]);
+
+            META_ASSERT_TRUE(sai_metadata_validate_enum_list(md, 2, values) == valid, "validate enum list result mismatch");
+        }
+
+        int32_t invalid = -1;
+
+        META_ASSERT_TRUE(sai_metadata_validate_enum_list(md, 1, &invalid) == sai_metadata_is_allowed_enum_value(md, invalid),
+                "validate enum list result mismatch");
+    }
+}
+
+void check_condition_attrs_index(
+        _In_ const sai_object_type_info_t *oi,
+        _In_ const sai_attr_metadata_t *md,
+        _In_ size_t length,
+        _In_ const sai_attr_condition_t* const* list)
+{
+    size_t idx = 0;
+
+    for (; idx < length; idx++)
+    {
+        const sai_attr_condition_t *c = list[idx];
+
+        if (c->type != SAI_ATTR_CONDITION_TYPE_NONE)
+        {
+            continue;
+        }
+
+        if (c->attrindex >= oi->conditionattrscount)
+        {
+            META_MD_ASSERT_FAIL(md, "condition attr index %zu is out of range", c->attrindex);
+        }
+
+        if (oi->conditionattrs[c->attrindex]->attrid != c->attrid)
+        {
+            META_MD_ASSERT_FAIL(md, "condition attr index %zu points to wrong attribute", c->attrindex);
+        }
+    }
+}
+
+void check_evaluate_conditions(
+        _In_ const sai_object_type_info_t *oi,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    bool *condition_met = (bool*)calloc(oi->attrmetadatalength, sizeof(bool));
+    bool *validonly_met = (bool*)calloc(oi->attrmetadatalength, sizeof(bool));
+
+    uint16_t *slots = (uint16_t*)calloc(oi->attrmetadatalength + 1, sizeof(uint16_t));
+
+    sai_attr_list_index_t index;
+
+    META_ASSERT_TRUE(sai_metadata_evaluate_conditions(oi->objecttype, attr_count, attr_list, condition_met, validonly_met),
+            "evaluate conditions should succeed");
+
+    META_ASSERT_TRUE(sai_metadata_attr_list_index_init(oi->objecttype, attr_count, attr_list, oi->attrmetadatalength, slots, &index) == SAI_STATUS_SUCCESS,
+            "attr list index init should succeed");
+
+    size_t idx = 0;
+
+    for (; idx < oi->attrmetadatalength; idx++)
+    {
+        const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+        bool condition = sai_metadata_is_condition_met(md, attr_count, attr_list);
+        bool validonly = sai_metadata_is_validonly_met(md, attr_count, attr_list);
+
+        if (condition_met[idx] != condition || sai_metadata_is_condition_met_index(md, &index) != condition)
+        {
+            META_MD_ASSERT_FAIL(md, "evaluate conditions result mismatch");
+        }
+
+        if (validonly_met[idx] != validonly || sai_metadata_is_validonly_met_index(md, &index) != validonly)
+        {
+            META_MD_ASSERT_FAIL(md, "evaluate validonly result mismatch");
+        }
+
+        if (sai_metadata_attr_list_index_get(&index, md->attrid) != sai_metadata_get_attr_by_id(md->attrid, attr_count, attr_list))
+        {
+            META_MD_ASSERT_FAIL(md, "attr list index get result mismatch");
+        }
+    }
+
+    free(slots);
+    free(condition_met);
+    free(validonly_met);
+}
+
+void check_condition_attrs()
+{
+    META_LOG_ENTER();
+
+    META_ASSERT_FALSE(sai_metadata_evaluate_conditions(SAI_OBJECT_TYPE_NULL, 0, NULL, NULL, NULL), "null object type should fail");
+
+    size_t i = 1;
+
+    for (; sai_metadata_all_object_type_infos[i]; i++)
+    {
+        const sai_object_type_info_t *oi = sai_metadata_all_object_type_infos[i];
+
+        META_ASSERT_TRUE(oi->conditionattrscount <= SAI_METADATA_MAX_CONDITION_ATTRS, "condition attrs count exceeds max");
+
+        size_t idx = 0;
+
+        for (; idx < oi->conditionattrscount; idx++)
+        {
+            const sai_attr_metadata_t *cmd = oi->conditionattrs[idx];
+
+            META_ASSERT_NOT_NULL(cmd);
+            META_ASSERT_TRUE(cmd->objecttype == oi->objecttype, "condition attr must be from the same object type");
+
+            if (idx > 0 && oi->conditionattrs[idx - 1]->attrid >= cmd->attrid)
+            {
+                META_MD_ASSERT_FAIL(cmd, "condition attrs are not sorted by attr id");
+            }
+        }
+
+        if (oi->conditionattrs != NULL)
+        {
+            META_ASSERT_NULL(oi->conditionattrs[oi->conditionattrscount]);
+        }
+
+        check_evaluate_conditions(oi, 0, NULL);
+
+        for (idx = 0; idx < oi->attrmetadatalength; idx++)
+        {
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            check_condition_attrs_index(oi, md, md->conditionslength, md->conditions);
+            check_condition_attrs_index(oi, md, md->validonlylength, md->validonly);
+
+            /*
+             * Build attribute list which satisfies each single condition
+             * of attribute and compare both evaluators on it.
+             */
+
+            const sai_attr_condition_t* const* lists[2] = { md->conditions, md->validonly };
+            size_t lengths[2] = { md->conditionslength, md->validonlylength };
+
+            size_t l = 0;
+
+            for (; l < 2; l++)
+            {
+                if (lengths[l] == 0)
+                {
+                    continue;
+                }
+
+                sai_attribute_t *attrs = (sai_attribute_t*)calloc(lengths[l], sizeof(sai_attribute_t));
+
+                uint32_t count = 0;
+
+                size_t c = 0;
+
+                for (; c < lengths[l]; c++)
+                {
+                    if (lists[l][c]->type != SAI_ATTR_CONDITION_TYPE_NONE)
+                    {
+                        continue;
+                    }
+
+                    attrs[count].id = lists[l][c]->attrid;
+                    attrs[count].value = lists[l][c]->condition;
+
+                    count++;
+
+                    check_evaluate_conditions(oi, count, attrs);
+                }
+
+                free(attrs);
+            }
+        }
+    }
+}
+
+void check_attrs_mask(
+        _In_ const sai_object_type_info_t *oi,
+        _In_ const uint64_t *mask,
+        _In_ sai_attr_flags_t flag)
+{
+    size_t idx = 0;
+
+    for (; idx < oi->attrsmaskwords * 64; idx++)
+    {
+        bool bit = (mask[idx / 64] >> (idx % 64)) & 1;
+
+        if (idx >= oi->attrmetadatalength)
+        {
+            META_ASSERT_FALSE(bit, "mask bit %zu is set outside attributes range on %s", idx, oi->objecttypename);
+            continue;
+        }
+
+        const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+        bool expected = (flag == 0) ? md->isconditional : ((md->flags & flag) == flag);
+
+        if (bit != expected)
+        {
+            META_MD_ASSERT_FAIL(md, "attribute mask bit don't match attribute flags");
+        }
+    }
+}
+
+void check_validate_create_and_set()
+{
+    META_LOG_ENTER();
+
+    sai_attr_id_t err = SAI_INVALID_ATTRIBUTE_ID;
+
+    META_ASSERT_TRUE(sai_metadata_validate_create(SAI_OBJECT_TYPE_NULL, 0, NULL, &err) == SAI_STATUS_INVALID_OBJECT_TYPE, "expected invalid object type");
+    META_ASSERT_TRUE(sai_metadata_validate_set(SAI_OBJECT_TYPE_NULL, 0, NULL, &err) == SAI_STATUS_INVALID_OBJECT_TYPE, "expected invalid object type");
+
+    size_t i = 1;
+
+    for (; sai_metadata_all_object_type_infos[i]; i++)
+    {
+        const sai_object_type_info_t *oi = sai_metadata_all_object_type_infos[i];
+
+        META_ASSERT_TRUE(oi->attrsmaskwords == (oi->attrmetadatalength + 63) / 64 || (oi->attrmetadatalength == 0 && oi->attrsmaskwords == 1),
+                "invalid attributes mask words on %s", oi->objecttypename);
+
+        META_ASSERT_TRUE(oi->attrsmaskwords <= SAI_METADATA_MAX_ATTRS_MASK_WORDS, "attributes mask words exceeds max");
+
+        check_attrs_mask(oi, oi->mandatoryattrsmask, SAI_ATTR_FLAGS_MANDATORY_ON_CREATE);
+        check_attrs_mask(oi, oi->createonlyattrsmask, SAI_ATTR_FLAGS_CREATE_ONLY);
+        check_attrs_mask(oi, oi->readonlyattrsmask, SAI_ATTR_FLAGS_READ_ONLY);
+        check_attrs_mask(oi, oi->conditionalattrsmask, 0);
+
+        /* empty list, first mandatory attribute in force must be reported */
+
+        const sai_attr_metadata_t *expected = NULL;
+
+        size_t idx = 0;
+
+        for (; idx < oi->attrmetadatalength; idx++)
+        {
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            if (SAI_HAS_FLAG_MANDATORY_ON_CREATE(md->flags) && (!md->isconditional || sai_metadata_is_condition_met(md, 0, NULL)))
+            {
+                expected = md;
+                break;
+            }
+        }
+
+        sai_status_t status = sai_metadata_validate_create(oi->objecttype, 0, NULL, &err);
+
+        META_ASSERT_TRUE(status == (expected ? SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING : SAI_STATUS_SUCCESS), "unexpected status on %s", oi->objecttypename);
+        META_ASSERT_TRUE(err == (expected ? expected->attrid : SAI_INVALID_ATTRIBUTE_ID), "unexpected error attribute on %s", oi->objecttypename);
+
+        /* list of all mandatory attributes is valid */
+
+        sai_attribute_t *attrs = (sai_attribute_t*)calloc(oi->attrmetadatalength + 1, sizeof(sai_attribute_t));
+
+        uint32_t count = 0;
+
+        for (idx = 0; idx < oi->attrmetadatalength; idx++)
+        {
+            if (SAI_HAS_FLAG_MANDATORY_ON_CREATE(oi->attrmetadata[idx]->flags))
+            {
+                attrs[count++].id = oi->attrmetadata[idx]->attrid;
+            }
+        }
+
+        META_ASSERT_TRUE(sai_metadata_validate_create(oi->objecttype, count, attrs, &err) == SAI_STATUS_SUCCESS, "expected success on %s", oi->objecttypename);
+
+        if (count)
+        {
+            /* duplicated attribute */
+
+            attrs[count] = attrs[0];
+
+            status = sai_metadata_validate_create(oi->objecttype, count + 1, attrs, &err);
+
+            META_ASSERT_TRUE(status == SAI_STATUS_INVALID_ATTRIBUTE_0 + (sai_status_t)count, "expected invalid attribute on %s", oi->objecttypename);
+            META_ASSERT_TRUE(err == attrs[0].id, "unexpected error attribute");
+        }
+
+        for (idx = 0; idx < oi->attrmetadatalength; idx++)
+        {
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            sai_attribute_t attr = { 0 };
+
+            attr.id = md->attrid;
+
+            sai_status_t create = sai_metadata_validate_create(oi->objecttype, 1, &attr, &err);
+            sai_status_t set = sai_metadata_validate_set(oi->objecttype, 1, &attr, &err);
+
+            if (SAI_HAS_FLAG_READ_ONLY(md->flags))
+            {
+                META_ASSERT_TRUE(create == SAI_STATUS_INVALID_ATTRIBUTE_0, "read only attribute should fail on create");
+            }
+            else
+            {
+                META_ASSERT_TRUE(create != SAI_STATUS_INVALID_ATTRIBUTE_0, "attribute should not fail on create");
+            }
+
+            if (SAI_HAS_FLAG_READ_ONLY(md->flags) || SAI_HAS_FLAG_CREATE_ONLY(md->flags))
+            {
+                META_ASSERT_TRUE(set == SAI_STATUS_INVALID_ATTRIBUTE_0, "read only or create only attribute should fail on set");
+                META_ASSERT_TRUE(err == md->attrid, "unexpected error attribute");
+            }
+            else
+            {
+                META_ASSERT_TRUE(set == SAI_STATUS_SUCCESS, "attribute should be settable");
+            }
+        }
+
+        attrs[0].id = SAI_INVALID_ATTRIBUTE_ID;
+
+        META_ASSERT_TRUE(sai_metadata_validate_set(oi->objecttype, 1, attrs, &err) == SAI_STATUS_UNKNOWN_ATTRIBUTE_0, "expected unknown attribute");
+
+        free(attrs);
+    }
+}
+
+void check_attr_list_index()
+{
+    META_LOG_ENTER();
+
+    uint16_t slot;
+
+    sai_attr_list_index_t index;
+
+    sai_attribute_t attr = { 0 };
+
+    META_ASSERT_TRUE(sai_metadata_attr_list_index_init(SAI_OBJECT_TYPE_NULL, 0, NULL, 1, &slot, &index) == SAI_STATUS_INVALID_OBJECT_TYPE,
+            "expected invalid object type");
+
+    META_ASSERT_TRUE(sai_metadata_attr_list_index_init(SAI_OBJECT_TYPE_PORT, 0, NULL, 1, &slot, &index) == SAI_STATUS_BUFFER_OVERFLOW,
+            "expected buffer overflow");
+
+    size_t i = 1;
+
+    for (; sai_metadata_all_object_type_infos[i]; i++)
+    {
+        const sai_object_type_info_t *oi = sai_metadata_all_object_type_infos[i];
+
+        uint16_t *slots = (uint16_t*)calloc(oi->attrmetadatalength + 1, sizeof(uint16_t));
+
+        sai_attribute_t *attrs = (sai_attribute_t*)calloc(oi->attrmetadatalength * 2, sizeof(sai_attribute_t));
+
+        /* all attributes in reverse order, each duplicated */
+
+        size_t idx = 0;
+
+        for (; idx < oi->attrmetadatalength; idx++)
+        {
+            attrs[idx].id = oi->attrmetadata[oi->attrmetadatalength - idx - 1]->attrid;
+            attrs[idx + oi->attrmetadatalength].id = attrs[idx].id;
+        }
+
+        uint32_t count = (uint32_t)oi->attrmetadatalength * 2;
+
+        META_ASSERT_TRUE(sai_metadata_attr_list_index_init(oi->objecttype, count, attrs, oi->attrmetadatalength, slots, &index) == SAI_STATUS_SUCCESS,
+                "attr list index init should succeed on %s", oi->objecttypename);
+
+        for (idx = 0; idx < oi->attrmetadatalength; idx++)
+        {
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            if (sai_metadata_attr_list_index_get(&index, md->attrid) != sai_metadata_get_attr_by_id(md->attrid, count, attrs))
+            {
+                META_MD_ASSERT_FAIL(md, "attr list index get result mismatch");
+            }
+        }
+
+        META_ASSERT_NULL(sai_metadata_attr_list_index_get(&index, SAI_INVALID_ATTRIBUTE_ID));
+
+        attr.id = SAI_INVALID_ATTRIBUTE_ID;
+
+        META_ASSERT_TRUE(sai_metadata_attr_list_index_init(oi->objecttype, 1, &attr, oi->attrmetadatalength, slots, &index) == SAI_STATUS_UNKNOWN_ATTRIBUTE_0,
+                "expected unknown attribute");
+
+        free(attrs);
+        free(slots);
+    }
+}
+
+void check_attr_descriptors()
+{
+    META_LOG_ENTER();
+
+    META_ASSERT_TRUE(sizeof(sai_attr_descriptor_t) == 8, "attribute descriptor should be compact");
+
+    size_t i = 1;
+
+    for (; sai_metadata_all_object_type_infos[i]; i++)
+    {
+        const sai_object_type_info_t *oi = sai_metadata_all_object_type_infos[i];
+
+        if (oi->attrmetadatalength)
+        {
+            META_ASSERT_NOT_NULL(oi->attrdescriptors);
+        }
+
+        size_t idx = 0;
+
+        for (; idx < oi->attrmetadatalength; idx++)
+        {
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            const sai_attr_descriptor_t *d = &oi->attrdescriptors[idx];
+
+            if (d->attrid != md->attrid || d->attrvaluetype != md->attrvaluetype || d->flags != md->flags)
+            {
+                META_MD_ASSERT_FAIL(md, "attribute descriptor don't match attribute metadata");
+            }
+
+            if (SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_ENUM) != md->isenum ||
+                    SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_ENUM_LIST) != md->isenumlist ||
+                    SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_OID) != md->isoidattribute ||
+                    SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_CONDITIONAL) != md->isconditional ||
+                    SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_VALID_ONLY) != md->isvalidonly ||
+                    SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_PRIMITIVE) != md->isprimitive ||
+                    SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_CUSTOM) != md->iscustom ||
+                    SAI_ATTR_DESCRIPTOR_HAS_PROPERTY(d, SAI_ATTR_DESCRIPTOR_PROPERTY_EXTENSION) != md->isextensionattr)
+            {
+                META_MD_ASSERT_FAIL(md, "attribute descriptor properties don't match attribute metadata");
+            }
+
+            if (SAI_ATTR_DESCRIPTOR_HAS_FLAG(d, SAI_ATTR_FLAGS_KEY) != md->iskey)
+            {
+                META_MD_ASSERT_FAIL(md, "attribute descriptor key flag don't match attribute metadata");
+            }
+
+            META_ASSERT_TRUE(sai_metadata_get_attr_descriptor(md->objecttype, md->attrid) == d, "wrong descriptor returned");
+            META_ASSERT_TRUE(sai_metadata_get_attr_metadata_by_descriptor(md->objecttype, d) == md, "wrong metadata returned");
+        }
+
+        META_ASSERT_NULL(sai_metadata_get_attr_descriptor(oi->objecttype, SAI_INVALID_ATTRIBUTE_ID));
+        META_ASSERT_NULL(sai_metadata_get_attr_metadata_by_descriptor(oi->objecttype, NULL));
+    }
+}
+
+void check_rev_graph_index()
+{
+    META_LOG_ENTER();
+
+    size_t i = 1;
+
+    for (; sai_metadata_all_object_type_infos[i]; i++)
+    {
+        const sai_object_type_info_t *oi = sai_metadata_all_object_type_infos[i];
+
+        size_t count = 0;
+        size_t idx = 0;
+
+        for (; idx < oi->revgraphindexcount; idx++)
+        {
+            const sai_rev_graph_index_t *ri = &oi->revgraphindex[idx];
+
+            if (idx > 0)
+            {
+                META_ASSERT_TRUE(oi->revgraphindex[idx - 1].depobjecttype < ri->depobjecttype,
+                        "rev graph index must be sorted by dependency object type");
+            }
+
+            META_ASSERT_TRUE(ri->count > 0, "rev graph index range can't be empty");
+            META_ASSERT_TRUE(ri->index + ri->count <= oi->revgraphmemberscount, "rev graph index range out of bounds");
+
+            count += ri->count;
+        }
+
+        META_ASSERT_TRUE(count == oi->revgraphmemberscount, "rev graph index must cover all rev graph members");
+
+        for (idx = 0; idx < oi->revgraphmemberscount; idx++)
+        {
+            const sai_rev_graph_member_t *rm = oi->revgraphmembers[idx];
+
+            size_t rangecount = 0;
+
+            const sai_rev_graph_member_t* const* members =
+                sai_metadata_get_rev_graph_members(oi->objecttype, rm->depobjecttype, &rangecount);
+
+            META_ASSERT_NOT_NULL(members);
+
+            META_ASSERT_TRUE(&oi->revgraphmembers[idx] >= members && &oi->revgraphmembers[idx] < members + rangecount,
+                    "rev graph member not found in its dependency object type range");
+
+            size_t n = 0;
+
+            for (; n < rangecount; n++)
+            {
+                META_ASSERT_TRUE(members[n]->depobjecttype == rm->depobjecttype, "wrong member in range");
+            }
+        }
+
+        size_t nullcount = 1;
+
+        META_ASSERT_NULL(sai_metadata_get_rev_graph_members(oi->objecttype, SAI_OBJECT_TYPE_NULL, &nullcount));
+        META_ASSERT_TRUE(nullcount == 0, "count should be zero when object type is not used");
+    }
+}
+
+void check_oid_attrs()
+{
+    META_LOG_ENTER();
+
+    size_t i = 1;
+
+    for (; sai_metadata_all_object_type_infos[i]; i++)
+    {
+        const sai_object_type_info_t *oi = sai_metadata_all_object_type_infos[i];
+
+        size_t count = 0;
+        size_t idx = 0;
+
+        for (; idx < oi->attrmetadatalength; idx++)
+        {
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            if (!md->isoidattribute)
+            {
+                continue;
+            }
+
+            META_ASSERT_TRUE(count < oi->oidattrscount, "oid attributes count too small");
+
+            if (oi->oidattrs[count] != md)
+            {
+                META_MD_ASSERT_FAIL(md, "oid attribute missing or not in attribute metadata order");
+            }
+
+            count++;
+        }
+
+        META_ASSERT_TRUE(count == oi->oidattrscount, "oid attributes count mismatch");
+
+        if (count)
+        {
+            META_ASSERT_NULL(oi->oidattrs[count]);
+        }
+        else
+        {
+            META_ASSERT_NULL(oi->oidattrs);
+        }
+    }
+}
+
+void check_object_type_rank()
+{
+    META_LOG_ENTER();
+
+    META_ASSERT_TRUE(sai_metadata_get_object_type_rank(SAI_OBJECT_TYPE_SWITCH) == 0, "switch must have rank zero");
+    META_ASSERT_TRUE(sai_metadata_get_object_type_rank(SAI_OBJECT_TYPE_NULL) == -1, "null object type has no rank");
+
+    sai_object_type_t ots[TOTAL_OBJECT_TYPE_COUNT];
+    size_t order[TOTAL_OBJECT_TYPE_COUNT];
+    size_t wave[TOTAL_OBJECT_TYPE_COUNT];
+
+    uint32_t count = 0;
+
+    size_t i = 1;
+
+    for (; sai_metadata_all_object_type_infos[i]; i++)
+    {
+        const sai_object_type_info_t *oi = sai_metadata_all_object_type_infos[i];
+
+        META_ASSERT_TRUE(oi->rank <= SAI_METADATA_MAX_OBJECT_TYPE_RANK, "rank exceeds max rank");
+        META_ASSERT_TRUE(sai_metadata_get_object_type_rank(oi->objecttype) == (int)oi->rank, "wrong rank returned");
+
+        if (oi->objecttype != SAI_OBJECT_TYPE_SWITCH)
+        {
+            META_ASSERT_TRUE(oi->rank > 0, "object type must have rank greater than switch");
+        }
+
+        ots[count++] = oi->objecttype;
+
+        size_t idx = 0;
+
+        for (; idx < oi->attrmetadatalength; idx++)
+        {
+            const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+            if (SAI_HAS_FLAG_READ_ONLY(md->flags))
+            {
+                continue;
+            }
+
+            if (SAI_HAS_FLAG_CREATE_AND_SET(md->flags) && (!SAI_HAS_FLAG_MANDATORY_ON_CREATE(md->flags) || md->allownullobjectid))
+            {
+                /* can be set after create, so it may be skipped to resolve cycle */
+                continue;
+            }
+
+            uint32_t j = 0;
+
+            for (; j < md->allowedobjecttypeslength; j++)
+            {
+                sai_object_type_t ot = md->allowedobjecttypes[j];
+
+                if (ot == oi->objecttype)
+                {
+                    continue;
+                }
+
+                if (sai_metadata_get_object_type_rank(ot) >= (int)oi->rank)
+                {
+                    META_MD_ASSERT_FAIL(md, "dependency object type must have lower rank");
+                }
+            }
+        }
+
+        for (idx = 0; idx < oi->structmemberscount; idx++)
+        {
+            const sai_struct_member_info_t *sm = oi->structmembers[idx];
+
+            uint32_t j = 0;
+
+            for (; j < sm->allowedobjecttypeslength; j++)
+            {
+                if (sm->allowedobjecttypes[j] == oi->objecttype)
+                {
+                    continue;
+                }
+
+                META_ASSERT_TRUE(sai_metadata_get_object_type_rank(sm->allowedobjecttypes[j]) < (int)oi->rank,
+                        "struct member object type must have lower rank");
+            }
+        }
+    }
+
+    size_t wave_count = 0;
+
+    META_ASSERT_TRUE(sai_metadata_sort_by_object_type_rank(count, ots, false, order, wave, &wave_count) == SAI_STATUS_SUCCESS,
+            "sort by rank failed");
+
+    META_ASSERT_TRUE(wave_count > 1 && wave_count <= SAI_METADATA_MAX_OBJECT_TYPE_RANK + 1, "invalid wave count");
+    META_ASSERT_TRUE(ots[order[0]] == SAI_OBJECT_TYPE_SWITCH, "switch must be created first");
+
+    for (i = 1; i < count; i++)
+    {
+        int prev = sai_metadata_get_object_type_rank(ots[order[i - 1]]);
+        int curr = sai_metadata_get_object_type_rank(ots[order[i]]);
+
+        META_ASSERT_TRUE(prev <= curr, "operations must be sorted by rank");
+        META_ASSERT_TRUE((prev == curr) == (wave[i - 1] == wave[i]), "wave must contain single rank");
+
+        if (prev == curr)
+        {
+            META_ASSERT_TRUE(order[i - 1] < order[i], "sort must be stable");
+        }
+    }
+
+    META_ASSERT_TRUE(sai_metadata_sort_by_object_type_rank(count, ots, true, order, wave, &wave_count) == SAI_STATUS_SUCCESS,
+            "reverse sort by rank failed");
+    META_ASSERT_TRUE(ots[order[count - 1]] == SAI_OBJECT_TYPE_SWITCH, "switch must be removed last");
+
+    ots[0] = SAI_OBJECT_TYPE_NULL;
+
+    META_ASSERT_TRUE(sai_metadata_sort_by_object_type_rank(count, ots, false, order, wave, &wave_count) == SAI_STATUS_INVALID_OBJECT_TYPE,
+            "invalid object type should be rejected");
+}
+
+void check_mixed_bulk()
+{
+    META_LOG_ENTER();
+
+    /* no apis are initialized, so every executed object fails as not implemented */
+
+    sai_apis_t apis;
+
+    memset(&apis, 0, sizeof(apis));
+
+    sai_object_meta_key_t mk[3];
+
+    memset(mk, 0, sizeof(mk));
+
+    mk[0].objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    mk[1].objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER;
+    mk[2].objecttype = SAI_OBJECT_TYPE_SWITCH;
+
+    uint32_t attr_count[3] = { 0, 0, 0 };
+    const sai_attribute_t *attr_list[3] = { NULL, NULL, NULL };
+    sai_status_t statuses[3];
+
+    sai_status_t status = sai_metadata_mixed_bulk_create(&apis, SAI_NULL_OBJECT_ID, 3, mk, attr_count, attr_list,
+            SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses);
+
+    META_ASSERT_TRUE(status == SAI_STATUS_FAILURE, "mixed bulk create should fail");
+    META_ASSERT_TRUE(statuses[2] == SAI_STATUS_NOT_IMPLEMENTED, "switch should be created first");
+    META_ASSERT_TRUE(statuses[0] == SAI_STATUS_NOT_EXECUTED, "route entry should not be executed");
+    META_ASSERT_TRUE(statuses[1] == SAI_STATUS_NOT_EXECUTED, "virtual router should not be executed");
+
+    status = sai_metadata_mixed_bulk_remove(&apis, 3, mk, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses);
+
+    META_ASSERT_TRUE(status == SAI_STATUS_FAILURE, "mixed bulk remove should fail");
+    META_ASSERT_TRUE(statuses[0] == SAI_STATUS_NOT_IMPLEMENTED, "route entry should be removed first");
+    META_ASSERT_TRUE(statuses[1] == SAI_STATUS_NOT_EXECUTED, "virtual router should not be executed");
+    META_ASSERT_TRUE(statuses[2] == SAI_STATUS_NOT_EXECUTED, "switch should not be executed");
+
+    status = sai_metadata_mixed_bulk_remove(&apis, 3, mk, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    META_ASSERT_TRUE(status == SAI_STATUS_FAILURE, "mixed bulk remove should fail");
+
+    size_t i = 0;
+
+    for (; i < 3; i++)
+    {
+        META_ASSERT_TRUE(statuses[i] == SAI_STATUS_NOT_IMPLEMENTED, "all objects should be executed");
+    }
+
+    status = sai_metadata_mixed_bulk_remove(&apis, 0, mk, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    META_ASSERT_TRUE(status == SAI_STATUS_SUCCESS, "empty mixed bulk should succeed");
+}
+
+static sai_status_t check_mixed_bulk_create_virtual_router(
+        _Out_ sai_object_id_t *virtual_router_id,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    *virtual_router_id = 0x3000000000001;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static sai_status_t check_mixed_bulk_create_route_entries(
+        _In_ uint32_t object_count,
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    /* fails whole bulk without writing object statuses */
+
+    return SAI_STATUS_INVALID_PARAMETER;
+}
+
+void check_mixed_bulk_group_failure()
+{
+    META_LOG_ENTER();
+
+    /* virtual routers are created first and succeed, then route bulk fails */
+
+    sai_virtual_router_api_t virtual_router_api;
+    sai_route_api_t route_api;
+    sai_apis_t apis;
+
+    memset(&virtual_router_api, 0, sizeof(virtual_router_api));
+    memset(&route_api, 0, sizeof(route_api));
+    memset(&apis, 0, sizeof(apis));
+
+    virtual_router_api.create_virtual_router = check_mixed_bulk_create_virtual_router;
+    route_api.create_route_entries = check_mixed_bulk_create_route_entries;
+
+    apis.virtual_router_api = &virtual_router_api;
+    apis.route_api = &route_api;
+
+    sai_object_meta_key_t mk[4];
+
+    memset(mk, 0, sizeof(mk));
+
+    mk[0].objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    mk[1].objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER;
+    mk[2].objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY;
+    mk[3].objecttype = SAI_OBJECT_TYPE_VIRTUAL_ROUTER;
+
+    uint32_t attr_count[4] = { 0, 0, 0, 0 };
+    const sai_attribute_t *attr_list[4] = { NULL, NULL, NULL, NULL };
+    sai_status_t statuses[4];
+
+    sai_status_t status = sai_metadata_mixed_bulk_create(&apis, SAI_NULL_OBJECT_ID, 4, mk, attr_count, attr_list,
+            SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    META_ASSERT_TRUE(status == SAI_STATUS_FAILURE, "mixed bulk create should fail");
+    META_ASSERT_TRUE(statuses[1] == SAI_STATUS_SUCCESS, "virtual router should be created");
+    META_ASSERT_TRUE(statuses[3] == SAI_STATUS_SUCCESS, "virtual router should be created");
+    META_ASSERT_TRUE(statuses[0] == SAI_STATUS_INVALID_PARAMETER, "route entry should get bulk status");
+    META_ASSERT_TRUE(statuses[2] == SAI_STATUS_INVALID_PARAMETER, "route entry should get bulk status");
+}
+
 void check_object_type_index()
 {
     META_LOG_ENTER();
@@ -6383,6 +7389,7 @@ int main(int argc, char **argv)
     check_all_enums_name_pointers();
     check_all_enums_values();
     check_enums_ignore_values();
+    check_enums_names_sorted_index();
     check_sai_status();
     check_object_type_index();
     check_object_type();
@@ -6425,6 +7432,17 @@ int main(int argc, char **argv)
     check_custom_range_attributes();
     check_attr_get_outside_range();
     check_api_extensions();
+    check_allowed_object_types_mask();
+    check_validate_enum_list();
+    check_condition_attrs();
+    check_validate_create_and_set();
+    check_attr_list_index();
+    check_attr_descriptors();
+    check_rev_graph_index();
+    check_oid_attrs();
+    check_object_type_rank();
+    check_mixed_bulk();
+    check_mixed_bulk_group_failure();
 
     SAI_META_LOG_DEBUG("log test");
 
@@ -25,7 +25,6 @@
 #include <arpa/inet.h>
 #include <byteswap.h>
 #include <ctype.h>
-#include <errno.h>
 #include <inttypes.h>
 #include <limits.h>
 #include <stdio.h>
@@ -57,6 +56,196 @@
 #define EXPECT_QUOTE_CHECK(expr, suffix) {\
     EXPECT("\""); EXPECT_CHECK(expr, suffix); EXPECT("\""); }
 
+/* Emit macros */
+
+#define EMIT(x) { memcpy(buf, x, sizeof(x)); buf += sizeof(x) - 1; }
+
+/*
+ * Formatting helpers.
+ *
+ * Numbers are formatted two decimal digits at a time using lookup table and
+ * hex values are formatted one nibble at a time, output is the same as
+ * produced by printf "%u" and "%x" formats.
+ */
+
+#define SAI_MAX_UINT64_DIGITS 20
+
+static const char sai_serialize_dec_digits[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char sai_serialize_hex_digits_lower[] = "0123456789abcdef";
+static const char sai_serialize_hex_digits_upper[] = "0123456789ABCDEF";
+
+/*
+ * Hex digit values indexed by character, -1 for characters which are not hex
+ * digits, used to parse hex bytes and ipv6 groups without sscanf.
+ */
+
+static const int8_t sai_deserialize_hex_values[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+static int sai_serialize_dec_u64(
+        _Out_ char *buffer,
+        _In_ uint64_t u64)
+{
+    char tmp[SAI_MAX_UINT64_DIGITS];
+    size_t idx = SAI_MAX_UINT64_DIGITS;
+    size_t len;
+
+    while (u64 >= 100)
+    {
+        size_t d = (size_t)(u64 % 100) * 2;
+
+        u64 /= 100;
+
+        tmp[--idx] = sai_serialize_dec_digits[d + 1];
+        tmp[--idx] = sai_serialize_dec_digits[d];
+    }
+
+    if (u64 >= 10)
+    {
+        size_t d = (size_t)u64 * 2;
+
+        tmp[--idx] = sai_serialize_dec_digits[d + 1];
+        tmp[--idx] = sai_serialize_dec_digits[d];
+    }
+    else
+    {
+        tmp[--idx] = (char)('0' + u64);
+    }
+
+    len = SAI_MAX_UINT64_DIGITS - idx;
+
+    memcpy(buffer, tmp + idx, len);
+
+    buffer[len] = 0;
+
+    return (int)len;
+}
+
+static int sai_serialize_dec_s64(
+        _Out_ char *buffer,
+        _In_ int64_t s64)
+{
+    if (s64 < 0)
+    {
+        *buffer = '-';
+
+        /* unsigned negation, so INT64_MIN is handled correctly */
+
+        return sai_serialize_dec_u64(buffer + 1, (uint64_t)0 - (uint64_t)s64) + 1;
+    }
+
+    return sai_serialize_dec_u64(buffer, (uint64_t)s64);
+}
+
+static int sai_serialize_hex_u64(
+        _Out_ char *buffer,
+        _In_ uint64_t u64)
+{
+    /* number of significant nibbles, at least one for zero value */
+
+    int len = (64 - __builtin_clzll(u64 | 1) + 3) / 4;
+    int idx;
+
+    for (idx = len - 1; idx >= 0; idx--)
+    {
+        buffer[idx] = sai_serialize_hex_digits_lower[u64 & 0xF];
+
+        u64 >>= 4;
+    }
+
+    buffer[len] = 0;
+
+    return len;
+}
+
+static int sai_serialize_hex_bytes(
+        _Out_ char *buffer,
+        _In_ const uint8_t *data,
+        _In_ size_t count)
+{
+    size_t idx;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        buffer[3 * idx] = sai_serialize_hex_digits_upper[data[idx] >> 4];
+        buffer[3 * idx + 1] = sai_serialize_hex_digits_upper[data[idx] & 0xF];
+        buffer[3 * idx + 2] = ':';
+    }
+
+    /* last separator is replaced by end of string */
+
+    buffer[3 * count - 1] = 0;
+
+    return (int)(3 * count - 1);
+}
+
+static int sai_deserialize_hex_bytes(
+        _In_ const char *buffer,
+        _Out_ uint8_t *data,
+        _In_ size_t count)
+{
+    size_t idx;
+    int hi;
+    int lo = 0;
+
+    /*
+     * Bytes are in format "XX:XX:...:XX" as produced by serialize, data can
+     * be NULL when buffer is only validated.
+     */
+
+    for (idx = 0; idx < count; idx++)
+    {
+        const char *hex = buffer + 3 * idx;
+
+        hi = sai_deserialize_hex_values[(uint8_t)hex[0]];
+
+        if (hi < 0 || (lo = sai_deserialize_hex_values[(uint8_t)hex[1]]) < 0 ||
+                (idx + 1 < count && hex[2] != ':'))
+        {
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        if (data != NULL)
+        {
+            data[idx] = (uint8_t)((hi << 4) | lo);
+        }
+    }
+
+    if (sai_serialize_is_char_allowed(buffer[3 * count - 1]))
+    {
+        return (int)(3 * count - 1);
+    }
+
+    return SAI_SERIALIZE_ERROR;
+}
+
 bool sai_serialize_is_char_allowed(
         _In_ char c)
 {
@@ -78,7 +267,14 @@ int sai_serialize_bool(
         _Out_ char *buffer,
         _In_ bool flag)
 {
-    return sprintf(buffer, "%s", flag ? "true" : "false");
+    if (flag)
+    {
+        memcpy(buffer, "true", sizeof("true"));
+        return (int)sizeof("true") - 1;
+    }
+
+    memcpy(buffer, "false", sizeof("false"));
+    return (int)sizeof("false") - 1;
 }
 
 #define SAI_TRUE_LENGTH 4
@@ -194,7 +390,7 @@ int sai_serialize_uint8(
         _Out_ char *buffer,
         _In_ uint8_t u8)
 {
-    return sprintf(buffer, "%u", u8);
+    return sai_serialize_dec_u64(buffer, u8);
 }
 
 int sai_deserialize_uint8(
@@ -219,7 +415,7 @@ int sai_serialize_int8(
         _Out_ char *buffer,
         _In_ int8_t u8)
 {
-    return sprintf(buffer, "%d", u8);
+    return sai_serialize_dec_s64(buffer, u8);
 }
 
 int sai_deserialize_int8(
@@ -244,7 +440,7 @@ int sai_serialize_uint16(
         _Out_ char *buffer,
         _In_ uint16_t u16)
 {
-    return sprintf(buffer, "%u", u16);
+    return sai_serialize_dec_u64(buffer, u16);
 }
 
 int sai_deserialize_uint16(
@@ -269,7 +465,7 @@ int sai_serialize_int16(
         _Out_ char *buffer,
         _In_ int16_t s16)
 {
-    return sprintf(buffer, "%d", s16);
+    return sai_serialize_dec_s64(buffer, s16);
 }
 
 int sai_deserialize_int16(
@@ -294,7 +490,7 @@ int sai_serialize_uint32(
         _Out_ char *buffer,
         _In_ uint32_t u32)
 {
-    return sprintf(buffer, "%u", u32);
+    return sai_serialize_dec_u64(buffer, u32);
 }
 
 int sai_deserialize_uint32(
@@ -319,7 +515,7 @@ int sai_serialize_int32(
         _Out_ char *buffer,
         _In_ int32_t s32)
 {
-    return sprintf(buffer, "%d", s32);
+    return sai_serialize_dec_s64(buffer, s32);
 }
 
 int sai_deserialize_int32(
@@ -344,7 +540,7 @@ int sai_serialize_uint64(
         _Out_ char *buffer,
         _In_ uint64_t u64)
 {
-    return sprintf(buffer, "%"PRIu64, u64);
+    return sai_serialize_dec_u64(buffer, u64);
 }
 
 #define SAI_BASE_10 10
@@ -391,7 +587,7 @@ int sai_serialize_int64(
         _Out_ char *buffer,
         _In_ int64_t s64)
 {
-    return sprintf(buffer, "%"PRId64, s64);
+    return sai_serialize_dec_s64(buffer, s64);
 }
 
 int sai_deserialize_int64(
@@ -437,7 +633,7 @@ int sai_serialize_size(
         _Out_ char *buffer,
         _In_ sai_size_t size)
 {
-    return sprintf(buffer, "%zu", size);
+    return sai_serialize_dec_u64(buffer, size);
 }
 
 int sai_deserialize_size(
@@ -462,20 +658,36 @@ int sai_serialize_object_id(
         _Out_ char *buffer,
         _In_ sai_object_id_t oid)
 {
-    return sprintf(buffer, "oid:0x%"PRIx64, oid);
+    memcpy(buffer, "oid:0x", sizeof("oid:0x") - 1);
+
+    return (int)sizeof("oid:0x") - 1 + sai_serialize_hex_u64(buffer + sizeof("oid:0x") - 1, oid);
 }
 
 int sai_deserialize_object_id(
         _In_ const char *buffer,
         _Out_ sai_object_id_t *oid)
 {
-    int read;
+    const char *buf = buffer + sizeof("oid:0x") - 1;
+    uint64_t value = 0;
+    int digits;
 
-    int n = sscanf(buffer, "oid:0x%16"PRIx64"%n", oid, &read);
+    /*
+     * sscanf is not used, since it calls strlen on input, which makes
+     * deserialize of long buffers like bulk operations quadratic.
+     */
 
-    if (n == 1 && sai_serialize_is_char_allowed(buffer[read]))
+    if (strncmp(buffer, "oid:0x", sizeof("oid:0x") - 1) == 0)
     {
-        return read;
+        for (digits = 0; digits < 16 && sai_deserialize_hex_values[(uint8_t)*buf] >= 0; digits++, buf++)
+        {
+            value = (value << 4) | (uint8_t)sai_deserialize_hex_values[(uint8_t)*buf];
+        }
+
+        if (digits > 0 && sai_serialize_is_char_allowed(*buf))
+        {
+            *oid = value;
+            return (int)(buf - buffer);
+        }
     }
 
     SAI_META_LOG_WARN("failed to deserialize '%.*s' as oid", MAX_CHARS_PRINT, buffer);
@@ -486,30 +698,18 @@ int sai_serialize_mac(
         _Out_ char *buffer,
         _In_ const sai_mac_t mac)
 {
-    return sprintf(buffer, "%02X:%02X:%02X:%02X:%02X:%02X",
-            mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    return sai_serialize_hex_bytes(buffer, mac, sizeof(sai_mac_t));
 }
 
-#define SAI_MAC_ADDRESS_LENGTH 17
-
 int sai_deserialize_mac(
         _In_ const char *buffer,
         _Out_ sai_mac_t mac)
 {
-    int arr[6];
-    int read;
-
-    int n = sscanf(buffer, "%2X:%2X:%2X:%2X:%2X:%2X%n",
-            &arr[0], &arr[1], &arr[2], &arr[3], &arr[4], &arr[5], &read);
+    int ret = sai_deserialize_hex_bytes(buffer, mac, sizeof(sai_mac_t));
 
-    if (n == 6 && read == SAI_MAC_ADDRESS_LENGTH && sai_serialize_is_char_allowed(buffer[read]))
+    if (ret >= 0)
     {
-        for (n = 0; n < 6; n++)
-        {
-            mac[n] = (uint8_t)arr[n];
-        }
-
-        return SAI_MAC_ADDRESS_LENGTH;
+        return ret;
     }
 
     SAI_META_LOG_WARN("failed to deserialize '%.*s' as mac address", MAX_CHARS_PRINT, buffer);
@@ -520,42 +720,18 @@ int sai_serialize_encrypt_key(
         _Out_ char *buffer,
         _In_ const sai_encrypt_key_t sak)
 {
-    return sprintf(buffer, "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:\
-%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:\
-%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:\
-%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                   sak[0], sak[1], sak[2], sak[3], sak[4], sak[5],sak[6], sak[7],
-                   sak[8], sak[9], sak[10], sak[11], sak[12], sak[13],sak[14], sak[15],
-                   sak[16], sak[17], sak[18], sak[19], sak[20], sak[21],sak[22], sak[23],
-                   sak[24], sak[25], sak[26], sak[27], sak[28], sak[29],sak[30], sak[31]);
+    return sai_serialize_hex_bytes(buffer, sak, sizeof(sai_encrypt_key_t));
 }
 
 int sai_deserialize_encrypt_key(
         _In_ const char *buffer,
         _Out_ sai_encrypt_key_t sak)
 {
-    int arr[32];
-    int read;
+    int ret = sai_deserialize_hex_bytes(buffer, sak, sizeof(sai_encrypt_key_t));
 
-    int n = sscanf(buffer, "%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:\
-%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X%n",
-                   &arr[0], &arr[1], &arr[2], &arr[3],
-                   &arr[4], &arr[5], &arr[6], &arr[7],
-                   &arr[8], &arr[9], &arr[10], &arr[11],
-                   &arr[12], &arr[13], &arr[14], &arr[15],
-                   &arr[16], &arr[17], &arr[18], &arr[19],
-                   &arr[20], &arr[21], &arr[22], &arr[23],
-                   &arr[24], &arr[25], &arr[26], &arr[27],
-                   &arr[28], &arr[29], &arr[30], &arr[31], &read);
-
-    if (n == 32 && read == (32*3-1) && sai_serialize_is_char_allowed(buffer[read]))
+    if (ret >= 0)
     {
-        for (n = 0; n < 32; n++)
-        {
-            sak[n] = (uint8_t)arr[n];
-        }
-
-        return read;
+        return ret;
     }
 
     SAI_META_LOG_WARN("failed to deserialize '%.*s' as encrypt_key", MAX_CHARS_PRINT, buffer);
@@ -566,33 +742,18 @@ int sai_serialize_auth_key(
         _Out_ char *buffer,
         _In_ const sai_auth_key_t auth)
 {
-    return sprintf(buffer, "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:\
-%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                   auth[0], auth[1], auth[2], auth[3], auth[4], auth[5],auth[6], auth[7],
-                   auth[8], auth[9], auth[10], auth[11], auth[12], auth[13],auth[14], auth[15]);
+    return sai_serialize_hex_bytes(buffer, auth, sizeof(sai_auth_key_t));
 }
 
 int sai_deserialize_auth_key(
         _In_ const char *buffer,
         _Out_ sai_auth_key_t auth)
 {
-    int arr[16];
-    int read;
+    int ret = sai_deserialize_hex_bytes(buffer, auth, sizeof(sai_auth_key_t));
 
-    int n = sscanf(buffer, "%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X%n",
-                   &arr[0], &arr[1], &arr[2], &arr[3],
-                   &arr[4], &arr[5], &arr[6], &arr[7],
-                   &arr[8], &arr[9], &arr[10], &arr[11],
-                   &arr[12], &arr[13], &arr[14], &arr[15], &read);
-
-    if (n == 16 && read == (16*3-1) && sai_serialize_is_char_allowed(buffer[read]))
+    if (ret >= 0)
     {
-       for (n = 0; n < 16; n++)
-        {
-            auth[n] = (uint8_t)arr[n];
-        }
-
-        return read;
+        return ret;
     }
 
     SAI_META_LOG_WARN("failed to deserialize '%.*s' as auth_key", MAX_CHARS_PRINT, buffer);
@@ -631,32 +792,18 @@ int sai_serialize_macsec_salt(
         _Out_ char *buffer,
         _In_ const sai_macsec_salt_t salt)
 {
-    return sprintf(buffer, "%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X:%02X",
-                   salt[0], salt[1], salt[2], salt[3], salt[4], salt[5],salt[6], salt[7],
-                   salt[8], salt[9], salt[10], salt[11]);
+    return sai_serialize_hex_bytes(buffer, salt, sizeof(sai_macsec_salt_t));
 }
 
 int sai_deserialize_macsec_salt(
         _In_ const char *buffer,
         _Out_ sai_macsec_salt_t salt)
 {
-    int arr[32];
-    int read;
+    int ret = sai_deserialize_hex_bytes(buffer, salt, sizeof(sai_macsec_salt_t));
 
-    int n = sscanf(buffer, "%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X:%2X%n",
-                   &arr[0], &arr[1], &arr[2], &arr[3],
-                   &arr[4], &arr[5], &arr[6], &arr[7],
-                   &arr[8], &arr[9], &arr[10], &arr[11],
-                   &read);
-
-    if (n == 12 && read == (12*3-1) && sai_serialize_is_char_allowed(buffer[read]))
+    if (ret >= 0)
     {
-        for (n = 0; n < 12; n++)
-        {
-            salt[n] = (uint8_t)arr[n];
-        }
-
-        return read;
+        return ret;
     }
 
     SAI_META_LOG_WARN("failed to deserialize '%.*s' as macsec_salt", MAX_CHARS_PRINT, buffer);
@@ -673,14 +820,15 @@ int sai_serialize_enum(
         return sai_serialize_int32(buffer, value);
     }
 
-    size_t i = 0;
+    const char *name = sai_metadata_get_enum_value_name(meta, value);
 
-    for (; i < meta->valuescount; ++i)
+    if (name != NULL)
     {
-        if (meta->values[i] == value)
-        {
-            return sprintf(buffer, "%s", meta->valuesnames[i]);
-        }
+        size_t len = strlen(name);
+
+        memcpy(buffer, name, len + 1);
+
+        return (int)len;
     }
 
     SAI_META_LOG_WARN("enum value %d not found in enum %s", value, meta->name);
@@ -688,6 +836,33 @@ int sai_serialize_enum(
     return sai_serialize_int32(buffer, value);
 }
 
+/**
+ * @brief Compares enum value name in deserialize buffer with given name.
+ *
+ * Name in buffer can be terminated by any character allowed by
+ * sai_serialize_is_char_allowed. On match, length of name is returned in len.
+ */
+static int sai_deserialize_enum_name_cmp(
+        _In_ const char *buffer,
+        _In_ const char *name,
+        _Out_ size_t *len)
+{
+    const char *start = name;
+
+    while (*name && *buffer == *name)
+    {
+        buffer++;
+        name++;
+    }
+
+    int c1 = sai_serialize_is_char_allowed(*buffer) ? 0 : (unsigned char)*buffer;
+    int c2 = (unsigned char)*name;
+
+    *len = (size_t)(name - start);
+
+    return c1 - c2;
+}
+
 int sai_deserialize_enum(
         _In_ const char *buffer,
         _In_ const sai_enum_metadata_t *meta,
@@ -698,17 +873,52 @@ int sai_deserialize_enum(
         return sai_deserialize_int32(buffer, value);
     }
 
-    size_t idx = 0;
+    if (meta->valuesnamessortedindex == NULL)
+    {
+        /* enum metadata without sorted index, fall back to linear search */
+
+        size_t idx = 0;
+
+        for (; idx < meta->valuescount; ++idx)
+        {
+            size_t len = strlen(meta->valuesnames[idx]);
 
-    for (; idx < meta->valuescount; ++idx)
+            if (strncmp(meta->valuesnames[idx], buffer, len) == 0 &&
+                sai_serialize_is_char_allowed(buffer[len]))
+            {
+                *value = meta->values[idx];
+                return (int)len;
+            }
+        }
+    }
+    else
     {
-        size_t len = strlen(meta->valuesnames[idx]);
+        ssize_t first = 0;
+        ssize_t last = (ssize_t)meta->valuescount - 1;
 
-        if (strncmp(meta->valuesnames[idx], buffer, len) == 0 &&
-            sai_serialize_is_char_allowed(buffer[len]))
+        while (first <= last)
         {
-            *value = meta->values[idx];
-            return (int)len;
+            ssize_t middle = (first + last) / 2;
+
+            int idx = meta->valuesnamessortedindex[middle];
+
+            size_t len;
+
+            int res = sai_deserialize_enum_name_cmp(buffer, meta->valuesnames[idx], &len);
+
+            if (res > 0)
+            {
+                first = middle + 1;
+            }
+            else if (res < 0)
+            {
+                last = middle - 1;
+            }
+            else
+            {
+                *value = meta->values[idx];
+                return (int)len;
+            }
         }
     }
 
@@ -717,113 +927,329 @@ int sai_deserialize_enum(
     return sai_deserialize_int32(buffer, value);
 }
 
-static int sai_deserialize_ip(
+static int sai_deserialize_ip4_text(
         _In_ const char *buffer,
-        _In_ int inet,
-        _Out_ uint8_t *ip)
+        _Out_ uint8_t *ip4)
 {
-    /*
-     * Since we want relaxed version of deserialize, after ip address there
-     * may be '"' (quote), but inet_pton expects '\0' at the end, so copy at
-     * most INET6 characters to local buffer.
-     */
-
-    char local[INET6_ADDRSTRLEN + 1];
-
+    const char *buf = buffer;
+    uint32_t value;
+    int digits;
     int idx;
 
-    for (idx = 0; idx < INET6_ADDRSTRLEN; idx++)
-    {
-        char c = buffer[idx];
+    /* same format as accepted by inet_pton, leading zeros are not allowed */
 
-        if (isxdigit(c) || c == ':' || c == '.')
+    for (idx = 0; idx < 4; idx++)
+    {
+        if (idx != 0 && *buf++ != '.')
         {
-            local[idx] = c;
-            continue;
+            return SAI_SERIALIZE_ERROR;
         }
 
-        break;
-    }
-
-    local[idx] = 0;
-
-    if (inet_pton(inet, local, ip) != 1)
-    {
-        /*
-         * We should not warn here, since we will use this method to
-         * deserialize ip4 and ip6 and we will need to guess which one.
-         */
+        value = 0;
 
-        return SAI_SERIALIZE_ERROR;
-    }
+        for (digits = 0; *buf >= '0' && *buf <= '9'; digits++, buf++)
+        {
+            value = value * 10 + (uint32_t)(*buf - '0');
 
-    if (sai_serialize_is_char_allowed(buffer[idx]) || buffer[idx] == '/')
-    {
-        return idx;
-    }
+            if ((digits != 0 && value < 10) || value > UINT8_MAX)
+            {
+                return SAI_SERIALIZE_ERROR;
+            }
+        }
 
-    SAI_META_LOG_WARN("invalid char 0x%x at end of ip address", buffer[idx]);
-    return SAI_SERIALIZE_ERROR;
-}
+        if (digits == 0)
+        {
+            return SAI_SERIALIZE_ERROR;
+        }
 
-int sai_serialize_ip4(
-        _Out_ char *buffer,
-        _In_ sai_ip4_t ip4)
-{
-    if (inet_ntop(AF_INET, &ip4, buffer, INET_ADDRSTRLEN) == NULL)
-    {
-        SAI_META_LOG_WARN("failed to convert ipv4 address, errno: %s", strerror(errno));
-        return SAI_SERIALIZE_ERROR;
+        ip4[idx] = (uint8_t)value;
     }
 
-    return (int)strlen(buffer);
+    return (int)(buf - buffer);
 }
 
-int sai_deserialize_ip4(
+static int sai_deserialize_ip6_text(
         _In_ const char *buffer,
-        _Out_ sai_ip4_t *ip4)
+        _Out_ uint8_t *ip6)
 {
-    return sai_deserialize_ip(buffer, AF_INET, (uint8_t*)ip4);
-}
+    const char *buf = buffer;
+    const char *group;
+    uint32_t value;
+    int digits;
+    int gap = -1;
+    int pos = 0;
+    int ret;
 
-int sai_serialize_ip6(
-        _Out_ char *buffer,
-        _In_ const sai_ip6_t ip6)
-{
-    if (inet_ntop(AF_INET6, ip6, buffer, INET6_ADDRSTRLEN) == NULL)
-    {
-        SAI_META_LOG_WARN("failed to convert ipv6 address, errno: %s", strerror(errno));
-        return SAI_SERIALIZE_ERROR;
-    }
+    /*
+     * Groups are parsed to ip6 from the beginning, if "::" was present, groups
+     * after it are moved to the end and gap is filled with zeros.
+     */
 
-    return (int)strlen(buffer);
-}
+    if (buf[0] == ':')
+    {
+        if (buf[1] != ':')
+        {
+            return SAI_SERIALIZE_ERROR;
+        }
 
-int sai_deserialize_ip6(
-        _In_ const char *buffer,
-        _Out_ sai_ip6_t ip6)
-{
-    return sai_deserialize_ip(buffer, AF_INET6, ip6);
-}
+        gap = 0;
+        buf += 2;
+    }
 
-int sai_serialize_ip_address(
-        _Out_ char *buffer,
-        _In_ const sai_ip_address_t *ip_address)
-{
-    switch (ip_address->addr_family)
+    while (gap != pos || sai_deserialize_hex_values[(uint8_t)*buf] >= 0)
     {
-        case SAI_IP_ADDR_FAMILY_IPV4:
+        group = buf;
+        value = 0;
 
-            return sai_serialize_ip4(buffer, ip_address->addr.ip4);
+        for (digits = 0; sai_deserialize_hex_values[(uint8_t)*buf] >= 0; digits++, buf++)
+        {
+            if (digits == 4)
+            {
+                return SAI_SERIALIZE_ERROR;
+            }
 
-        case SAI_IP_ADDR_FAMILY_IPV6:
+            value = (value << 4) | (uint32_t)(uint8_t)sai_deserialize_hex_values[(uint8_t)*buf];
+        }
 
-            return sai_serialize_ip6(buffer, ip_address->addr.ip6);
+        if (digits == 0)
+        {
+            return SAI_SERIALIZE_ERROR;
+        }
 
-        default:
+        if (*buf == '.')
+        {
+            /* ipv4 in last 32 bits */
 
-            SAI_META_LOG_WARN("invalid ip address family: %d", ip_address->addr_family);
-            return SAI_SERIALIZE_ERROR;
+            if (pos > 12 || (ret = sai_deserialize_ip4_text(group, ip6 + pos)) < 0)
+            {
+                return SAI_SERIALIZE_ERROR;
+            }
+
+            buf = group + ret;
+            pos += 4;
+            break;
+        }
+
+        ip6[pos++] = (uint8_t)(value >> 8);
+        ip6[pos++] = (uint8_t)value;
+
+        if (*buf != ':')
+        {
+            break;
+        }
+
+        if (buf[1] == ':' && gap < 0)
+        {
+            gap = pos;
+            buf += 2;
+            continue;
+        }
+
+        if (pos == 16)
+        {
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        buf++;
+    }
+
+    if (gap < 0)
+    {
+        return (pos == 16) ? (int)(buf - buffer) : SAI_SERIALIZE_ERROR;
+    }
+
+    if (pos == 16)
+    {
+        /* "::" must stand for at least one zero group */
+
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    memmove(ip6 + 16 - (pos - gap), ip6 + gap, (size_t)(pos - gap));
+    memset(ip6 + gap, 0, (size_t)(16 - pos));
+
+    return (int)(buf - buffer);
+}
+
+static int sai_deserialize_ip(
+        _In_ const char *buffer,
+        _In_ int inet,
+        _Out_ uint8_t *ip)
+{
+    int idx;
+
+    /*
+     * Address is parsed in place, since we want relaxed version of
+     * deserialize, after ip address there may be '"' (quote) or '/'.
+     */
+
+    if (inet == AF_INET)
+    {
+        idx = sai_deserialize_ip4_text(buffer, ip);
+    }
+    else
+    {
+        idx = sai_deserialize_ip6_text(buffer, ip);
+    }
+
+    if (idx < 0 || sai_deserialize_hex_values[(uint8_t)buffer[idx]] >= 0 || buffer[idx] == ':' || buffer[idx] == '.')
+    {
+        /*
+         * We should not warn here, since we will use this method to
+         * deserialize ip4 and ip6 and we will need to guess which one.
+         */
+
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    if (sai_serialize_is_char_allowed(buffer[idx]) || buffer[idx] == '/')
+    {
+        return idx;
+    }
+
+    SAI_META_LOG_WARN("invalid char 0x%x at end of ip address", buffer[idx]);
+    return SAI_SERIALIZE_ERROR;
+}
+
+int sai_serialize_ip4(
+        _Out_ char *buffer,
+        _In_ sai_ip4_t ip4)
+{
+    /*
+     * Address is in network order, so bytes are formatted in memory order,
+     * same as inet_ntop does.
+     */
+
+    const uint8_t *bytes = (const uint8_t*)&ip4;
+
+    int len = 0;
+    int idx;
+
+    for (idx = 0; idx < 4; idx++)
+    {
+        if (idx != 0)
+        {
+            buffer[len++] = '.';
+        }
+
+        len += sai_serialize_dec_u64(buffer + len, bytes[idx]);
+    }
+
+    return len;
+}
+
+int sai_deserialize_ip4(
+        _In_ const char *buffer,
+        _Out_ sai_ip4_t *ip4)
+{
+    return sai_deserialize_ip(buffer, AF_INET, (uint8_t*)ip4);
+}
+
+int sai_serialize_ip6(
+        _Out_ char *buffer,
+        _In_ const sai_ip6_t ip6)
+{
+    uint32_t words[8];
+    sai_ip4_t ip4;
+    int best = -1;
+    int bestlen = 0;
+    int cur = -1;
+    int len = 0;
+    int idx;
+
+    /*
+     * Output is the same as produced by inet_ntop, longest run of at least
+     * two zero groups is replaced by "::", first one if there are more of the
+     * same length, and ipv4 compatible and mapped addresses end with ipv4.
+     */
+
+    for (idx = 0; idx < 8; idx++)
+    {
+        words[idx] = (uint32_t)(ip6[2 * idx] << 8) | ip6[2 * idx + 1];
+
+        if (words[idx] == 0)
+        {
+            cur = (cur < 0) ? idx : cur;
+
+            if (idx + 1 - cur > bestlen)
+            {
+                best = cur;
+                bestlen = idx + 1 - cur;
+            }
+        }
+        else
+        {
+            cur = -1;
+        }
+    }
+
+    if (bestlen < 2)
+    {
+        best = -1;
+    }
+
+    for (idx = 0; idx < 8; idx++)
+    {
+        if (best >= 0 && idx >= best && idx < best + bestlen)
+        {
+            if (idx == best)
+            {
+                buffer[len++] = ':';
+            }
+
+            continue;
+        }
+
+        if (idx != 0)
+        {
+            buffer[len++] = ':';
+        }
+
+        if (idx == 6 && best == 0 && (bestlen == 6 || (bestlen == 5 && words[5] == 0xffff)))
+        {
+            memcpy(&ip4, ip6 + 12, sizeof(ip4));
+
+            return len + sai_serialize_ip4(buffer + len, ip4);
+        }
+
+        len += sai_serialize_hex_u64(buffer + len, words[idx]);
+    }
+
+    if (best >= 0 && best + bestlen == 8)
+    {
+        buffer[len++] = ':';
+    }
+
+    buffer[len] = 0;
+
+    return len;
+}
+
+int sai_deserialize_ip6(
+        _In_ const char *buffer,
+        _Out_ sai_ip6_t ip6)
+{
+    return sai_deserialize_ip(buffer, AF_INET6, ip6);
+}
+
+int sai_serialize_ip_address(
+        _Out_ char *buffer,
+        _In_ const sai_ip_address_t *ip_address)
+{
+    switch (ip_address->addr_family)
+    {
+        case SAI_IP_ADDR_FAMILY_IPV4:
+
+            return sai_serialize_ip4(buffer, ip_address->addr.ip4);
+
+        case SAI_IP_ADDR_FAMILY_IPV6:
+
+            return sai_serialize_ip6(buffer, ip_address->addr.ip6);
+
+        default:
+
+            SAI_META_LOG_WARN("invalid ip address family: %d", ip_address->addr_family);
+            return SAI_SERIALIZE_ERROR;
     }
 }
 
@@ -861,7 +1287,8 @@ int sai_serialize_ip_prefix(
         _Out_ char *buffer,
         _In_ const sai_ip_prefix_t *ip_prefix)
 {
-    int ret = 0;
+    int addrlen;
+    int masklen;
 
     char addr[PRIMITIVE_BUFFER_SIZE];
     char mask[PRIMITIVE_BUFFER_SIZE];
@@ -870,10 +1297,10 @@ int sai_serialize_ip_prefix(
     {
         case SAI_IP_ADDR_FAMILY_IPV4:
 
-            ret |= sai_serialize_ip4(addr, ip_prefix->addr.ip4);
-            ret |= sai_serialize_ip4_mask(mask, ip_prefix->mask.ip4);
+            addrlen = sai_serialize_ip4(addr, ip_prefix->addr.ip4);
+            masklen = sai_serialize_ip4_mask(mask, ip_prefix->mask.ip4);
 
-            if (ret < 0)
+            if ((addrlen | masklen) < 0)
             {
                 SAI_META_LOG_WARN("failed to serialize ipv4");
                 return SAI_SERIALIZE_ERROR;
@@ -883,10 +1310,10 @@ int sai_serialize_ip_prefix(
 
         case SAI_IP_ADDR_FAMILY_IPV6:
 
-            ret |= sai_serialize_ip6(addr, ip_prefix->addr.ip6);
-            ret |= sai_serialize_ip6_mask(mask, ip_prefix->mask.ip6);
+            addrlen = sai_serialize_ip6(addr, ip_prefix->addr.ip6);
+            masklen = sai_serialize_ip6_mask(mask, ip_prefix->mask.ip6);
 
-            if (ret < 0)
+            if ((addrlen | masklen) < 0)
             {
                 SAI_META_LOG_WARN("failed to serialize ipv6");
                 return SAI_SERIALIZE_ERROR;
@@ -900,7 +1327,13 @@ int sai_serialize_ip_prefix(
             return SAI_SERIALIZE_ERROR;
     }
 
-    return sprintf(buffer, "%s/%s", addr, mask);
+    memcpy(buffer, addr, (size_t)addrlen);
+
+    buffer[addrlen] = '/';
+
+    memcpy(buffer + addrlen + 1, mask, (size_t)masklen + 1);
+
+    return addrlen + 1 + masklen;
 }
 
 int sai_deserialize_ip_prefix(
@@ -1140,20 +1573,20 @@ int sai_serialize_enum_list(
     char *begin_buf = buf;
     int ret;
 
-    buf += sprintf(buf, "{");
+    EMIT("{");
 
-    buf += sprintf(buf, "\"count\":");
-    buf += sprintf(buf, "%d", list->count);
+    EMIT("\"count\":");
+    buf += sai_serialize_uint32(buf, list->count);
 
-    buf += sprintf(buf, ",\"list\":");
+    EMIT(",\"list\":");
 
     if (list->list == NULL || list->count == 0)
     {
-        buf += sprintf(buf, "null");
+        EMIT("null");
     }
     else
     {
-        buf += sprintf(buf, "[");
+        EMIT("[");
 
         uint32_t idx;
 
@@ -1161,10 +1594,10 @@ int sai_serialize_enum_list(
         {
             if (idx != 0)
             {
-                buf += sprintf(buf, ",");
+                EMIT(",");
             }
 
-            buf += sprintf(buf, "\"");
+            EMIT("\"");
 
             ret = sai_serialize_enum(buf, meta, list->list[idx]);
 
@@ -1175,25 +1608,26 @@ int sai_serialize_enum_list(
             }
 
             buf += ret;
-            buf += sprintf(buf, "\"");
+            EMIT("\"");
         }
 
-        buf += sprintf(buf, "]");
+        EMIT("]");
     }
 
-    buf += sprintf(buf, "}");
+    EMIT("}");
 
     return (int)(buf - begin_buf);
 }
 
-int sai_deserialize_enum_list(
+int sai_deserialize_enum_list_ex(
         _In_ const char *buffer,
         _In_ const sai_enum_metadata_t *meta,
-        _Out_ sai_s32_list_t *list)
+        _Out_ sai_s32_list_t *list,
+        _Inout_ sai_deserialize_arena_t *arena)
 {
     if (meta == NULL)
     {
-        return sai_deserialize_s32_list(buffer, list);
+        return sai_deserialize_s32_list_ex(buffer, list, arena);
     }
 
     const char *buf = buffer;
@@ -1216,7 +1650,13 @@ int sai_deserialize_enum_list(
     }
     else
     {
-        list->list = calloc((list->count), sizeof(uint32_t));
+        list->list = sai_deserialize_arena_alloc(arena, list->count, sizeof(int32_t));
+
+        if (list->list == NULL)
+        {
+            SAI_META_LOG_ERROR("failed to allocate list");
+            return SAI_SERIALIZE_ERROR;
+        }
 
         EXPECT("[");
 
@@ -1238,6 +1678,25 @@ int sai_deserialize_enum_list(
     return (int)(buf - buffer);
 }
 
+int sai_deserialize_enum_list(
+        _In_ const char *buffer,
+        _In_ const sai_enum_metadata_t *meta,
+        _Out_ sai_s32_list_t *list)
+{
+    int ret;
+
+    memset(list, 0, sizeof(sai_s32_list_t));
+
+    ret = sai_deserialize_enum_list_ex(buffer, meta, list, NULL);
+
+    if (ret < 0)
+    {
+        sai_deserialize_free_enum_list(meta, list);
+    }
+
+    return ret;
+}
+
 int sai_serialize_attr_id(
         _Out_ char *buf,
         _In_ const sai_attr_metadata_t *meta,
@@ -1281,11 +1740,11 @@ int sai_serialize_attribute(
 
     /* can be auto generated */
 
-    buf += sprintf(buf, "{");
+    EMIT("{");
 
-    buf += sprintf(buf, "\"id\":");
+    EMIT("\"id\":");
 
-    buf += sprintf(buf, "\"");
+    EMIT("\"");
 
     ret = sai_serialize_attr_id(buf, meta, attribute->id);
 
@@ -1297,9 +1756,9 @@ int sai_serialize_attribute(
 
     buf += ret;
 
-    buf += sprintf(buf, "\",");
+    EMIT("\",");
 
-    buf += sprintf(buf, "\"value\":");
+    EMIT("\"value\":");
 
     ret = sai_serialize_attribute_value(buf, meta, &attribute->value);
 
@@ -1311,14 +1770,15 @@ int sai_serialize_attribute(
 
     buf += ret;
 
-    buf += sprintf(buf, "}");
+    EMIT("}");
 
     return (int)(buf - begin_buf);
 }
 
-int sai_deserialize_attribute(
+int sai_deserialize_attribute_ex(
         _In_ const char *buffer,
-        _Out_ sai_attribute_t *attribute)
+        _Out_ sai_attribute_t *attribute,
+        _Inout_ sai_deserialize_arena_t *arena)
 {
     const char *buf = buffer;
     const sai_attr_metadata_t *meta;
@@ -1349,9 +1809,2887 @@ int sai_deserialize_attribute(
 
     EXPECT_NEXT_KEY("value");
 
-    EXPECT_CHECK(sai_deserialize_attribute_value(buf, meta, &attribute->value), "attr_value");
+    if (arena == NULL)
+    {
+        /* value lists allocated before failure will be released */
 
-    EXPECT("}");
+        memset(&attribute->value, 0, sizeof(sai_attribute_value_t));
+    }
+
+    ret = sai_deserialize_attribute_value_ex(buf, meta, &attribute->value, arena);
+
+    if (ret < 0 || buf[ret] != '}')
+    {
+        SAI_META_LOG_WARN("failed to deserialize attribute %s value", meta->attridname);
+
+        if (arena == NULL)
+        {
+            sai_deserialize_free_attribute_value(meta, &attribute->value);
+        }
+
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    buf += ret + 1;
 
     return (int)(buf - buffer);
 }
+
+int sai_deserialize_attribute(
+        _In_ const char *buffer,
+        _Out_ sai_attribute_t *attribute)
+{
+    return sai_deserialize_attribute_ex(buffer, attribute, NULL);
+}
+
+/* Length bounded serialize */
+
+/*
+ * Primitive values are never longer than PRIMITIVE_BUFFER_SIZE characters, so
+ * if there is enough space in output buffer, value is serialized in place,
+ * otherwise it's serialized to local buffer and then truncated.
+ */
+
+#define SERIALIZE_N(fn, value) {                                        \
+    char tmp[PRIMITIVE_BUFFER_SIZE];                                    \
+    if (size >= PRIMITIVE_BUFFER_SIZE) { return fn(buffer, value); }    \
+    return sai_serialize_copy_n(buffer, size, tmp, fn(tmp, value)); }
+
+#define EMIT_N_BUF     ((pos < size) ? (buf + pos) : NULL)
+#define EMIT_N_SIZE    ((pos < size) ? (size - pos) : 0)
+#define EMIT_N(x) {                                                     \
+    if (pos + sizeof(x) <= size) { memcpy(buf + pos, x, sizeof(x)); }   \
+    else if (pos < size) {                                              \
+        memcpy(buf + pos, x, size - pos - 1); buf[size - 1] = 0; }      \
+    pos += sizeof(x) - 1; }
+#define EMIT_N_CHECK(expr, suffix) {                               \
+    ret = (expr);                                                  \
+    if (ret < 0) {                                                 \
+        SAI_META_LOG_WARN("failed to serialize " #suffix "");      \
+        return SAI_SERIALIZE_ERROR; }                              \
+    pos += (size_t)ret; }
+
+static int sai_serialize_copy_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const char *data,
+        _In_ int length)
+{
+    size_t n;
+
+    if (length < 0)
+    {
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    if (size == 0)
+    {
+        return length;
+    }
+
+    n = ((size_t)length < size) ? (size_t)length : (size - 1);
+
+    memcpy(buffer, data, n);
+
+    buffer[n] = 0;
+
+    return length;
+}
+
+int sai_serialize_bool_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ bool flag)
+{
+    SERIALIZE_N(sai_serialize_bool, flag);
+}
+
+int sai_serialize_chardata_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const char data[SAI_CHARDATA_LENGTH])
+{
+    SERIALIZE_N(sai_serialize_chardata, data);
+}
+
+int sai_serialize_uint8_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint8_t u8)
+{
+    SERIALIZE_N(sai_serialize_uint8, u8);
+}
+
+int sai_serialize_int8_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ int8_t s8)
+{
+    SERIALIZE_N(sai_serialize_int8, s8);
+}
+
+int sai_serialize_uint16_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint16_t u16)
+{
+    SERIALIZE_N(sai_serialize_uint16, u16);
+}
+
+int sai_serialize_int16_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ int16_t s16)
+{
+    SERIALIZE_N(sai_serialize_int16, s16);
+}
+
+int sai_serialize_uint32_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint32_t u32)
+{
+    SERIALIZE_N(sai_serialize_uint32, u32);
+}
+
+int sai_serialize_int32_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ int32_t s32)
+{
+    SERIALIZE_N(sai_serialize_int32, s32);
+}
+
+int sai_serialize_uint64_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint64_t u64)
+{
+    SERIALIZE_N(sai_serialize_uint64, u64);
+}
+
+int sai_serialize_int64_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ int64_t s64)
+{
+    SERIALIZE_N(sai_serialize_int64, s64);
+}
+
+int sai_serialize_size_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ sai_size_t value)
+{
+    SERIALIZE_N(sai_serialize_size, value);
+}
+
+int sai_serialize_object_id_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ sai_object_id_t oid)
+{
+    SERIALIZE_N(sai_serialize_object_id, oid);
+}
+
+int sai_serialize_mac_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_mac_t mac)
+{
+    SERIALIZE_N(sai_serialize_mac, mac);
+}
+
+int sai_serialize_encrypt_key_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_encrypt_key_t sak)
+{
+    SERIALIZE_N(sai_serialize_encrypt_key, sak);
+}
+
+int sai_serialize_auth_key_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_auth_key_t auth)
+{
+    SERIALIZE_N(sai_serialize_auth_key, auth);
+}
+
+int sai_serialize_macsec_sak_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_sak_t sak)
+{
+    SERIALIZE_N(sai_serialize_macsec_sak, sak);
+}
+
+int sai_serialize_macsec_auth_key_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_auth_key_t auth)
+{
+    SERIALIZE_N(sai_serialize_macsec_auth_key, auth);
+}
+
+int sai_serialize_macsec_salt_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_salt_t salt)
+{
+    SERIALIZE_N(sai_serialize_macsec_salt, salt);
+}
+
+int sai_serialize_enum_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _In_ int32_t value)
+{
+    const char *name;
+
+    if (meta == NULL)
+    {
+        return sai_serialize_int32_n(buffer, size, value);
+    }
+
+    name = sai_metadata_get_enum_value_name(meta, value);
+
+    if (name != NULL)
+    {
+        return sai_serialize_copy_n(buffer, size, name, (int)strlen(name));
+    }
+
+    SAI_META_LOG_WARN("enum value %d not found in enum %s", value, meta->name);
+
+    return sai_serialize_int32_n(buffer, size, value);
+}
+
+int sai_serialize_ip4_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ sai_ip4_t ip4)
+{
+    SERIALIZE_N(sai_serialize_ip4, ip4);
+}
+
+int sai_serialize_ip6_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip6_t ip6)
+{
+    SERIALIZE_N(sai_serialize_ip6, ip6);
+}
+
+int sai_serialize_ip_address_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip_address_t *ip_address)
+{
+    SERIALIZE_N(sai_serialize_ip_address, ip_address);
+}
+
+int sai_serialize_ip_prefix_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip_prefix_t *ip_prefix)
+{
+    SERIALIZE_N(sai_serialize_ip_prefix, ip_prefix);
+}
+
+int sai_serialize_ip4_mask_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ sai_ip4_t ip4_mask)
+{
+    SERIALIZE_N(sai_serialize_ip4_mask, ip4_mask);
+}
+
+int sai_serialize_ip6_mask_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip6_t ip6_mask)
+{
+    SERIALIZE_N(sai_serialize_ip6_mask, ip6_mask);
+}
+
+int sai_serialize_pointer_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_pointer_t pointer)
+{
+    SERIALIZE_N(sai_serialize_pointer, pointer);
+}
+
+int sai_serialize_enum_list_n(
+        _Out_ char *buf,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _In_ const sai_s32_list_t *list)
+{
+    if (meta == NULL)
+    {
+        return sai_serialize_s32_list_n(buf, size, list);
+    }
+
+    size_t pos = 0;
+    int ret;
+
+    EMIT_N("{");
+
+    EMIT_N("\"count\":");
+    EMIT_N_CHECK(sai_serialize_uint32_n(EMIT_N_BUF, EMIT_N_SIZE, list->count), uint32);
+
+    EMIT_N(",\"list\":");
+
+    if (list->list == NULL || list->count == 0)
+    {
+        EMIT_N("null");
+    }
+    else
+    {
+        EMIT_N("[");
+
+        uint32_t idx;
+
+        for (idx = 0; idx < list->count; idx++)
+        {
+            if (idx != 0)
+            {
+                EMIT_N(",");
+            }
+
+            EMIT_N("\"");
+            EMIT_N_CHECK(sai_serialize_enum_n(EMIT_N_BUF, EMIT_N_SIZE, meta, list->list[idx]), enum);
+            EMIT_N("\"");
+        }
+
+        EMIT_N("]");
+    }
+
+    EMIT_N("}");
+
+    return (int)pos;
+}
+
+int sai_serialize_attr_id_n(
+        _Out_ char *buf,
+        _In_ size_t size,
+        _In_ const sai_attr_metadata_t *meta,
+        _In_ sai_attr_id_t attr_id)
+{
+    if (meta != NULL)
+    {
+        return sai_serialize_copy_n(buf, size, meta->attridname, (int)strlen(meta->attridname));
+    }
+
+    SAI_META_LOG_WARN("failed to serialize attr_id");
+    return SAI_SERIALIZE_ERROR;
+}
+
+int sai_serialize_attribute_n(
+        _Out_ char *buf,
+        _In_ size_t size,
+        _In_ const sai_attr_metadata_t *meta,
+        _In_ const sai_attribute_t *attribute)
+{
+    size_t pos = 0;
+    int ret;
+
+    EMIT_N("{");
+
+    EMIT_N("\"id\":\"");
+    EMIT_N_CHECK(sai_serialize_attr_id_n(EMIT_N_BUF, EMIT_N_SIZE, meta, attribute->id), attr_id);
+    EMIT_N("\",");
+
+    EMIT_N("\"value\":");
+    EMIT_N_CHECK(sai_serialize_attribute_value_n(EMIT_N_BUF, EMIT_N_SIZE, meta, &attribute->value), attribute_value);
+
+    EMIT_N("}");
+
+    return (int)pos;
+}
+
+int sai_serialize_attribute_value_length(
+        _In_ const sai_attr_metadata_t *meta,
+        _In_ const sai_attribute_value_t *value)
+{
+    return sai_serialize_attribute_value_n(NULL, 0, meta, value);
+}
+
+/* Binary serialize */
+
+/*
+ * Binary format uses fixed size little endian integers, fixed size arrays and
+ * IP addresses are copied as is (IP addresses are in network order). Each
+ * serialize method returns number of bytes needed to serialize value, and
+ * value is written only when it fits in buffer, so serialize can be called
+ * with NULL buffer and zero size to obtain required length.
+ */
+
+#define BIN_BUF     ((pos < size) ? (buf + pos) : NULL)
+#define BIN_SIZE    ((pos < size) ? (size - pos) : 0)
+#define BIN_CHECK(expr, suffix) {                                  \
+    ret = (expr);                                                  \
+    if (ret < 0) {                                                 \
+        SAI_META_LOG_WARN("failed to serialize binary " #suffix ""); \
+        return SAI_SERIALIZE_ERROR; }                              \
+    pos += (size_t)ret; }
+#define BIN_EXPECT_CHECK(expr, suffix) {                           \
+    ret = (expr);                                                  \
+    if (ret < 0) {                                                 \
+        SAI_META_LOG_WARN("failed to deserialize binary " #suffix ""); \
+        return SAI_SERIALIZE_ERROR; }                              \
+    pos += (size_t)ret; }
+
+#define DESERIALIZE_BINARY_LE(type, value) {                            \
+    uint64_t tmp;                                                       \
+    int ret = sai_deserialize_binary_le(buffer, size, sizeof(type), &tmp); \
+    if (ret >= 0) { *(value) = (type)tmp; }                             \
+    return ret; }
+
+#define SAI_SERIALIZE_BINARY_ATTR_HEADER_SIZE (2 * sizeof(uint32_t))
+
+static int sai_serialize_binary_le(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ size_t length,
+        _In_ uint64_t value)
+{
+    size_t idx;
+
+    if (buffer != NULL && size >= length)
+    {
+        for (idx = 0; idx < length; idx++)
+        {
+            buffer[idx] = (uint8_t)(value >> (8 * idx));
+        }
+    }
+
+    return (int)length;
+}
+
+static int sai_deserialize_binary_le(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ size_t length,
+        _Out_ uint64_t *value)
+{
+    size_t idx;
+
+    if (size < length)
+    {
+        SAI_META_LOG_WARN("expected %d bytes but only %d left in binary buffer", (int)length, (int)size);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    *value = 0;
+
+    for (idx = 0; idx < length; idx++)
+    {
+        *value |= (uint64_t)buffer[idx] << (8 * idx);
+    }
+
+    return (int)length;
+}
+
+static int sai_serialize_binary_bytes(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ size_t length,
+        _In_ const void *data)
+{
+    if (buffer != NULL && size >= length)
+    {
+        memcpy(buffer, data, length);
+    }
+
+    return (int)length;
+}
+
+static int sai_deserialize_binary_bytes(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ size_t length,
+        _Out_ void *data)
+{
+    if (size < length)
+    {
+        SAI_META_LOG_WARN("expected %d bytes but only %d left in binary buffer", (int)length, (int)size);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    memcpy(data, buffer, length);
+
+    return (int)length;
+}
+
+int sai_serialize_binary_bool(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ bool flag)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(uint8_t), flag ? 1 : 0);
+}
+
+int sai_deserialize_binary_bool(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ bool *flag)
+{
+    uint64_t tmp;
+
+    int ret = sai_deserialize_binary_le(buffer, size, sizeof(uint8_t), &tmp);
+
+    if (ret < 0)
+    {
+        return ret;
+    }
+
+    if (tmp > 1)
+    {
+        SAI_META_LOG_WARN("failed to deserialize binary bool value %u", (uint32_t)tmp);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    *flag = (tmp == 1);
+
+    return ret;
+}
+
+int sai_serialize_binary_chardata(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const char data[SAI_CHARDATA_LENGTH])
+{
+    return sai_serialize_binary_bytes(buffer, size, SAI_CHARDATA_LENGTH, data);
+}
+
+int sai_deserialize_binary_chardata(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ char data[SAI_CHARDATA_LENGTH])
+{
+    return sai_deserialize_binary_bytes(buffer, size, SAI_CHARDATA_LENGTH, data);
+}
+
+int sai_serialize_binary_uint8(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ uint8_t u8)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(u8), u8);
+}
+
+int sai_deserialize_binary_uint8(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ uint8_t *u8)
+{
+    DESERIALIZE_BINARY_LE(uint8_t, u8);
+}
+
+int sai_serialize_binary_int8(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ int8_t s8)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(s8), (uint64_t)s8);
+}
+
+int sai_deserialize_binary_int8(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ int8_t *s8)
+{
+    DESERIALIZE_BINARY_LE(int8_t, s8);
+}
+
+int sai_serialize_binary_uint16(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ uint16_t u16)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(u16), u16);
+}
+
+int sai_deserialize_binary_uint16(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ uint16_t *u16)
+{
+    DESERIALIZE_BINARY_LE(uint16_t, u16);
+}
+
+int sai_serialize_binary_int16(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ int16_t s16)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(s16), (uint64_t)s16);
+}
+
+int sai_deserialize_binary_int16(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ int16_t *s16)
+{
+    DESERIALIZE_BINARY_LE(int16_t, s16);
+}
+
+int sai_serialize_binary_uint32(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ uint32_t u32)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(u32), u32);
+}
+
+int sai_deserialize_binary_uint32(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ uint32_t *u32)
+{
+    DESERIALIZE_BINARY_LE(uint32_t, u32);
+}
+
+int sai_serialize_binary_int32(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ int32_t s32)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(s32), (uint64_t)s32);
+}
+
+int sai_deserialize_binary_int32(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ int32_t *s32)
+{
+    DESERIALIZE_BINARY_LE(int32_t, s32);
+}
+
+int sai_serialize_binary_uint64(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ uint64_t u64)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(u64), u64);
+}
+
+int sai_deserialize_binary_uint64(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ uint64_t *u64)
+{
+    DESERIALIZE_BINARY_LE(uint64_t, u64);
+}
+
+int sai_serialize_binary_int64(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ int64_t s64)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(s64), (uint64_t)s64);
+}
+
+int sai_deserialize_binary_int64(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ int64_t *s64)
+{
+    DESERIALIZE_BINARY_LE(int64_t, s64);
+}
+
+int sai_serialize_binary_size(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ sai_size_t value)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(uint64_t), value);
+}
+
+int sai_deserialize_binary_size(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_size_t *value)
+{
+    DESERIALIZE_BINARY_LE(sai_size_t, value);
+}
+
+int sai_serialize_binary_object_id(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ sai_object_id_t oid)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(oid), oid);
+}
+
+int sai_deserialize_binary_object_id(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_object_id_t *oid)
+{
+    DESERIALIZE_BINARY_LE(sai_object_id_t, oid);
+}
+
+int sai_serialize_binary_mac(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_mac_t mac)
+{
+    return sai_serialize_binary_bytes(buffer, size, sizeof(sai_mac_t), mac);
+}
+
+int sai_deserialize_binary_mac(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_mac_t mac)
+{
+    return sai_deserialize_binary_bytes(buffer, size, sizeof(sai_mac_t), mac);
+}
+
+int sai_serialize_binary_encrypt_key(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_encrypt_key_t sak)
+{
+    return sai_serialize_binary_bytes(buffer, size, sizeof(sai_encrypt_key_t), sak);
+}
+
+int sai_deserialize_binary_encrypt_key(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_encrypt_key_t sak)
+{
+    return sai_deserialize_binary_bytes(buffer, size, sizeof(sai_encrypt_key_t), sak);
+}
+
+int sai_serialize_binary_auth_key(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_auth_key_t auth)
+{
+    return sai_serialize_binary_bytes(buffer, size, sizeof(sai_auth_key_t), auth);
+}
+
+int sai_deserialize_binary_auth_key(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_auth_key_t auth)
+{
+    return sai_deserialize_binary_bytes(buffer, size, sizeof(sai_auth_key_t), auth);
+}
+
+int sai_serialize_binary_macsec_sak(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_sak_t sak)
+{
+    return sai_serialize_binary_bytes(buffer, size, sizeof(sai_macsec_sak_t), sak);
+}
+
+int sai_deserialize_binary_macsec_sak(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_macsec_sak_t sak)
+{
+    return sai_deserialize_binary_bytes(buffer, size, sizeof(sai_macsec_sak_t), sak);
+}
+
+int sai_serialize_binary_macsec_auth_key(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_auth_key_t auth)
+{
+    return sai_serialize_binary_bytes(buffer, size, sizeof(sai_macsec_auth_key_t), auth);
+}
+
+int sai_deserialize_binary_macsec_auth_key(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_macsec_auth_key_t auth)
+{
+    return sai_deserialize_binary_bytes(buffer, size, sizeof(sai_macsec_auth_key_t), auth);
+}
+
+int sai_serialize_binary_macsec_salt(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_salt_t salt)
+{
+    return sai_serialize_binary_bytes(buffer, size, sizeof(sai_macsec_salt_t), salt);
+}
+
+int sai_deserialize_binary_macsec_salt(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_macsec_salt_t salt)
+{
+    return sai_deserialize_binary_bytes(buffer, size, sizeof(sai_macsec_salt_t), salt);
+}
+
+int sai_serialize_binary_enum(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _In_ int32_t value)
+{
+    /* enum names are not needed, value is serialized as number */
+
+    return sai_serialize_binary_int32(buffer, size, value);
+}
+
+int sai_deserialize_binary_enum(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _Out_ int32_t *value)
+{
+    return sai_deserialize_binary_int32(buffer, size, value);
+}
+
+int sai_serialize_binary_ip4(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ sai_ip4_t ip4)
+{
+    return sai_serialize_binary_bytes(buffer, size, sizeof(sai_ip4_t), &ip4);
+}
+
+int sai_deserialize_binary_ip4(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_ip4_t *ip4)
+{
+    return sai_deserialize_binary_bytes(buffer, size, sizeof(sai_ip4_t), ip4);
+}
+
+int sai_serialize_binary_ip6(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip6_t ip6)
+{
+    return sai_serialize_binary_bytes(buffer, size, sizeof(sai_ip6_t), ip6);
+}
+
+int sai_deserialize_binary_ip6(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_ip6_t ip6)
+{
+    return sai_deserialize_binary_bytes(buffer, size, sizeof(sai_ip6_t), ip6);
+}
+
+int sai_serialize_binary_ip_address(
+        _Out_ uint8_t *buf,
+        _In_ size_t size,
+        _In_ const sai_ip_address_t *ip_address)
+{
+    size_t pos = 0;
+    int ret;
+
+    BIN_CHECK(sai_serialize_binary_int32(BIN_BUF, BIN_SIZE, ip_address->addr_family), ip_addr_family);
+
+    switch (ip_address->addr_family)
+    {
+        case SAI_IP_ADDR_FAMILY_IPV4:
+
+            BIN_CHECK(sai_serialize_binary_ip4(BIN_BUF, BIN_SIZE, ip_address->addr.ip4), ip4);
+            break;
+
+        case SAI_IP_ADDR_FAMILY_IPV6:
+
+            BIN_CHECK(sai_serialize_binary_ip6(BIN_BUF, BIN_SIZE, ip_address->addr.ip6), ip6);
+            break;
+
+        default:
+
+            SAI_META_LOG_WARN("invalid ip address family: %d", ip_address->addr_family);
+            return SAI_SERIALIZE_ERROR;
+    }
+
+    return (int)pos;
+}
+
+int sai_deserialize_binary_ip_address(
+        _In_ const uint8_t *buf,
+        _In_ size_t size,
+        _Out_ sai_ip_address_t *ip_address)
+{
+    size_t pos = 0;
+    int ret;
+
+    BIN_EXPECT_CHECK(sai_deserialize_binary_int32(buf, size, (int32_t*)&ip_address->addr_family), ip_addr_family);
+
+    switch (ip_address->addr_family)
+    {
+        case SAI_IP_ADDR_FAMILY_IPV4:
+
+            BIN_EXPECT_CHECK(sai_deserialize_binary_ip4(buf + pos, size - pos, &ip_address->addr.ip4), ip4);
+            break;
+
+        case SAI_IP_ADDR_FAMILY_IPV6:
+
+            BIN_EXPECT_CHECK(sai_deserialize_binary_ip6(buf + pos, size - pos, ip_address->addr.ip6), ip6);
+            break;
+
+        default:
+
+            SAI_META_LOG_WARN("invalid ip address family: %d", ip_address->addr_family);
+            return SAI_SERIALIZE_ERROR;
+    }
+
+    return (int)pos;
+}
+
+int sai_serialize_binary_ip_prefix(
+        _Out_ uint8_t *buf,
+        _In_ size_t size,
+        _In_ const sai_ip_prefix_t *ip_prefix)
+{
+    size_t pos = 0;
+    int ret;
+
+    BIN_CHECK(sai_serialize_binary_int32(BIN_BUF, BIN_SIZE, ip_prefix->addr_family), ip_addr_family);
+
+    switch (ip_prefix->addr_family)
+    {
+        case SAI_IP_ADDR_FAMILY_IPV4:
+
+            BIN_CHECK(sai_serialize_binary_ip4(BIN_BUF, BIN_SIZE, ip_prefix->addr.ip4), ip4);
+            BIN_CHECK(sai_serialize_binary_ip4(BIN_BUF, BIN_SIZE, ip_prefix->mask.ip4), ip4);
+            break;
+
+        case SAI_IP_ADDR_FAMILY_IPV6:
+
+            BIN_CHECK(sai_serialize_binary_ip6(BIN_BUF, BIN_SIZE, ip_prefix->addr.ip6), ip6);
+            BIN_CHECK(sai_serialize_binary_ip6(BIN_BUF, BIN_SIZE, ip_prefix->mask.ip6), ip6);
+            break;
+
+        default:
+
+            SAI_META_LOG_WARN("invalid ip prefix family: %d", ip_prefix->addr_family);
+            return SAI_SERIALIZE_ERROR;
+    }
+
+    return (int)pos;
+}
+
+int sai_deserialize_binary_ip_prefix(
+        _In_ const uint8_t *buf,
+        _In_ size_t size,
+        _Out_ sai_ip_prefix_t *ip_prefix)
+{
+    size_t pos = 0;
+    int ret;
+
+    BIN_EXPECT_CHECK(sai_deserialize_binary_int32(buf, size, (int32_t*)&ip_prefix->addr_family), ip_addr_family);
+
+    switch (ip_prefix->addr_family)
+    {
+        case SAI_IP_ADDR_FAMILY_IPV4:
+
+            BIN_EXPECT_CHECK(sai_deserialize_binary_ip4(buf + pos, size - pos, &ip_prefix->addr.ip4), ip4);
+            BIN_EXPECT_CHECK(sai_deserialize_binary_ip4(buf + pos, size - pos, &ip_prefix->mask.ip4), ip4);
+            break;
+
+        case SAI_IP_ADDR_FAMILY_IPV6:
+
+            BIN_EXPECT_CHECK(sai_deserialize_binary_ip6(buf + pos, size - pos, ip_prefix->addr.ip6), ip6);
+            BIN_EXPECT_CHECK(sai_deserialize_binary_ip6(buf + pos, size - pos, ip_prefix->mask.ip6), ip6);
+            break;
+
+        default:
+
+            SAI_META_LOG_WARN("invalid ip prefix family: %d", ip_prefix->addr_family);
+            return SAI_SERIALIZE_ERROR;
+    }
+
+    return (int)pos;
+}
+
+int sai_serialize_binary_pointer(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_pointer_t pointer)
+{
+    return sai_serialize_binary_le(buffer, size, sizeof(uint64_t), (uint64_t)(uintptr_t)pointer);
+}
+
+int sai_deserialize_binary_pointer(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_pointer_t *pointer)
+{
+    uint64_t tmp;
+
+    int ret = sai_deserialize_binary_le(buffer, size, sizeof(uint64_t), &tmp);
+
+    if (ret >= 0)
+    {
+        *pointer = (sai_pointer_t)(uintptr_t)tmp;
+    }
+
+    return ret;
+}
+
+int sai_serialize_binary_enum_list(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _In_ const sai_s32_list_t *list)
+{
+    /* enums are serialized as numbers, so layout is the same as s32 list */
+
+    return sai_serialize_binary_s32_list(buffer, size, list);
+}
+
+int sai_deserialize_binary_enum_list(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _Out_ sai_s32_list_t *list)
+{
+    return sai_deserialize_binary_s32_list(buffer, size, list);
+}
+
+int sai_deserialize_binary_enum_list_ex(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _Out_ sai_s32_list_t *list,
+        _Inout_ sai_deserialize_arena_t *arena)
+{
+    return sai_deserialize_binary_s32_list_ex(buffer, size, list, arena);
+}
+
+void sai_deserialize_free_enum_list(
+        _In_ const sai_enum_metadata_t *meta,
+        _Inout_ sai_s32_list_t *list)
+{
+    sai_deserialize_free_s32_list(list);
+}
+
+int sai_serialize_binary_attribute(
+        _Out_ uint8_t *buf,
+        _In_ size_t size,
+        _In_ const sai_attr_metadata_t *meta,
+        _In_ const sai_attribute_t *attribute)
+{
+    size_t pos = 0;
+    int ret;
+
+    if (meta == NULL)
+    {
+        SAI_META_LOG_WARN("failed to serialize binary attribute %u, metadata is NULL", attribute->id);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    /*
+     * Attribute is serialized as id, value length and value, so attributes
+     * unknown to reader can be skipped.
+     */
+
+    BIN_CHECK(sai_serialize_binary_uint32(BIN_BUF, BIN_SIZE, attribute->id), attr_id);
+    BIN_CHECK(sai_serialize_binary_uint32(BIN_BUF, BIN_SIZE, 0), uint32);
+    BIN_CHECK(sai_serialize_binary_attribute_value(BIN_BUF, BIN_SIZE, meta, &attribute->value), attribute_value);
+
+    if (pos <= size)
+    {
+        /* whole attribute fits in buffer, update value length */
+
+        sai_serialize_binary_uint32(buf + sizeof(uint32_t), sizeof(uint32_t),
+                (uint32_t)(pos - SAI_SERIALIZE_BINARY_ATTR_HEADER_SIZE));
+    }
+
+    return (int)pos;
+}
+
+int sai_deserialize_binary_attribute_ex(
+        _In_ const uint8_t *buf,
+        _In_ size_t size,
+        _In_ sai_object_type_t object_type,
+        _Out_ sai_attribute_t *attribute,
+        _Inout_ sai_deserialize_arena_t *arena)
+{
+    const sai_attr_metadata_t *meta;
+    size_t pos = 0;
+    uint32_t length;
+    int ret;
+
+    BIN_EXPECT_CHECK(sai_deserialize_binary_uint32(buf, size, &attribute->id), attr_id);
+    BIN_EXPECT_CHECK(sai_deserialize_binary_uint32(buf + pos, size - pos, &length), uint32);
+
+    if (length > size - pos)
+    {
+        SAI_META_LOG_WARN("attribute value length %u exceeds binary buffer size", length);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    meta = sai_metadata_get_attr_metadata(object_type, attribute->id);
+
+    if (meta == NULL)
+    {
+        SAI_META_LOG_WARN("failed to find metadata for attribute %u on object type %d", attribute->id, object_type);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    if (arena == NULL)
+    {
+        /* value lists allocated before failure will be released */
+
+        memset(&attribute->value, 0, sizeof(sai_attribute_value_t));
+    }
+
+    ret = sai_deserialize_binary_attribute_value_ex(buf + pos, length, meta, &attribute->value, arena);
+
+    if (ret < 0 || (size_t)ret != length)
+    {
+        SAI_META_LOG_WARN("attribute %s value length %u don't match deserialized length", meta->attridname, length);
+
+        if (arena == NULL)
+        {
+            sai_deserialize_free_attribute(meta, attribute);
+        }
+
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    pos += length;
+
+    return (int)pos;
+}
+
+int sai_deserialize_binary_attribute(
+        _In_ const uint8_t *buf,
+        _In_ size_t size,
+        _In_ sai_object_type_t object_type,
+        _Out_ sai_attribute_t *attribute)
+{
+    return sai_deserialize_binary_attribute_ex(buf, size, object_type, attribute, NULL);
+}
+
+void sai_deserialize_free_attribute(
+        _In_ const sai_attr_metadata_t *meta,
+        _Inout_ sai_attribute_t *attribute)
+{
+    if (meta == NULL)
+    {
+        SAI_META_LOG_WARN("failed to free attribute %u, metadata is NULL", attribute->id);
+        return;
+    }
+
+    sai_deserialize_free_attribute_value(meta, &attribute->value);
+}
+
+int sai_serialize_binary_object(
+        _Out_ uint8_t *buf,
+        _In_ size_t size,
+        _In_ const sai_object_meta_key_t *meta_key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    const sai_attr_metadata_t *meta;
+    size_t pos = 0;
+    uint32_t idx;
+    int ret;
+
+    BIN_CHECK(sai_serialize_binary_uint32(BIN_BUF, BIN_SIZE, SAI_SERIALIZE_BINARY_MAGIC), uint32);
+    BIN_CHECK(sai_serialize_binary_uint32(BIN_BUF, BIN_SIZE, SAI_SERIALIZE_BINARY_VERSION), uint32);
+    BIN_CHECK(sai_serialize_binary_object_meta_key(BIN_BUF, BIN_SIZE, meta_key), object_meta_key);
+    BIN_CHECK(sai_serialize_binary_uint32(BIN_BUF, BIN_SIZE, attr_count), uint32);
+
+    for (idx = 0; idx < attr_count; idx++)
+    {
+        meta = sai_metadata_get_attr_metadata(meta_key->objecttype, attr_list[idx].id);
+
+        BIN_CHECK(sai_serialize_binary_attribute(BIN_BUF, BIN_SIZE, meta, &attr_list[idx]), attribute);
+    }
+
+    return (int)pos;
+}
+
+int sai_deserialize_binary_object(
+        _In_ const uint8_t *buf,
+        _In_ size_t size,
+        _Out_ sai_object_meta_key_t *meta_key,
+        _Out_ uint32_t *attr_count,
+        _Out_ sai_attribute_t **attr_list)
+{
+    sai_attribute_t *list;
+    size_t pos = 0;
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t length;
+    uint32_t attr_id;
+    uint32_t idx;
+    uint32_t n = 0;
+    int ret;
+
+    *attr_count = 0;
+    *attr_list = NULL;
+
+    BIN_EXPECT_CHECK(sai_deserialize_binary_uint32(buf, size, &magic), uint32);
+
+    if (magic != SAI_SERIALIZE_BINARY_MAGIC)
+    {
+        SAI_META_LOG_WARN("invalid binary object magic 0x%x", magic);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    BIN_EXPECT_CHECK(sai_deserialize_binary_uint32(buf + pos, size - pos, &version), uint32);
+
+    if (version > SAI_SERIALIZE_BINARY_VERSION)
+    {
+        SAI_META_LOG_WARN("binary object version %u is not supported, max supported is %u",
+                version, SAI_SERIALIZE_BINARY_VERSION);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    BIN_EXPECT_CHECK(sai_deserialize_binary_object_meta_key(buf + pos, size - pos, meta_key), object_meta_key);
+    BIN_EXPECT_CHECK(sai_deserialize_binary_uint32(buf + pos, size - pos, &count), uint32);
+
+    if (count > (size - pos) / SAI_SERIALIZE_BINARY_ATTR_HEADER_SIZE)
+    {
+        SAI_META_LOG_WARN("attribute count %u exceeds binary buffer size", count);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    if (count == 0)
+    {
+        return (int)pos;
+    }
+
+    list = calloc(count, sizeof(sai_attribute_t));
+
+    if (list == NULL)
+    {
+        SAI_META_LOG_ERROR("failed to allocate attribute list");
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    for (idx = 0; idx < count; idx++)
+    {
+        if (sai_deserialize_binary_uint32(buf + pos, size - pos, &attr_id) < 0 ||
+                sai_deserialize_binary_uint32(buf + pos + sizeof(uint32_t), size - pos - sizeof(uint32_t), &length) < 0 ||
+                length > size - pos - SAI_SERIALIZE_BINARY_ATTR_HEADER_SIZE)
+        {
+            SAI_META_LOG_WARN("failed to deserialize binary attribute header");
+
+            sai_deserialize_free_binary_object(meta_key, n, list);
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        if (sai_metadata_get_attr_metadata(meta_key->objecttype, attr_id) == NULL)
+        {
+            /* attribute was serialized by newer version, skip it */
+
+            SAI_META_LOG_NOTICE("skipping unknown attribute %u on object type %d", attr_id, meta_key->objecttype);
+
+            pos += SAI_SERIALIZE_BINARY_ATTR_HEADER_SIZE + length;
+            continue;
+        }
+
+        ret = sai_deserialize_binary_attribute(buf + pos, size - pos, meta_key->objecttype, &list[n]);
+
+        if (ret < 0)
+        {
+            SAI_META_LOG_WARN("failed to deserialize binary attribute %u", attr_id);
+
+            sai_deserialize_free_binary_object(meta_key, n, list);
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        pos += (size_t)ret;
+        n++;
+    }
+
+    *attr_count = n;
+    *attr_list = list;
+
+    return (int)pos;
+}
+
+void sai_deserialize_free_binary_object(
+        _Inout_ sai_object_meta_key_t *meta_key,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+{
+    uint32_t idx;
+
+    sai_deserialize_free_object_meta_key(meta_key);
+
+    if (attr_list == NULL)
+    {
+        return;
+    }
+
+    for (idx = 0; idx < attr_count; idx++)
+    {
+        sai_deserialize_free_attribute(
+                sai_metadata_get_attr_metadata(meta_key->objecttype, attr_list[idx].id),
+                &attr_list[idx]);
+    }
+
+    free(attr_list);
+}
+
+/* Binary and json object conversion */
+
+#define SAI_JSON_ATTR_ID_PREFIX "{\"id\":\""
+
+static int sai_serialize_json_object_n(
+        _Out_ char *buf,
+        _In_ size_t size,
+        _In_ const sai_object_meta_key_t *meta_key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    const sai_attr_metadata_t *meta;
+    size_t pos = 0;
+    uint32_t idx;
+    int ret;
+
+    EMIT_N("{\"key\":");
+    EMIT_N_CHECK(sai_serialize_object_meta_key_n(EMIT_N_BUF, EMIT_N_SIZE, meta_key), object_meta_key);
+    EMIT_N(",\"attributes\":[");
+
+    for (idx = 0; idx < attr_count; idx++)
+    {
+        if (idx != 0)
+        {
+            EMIT_N(",");
+        }
+
+        meta = sai_metadata_get_attr_metadata(meta_key->objecttype, attr_list[idx].id);
+
+        EMIT_N_CHECK(sai_serialize_attribute_n(EMIT_N_BUF, EMIT_N_SIZE, meta, &attr_list[idx]), attribute);
+    }
+
+    EMIT_N("]}");
+
+    return (int)pos;
+}
+
+static int sai_deserialize_json_object(
+        _In_ const char *buffer,
+        _Out_ sai_object_meta_key_t *meta_key,
+        _Inout_ uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list)
+{
+    const sai_attr_metadata_t *meta;
+    const char *buf = buffer;
+    sai_attribute_t *list;
+    uint32_t capacity = 0;
+    int ret;
+
+    /* attributes deserialized so far are returned even on failure */
+
+    EXPECT("{");
+    EXPECT_KEY("key");
+    EXPECT_CHECK(sai_deserialize_object_meta_key(buf, meta_key), object_meta_key);
+    EXPECT_NEXT_KEY("attributes");
+    EXPECT("[");
+
+    while (*buf != ']')
+    {
+        if (*attr_count != 0)
+        {
+            EXPECT(",");
+        }
+
+        if (*attr_count == capacity)
+        {
+            capacity = (capacity == 0) ? 8 : (capacity * 2);
+
+            list = realloc(*attr_list, capacity * sizeof(sai_attribute_t));
+
+            if (list == NULL)
+            {
+                SAI_META_LOG_ERROR("failed to allocate attribute list");
+                return SAI_SERIALIZE_ERROR;
+            }
+
+            *attr_list = list;
+        }
+
+        /*
+         * Attribute id names are unique across all object types, so attribute
+         * object type must be checked before value is deserialized, since
+         * same metadata is needed to release it.
+         */
+
+        if (strncmp(buf, SAI_JSON_ATTR_ID_PREFIX, sizeof(SAI_JSON_ATTR_ID_PREFIX) - 1) == 0)
+        {
+            meta = sai_metadata_get_attr_metadata_by_attr_id_name_ext(buf + sizeof(SAI_JSON_ATTR_ID_PREFIX) - 1);
+
+            if (meta != NULL && meta->objecttype != meta_key->objecttype)
+            {
+                SAI_META_LOG_WARN("attribute %s don't belong to object type %d", meta->attridname, meta_key->objecttype);
+                return SAI_SERIALIZE_ERROR;
+            }
+        }
+
+        list = *attr_list;
+
+        EXPECT_CHECK(sai_deserialize_attribute(buf, &list[*attr_count]), attribute);
+
+        (*attr_count)++;
+    }
+
+    EXPECT("]");
+    EXPECT("}");
+
+    return (int)(buf - buffer);
+}
+
+int sai_deserialize_binary_object_to_json(
+        _Out_ char *json,
+        _In_ size_t json_size,
+        _In_ const uint8_t *buffer,
+        _In_ size_t size)
+{
+    sai_object_meta_key_t meta_key;
+    sai_attribute_t *attr_list;
+    uint32_t attr_count;
+    int ret;
+
+    if (sai_deserialize_binary_object(buffer, size, &meta_key, &attr_count, &attr_list) < 0)
+    {
+        SAI_META_LOG_WARN("failed to deserialize binary object");
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    ret = sai_serialize_json_object_n(json, json_size, &meta_key, attr_count, attr_list);
+
+    sai_deserialize_free_binary_object(&meta_key, attr_count, attr_list);
+
+    return ret;
+}
+
+int sai_deserialize_json_object_to_binary(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const char *json)
+{
+    sai_object_meta_key_t meta_key;
+    sai_attribute_t *attr_list = NULL;
+    uint32_t attr_count = 0;
+    int ret;
+
+    memset(&meta_key, 0, sizeof(meta_key));
+
+    ret = sai_deserialize_json_object(json, &meta_key, &attr_count, &attr_list);
+
+    if (ret < 0)
+    {
+        SAI_META_LOG_WARN("failed to deserialize json object");
+    }
+    else
+    {
+        ret = sai_serialize_binary_object(buffer, size, &meta_key, attr_count, attr_list);
+    }
+
+    sai_deserialize_free_binary_object(&meta_key, attr_count, attr_list);
+
+    return ret;
+}
+
+/* Deserialize arena */
+
+#define SAI_DESERIALIZE_ARENA_ALIGN(x)      (((x) + 15) & ~(size_t)15)
+#define SAI_DESERIALIZE_ARENA_BLOCK_SIZE    4096
+
+typedef struct _sai_deserialize_arena_block_t
+{
+    struct _sai_deserialize_arena_block_t *next;
+
+    size_t capacity;
+
+} sai_deserialize_arena_block_t;
+
+#define SAI_DESERIALIZE_ARENA_HEADER_SIZE   SAI_DESERIALIZE_ARENA_ALIGN(sizeof(sai_deserialize_arena_block_t))
+#define SAI_DESERIALIZE_ARENA_DATA(b)       ((uint8_t*)(b) + SAI_DESERIALIZE_ARENA_HEADER_SIZE)
+
+void sai_deserialize_arena_init(
+        _Out_ sai_deserialize_arena_t *arena,
+        _In_ size_t block_size)
+{
+    memset(arena, 0, sizeof(sai_deserialize_arena_t));
+
+    arena->blocksize = (block_size == 0) ? SAI_DESERIALIZE_ARENA_BLOCK_SIZE : block_size;
+}
+
+void *sai_deserialize_arena_alloc(
+        _Inout_ sai_deserialize_arena_t *arena,
+        _In_ size_t count,
+        _In_ size_t size)
+{
+    sai_deserialize_arena_block_t *block;
+    size_t bytes;
+    size_t capacity;
+    uint8_t *ptr;
+
+    if (arena == NULL)
+    {
+        /* calloc may return NULL for empty list, which would look like failure */
+
+        return calloc((count == 0) ? 1 : count, size);
+    }
+
+    if (size != 0 && count > (SIZE_MAX - SAI_DESERIALIZE_ARENA_HEADER_SIZE - 15) / size)
+    {
+        SAI_META_LOG_ERROR("arena allocation of %u items of size %u is too large", (uint32_t)count, (uint32_t)size);
+        return NULL;
+    }
+
+    bytes = SAI_DESERIALIZE_ARENA_ALIGN(count * size);
+
+    if (arena->blocks == NULL || bytes > arena->capacity - arena->used)
+    {
+        capacity = (bytes > arena->blocksize) ? bytes : arena->blocksize;
+
+        block = (sai_deserialize_arena_block_t*)malloc(SAI_DESERIALIZE_ARENA_HEADER_SIZE + capacity);
+
+        if (block == NULL)
+        {
+            return NULL;
+        }
+
+        block->capacity = capacity;
+
+        arena->blockcount++;
+
+        if (arena->blocks != NULL && capacity - bytes < arena->capacity - arena->used)
+        {
+            /*
+             * Large list gets dedicated block, current block is kept at head
+             * since it has more free space left.
+             */
+
+            sai_deserialize_arena_block_t *head = (sai_deserialize_arena_block_t*)arena->blocks;
+
+            block->next = head->next;
+            head->next = block;
+
+            ptr = SAI_DESERIALIZE_ARENA_DATA(block);
+
+            memset(ptr, 0, bytes);
+
+            arena->allocations++;
+
+            return ptr;
+        }
+
+        block->next = (sai_deserialize_arena_block_t*)arena->blocks;
+
+        arena->blocks = block;
+        arena->capacity = capacity;
+        arena->used = 0;
+    }
+
+    ptr = SAI_DESERIALIZE_ARENA_DATA(arena->blocks) + arena->used;
+
+    arena->used += bytes;
+
+    memset(ptr, 0, bytes);
+
+    arena->allocations++;
+
+    return ptr;
+}
+
+void sai_deserialize_arena_reset(
+        _Inout_ sai_deserialize_arena_t *arena)
+{
+    sai_deserialize_arena_block_t *head = (sai_deserialize_arena_block_t*)arena->blocks;
+
+    if (head == NULL)
+    {
+        return;
+    }
+
+    while (head->next != NULL)
+    {
+        sai_deserialize_arena_block_t *next = head->next->next;
+
+        free(head->next);
+
+        head->next = next;
+    }
+
+    arena->capacity = head->capacity;
+    arena->used = 0;
+}
+
+void sai_deserialize_arena_free(
+        _Inout_ sai_deserialize_arena_t *arena)
+{
+    sai_deserialize_arena_reset(arena);
+
+    free(arena->blocks);
+
+    arena->blocks = NULL;
+    arena->capacity = 0;
+    arena->used = 0;
+}
+
+/* Deserialize views */
+
+#define SAI_DESERIALIZE_VIEW_MAX_DEPTH 32
+
+static int sai_deserialize_hex_view(
+        _In_ const char *buffer,
+        _In_ uint32_t count,
+        _Out_ sai_deserialize_view_t *view)
+{
+    int ret = sai_deserialize_hex_bytes(buffer, NULL, count);
+
+    if (ret < 0)
+    {
+        SAI_META_LOG_WARN("failed to deserialize '%.*s' as %u hex bytes", MAX_CHARS_PRINT, buffer, count);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    view->data = buffer;
+    view->length = (size_t)ret;
+    view->count = count;
+
+    return ret;
+}
+
+int sai_deserialize_view_bytes(
+        _In_ const sai_deserialize_view_t *view,
+        _Out_ uint8_t *data,
+        _In_ size_t size)
+{
+    if (view->count == 0 || view->count > size ||
+            sai_deserialize_hex_bytes(view->data, data, view->count) < 0)
+    {
+        SAI_META_LOG_WARN("failed to decode view of %u bytes to buffer of size %u", view->count, (uint32_t)size);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    return (int)view->count;
+}
+
+int sai_deserialize_encrypt_key_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view)
+{
+    return sai_deserialize_hex_view(buffer, sizeof(sai_encrypt_key_t), view);
+}
+
+int sai_deserialize_auth_key_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view)
+{
+    return sai_deserialize_hex_view(buffer, sizeof(sai_auth_key_t), view);
+}
+
+int sai_deserialize_macsec_sak_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view)
+{
+    return sai_deserialize_hex_view(buffer, sizeof(sai_macsec_sak_t), view);
+}
+
+int sai_deserialize_macsec_auth_key_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view)
+{
+    return sai_deserialize_hex_view(buffer, sizeof(sai_macsec_auth_key_t), view);
+}
+
+int sai_deserialize_macsec_salt_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view)
+{
+    return sai_deserialize_hex_view(buffer, sizeof(sai_macsec_salt_t), view);
+}
+
+int sai_deserialize_chardata_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view)
+{
+    char data[SAI_CHARDATA_LENGTH];
+    int ret;
+
+    ret = sai_deserialize_chardata(buffer, data);
+
+    if (ret < 0)
+    {
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    view->data = buffer;
+    view->length = (size_t)ret;
+    view->count = (uint32_t)ret;
+
+    return ret;
+}
+
+int sai_deserialize_view_chardata(
+        _In_ const sai_deserialize_view_t *view,
+        _Out_ char data[SAI_CHARDATA_LENGTH])
+{
+    if (view->length > SAI_CHARDATA_LENGTH)
+    {
+        SAI_META_LOG_WARN("chardata view length %u exceeds %d", (uint32_t)view->length, SAI_CHARDATA_LENGTH);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    memset(data, 0, SAI_CHARDATA_LENGTH);
+    memcpy(data, view->data, view->length);
+
+    return (int)view->length;
+}
+
+int sai_deserialize_uint8_array_view(
+        _In_ const char *buffer,
+        _In_ uint32_t count,
+        _Out_ sai_deserialize_view_t *view)
+{
+    const char *buf = buffer;
+    uint32_t idx;
+    uint8_t u8;
+    int ret;
+
+    view->count = count;
+
+    if (strncmp(buf, "null", 4) == 0)
+    {
+        view->data = NULL;
+        view->length = 0;
+
+        return 4;
+    }
+
+    EXPECT("[");
+
+    view->data = buf;
+
+    for (idx = 0; idx < count; idx++)
+    {
+        if (idx != 0)
+        {
+            EXPECT(",");
+        }
+
+        EXPECT_CHECK(sai_deserialize_uint8(buf, &u8), uint8);
+    }
+
+    view->length = (size_t)(buf - view->data);
+
+    EXPECT("]");
+
+    return (int)(buf - buffer);
+}
+
+int sai_deserialize_u8_list_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view)
+{
+    const char *buf = buffer;
+    uint32_t count;
+    int ret;
+
+    EXPECT("{");
+
+    EXPECT_KEY("count");
+
+    EXPECT_CHECK(sai_deserialize_uint32(buf, &count), uint32);
+
+    EXPECT_NEXT_KEY("list");
+
+    EXPECT_CHECK(sai_deserialize_uint8_array_view(buf, count, view), uint8_array);
+
+    EXPECT("}");
+
+    return (int)(buf - buffer);
+}
+
+int sai_deserialize_view_u8_list(
+        _In_ const sai_deserialize_view_t *view,
+        _Inout_ sai_u8_list_t *list)
+{
+    const char *buf = view->data;
+    uint32_t idx;
+    int ret;
+
+    if (view->data == NULL)
+    {
+        /* list was serialized as null, only count is present */
+
+        list->count = view->count;
+        return 0;
+    }
+
+    if (list->count < view->count)
+    {
+        SAI_META_LOG_WARN("list of %u items can't hold %u items", list->count, view->count);
+
+        list->count = view->count;
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    for (idx = 0; idx < view->count; idx++)
+    {
+        if (idx != 0)
+        {
+            EXPECT(",");
+        }
+
+        EXPECT_CHECK(sai_deserialize_uint8(buf, &list->list[idx]), uint8);
+    }
+
+    list->count = view->count;
+
+    return (int)view->count;
+}
+
+static int sai_deserialize_json_skip_object(
+        _In_ const char *buffer)
+{
+    char stack[SAI_DESERIALIZE_VIEW_MAX_DEPTH];
+    const char *buf = buffer;
+    int depth = 0;
+
+    /*
+     * Only structure of object is validated, serialize never produce escaped
+     * characters in strings, so they are not accepted.
+     */
+
+    if (*buf != '{')
+    {
+        SAI_META_LOG_WARN("expected '{' but got '%.*s...'", MAX_CHARS_PRINT, buf);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    do
+    {
+        char c = *buf++;
+
+        switch (c)
+        {
+            case '{':
+            case '[':
+
+                if (depth == SAI_DESERIALIZE_VIEW_MAX_DEPTH)
+                {
+                    SAI_META_LOG_WARN("json object nested deeper than %d", SAI_DESERIALIZE_VIEW_MAX_DEPTH);
+                    return SAI_SERIALIZE_ERROR;
+                }
+
+                stack[depth++] = (c == '{') ? '}' : ']';
+                break;
+
+            case '}':
+            case ']':
+
+                if (stack[--depth] != c)
+                {
+                    SAI_META_LOG_WARN("unexpected '%c' in json object at offset %d", c, (int)(buf - buffer - 1));
+                    return SAI_SERIALIZE_ERROR;
+                }
+
+                break;
+
+            case '"':
+
+                while (*buf != '"')
+                {
+                    if (!isprint((unsigned char)*buf) || *buf == '\\')
+                    {
+                        SAI_META_LOG_WARN("invalid character 0x%x in json string", *buf);
+                        return SAI_SERIALIZE_ERROR;
+                    }
+
+                    buf++;
+                }
+
+                buf++;
+                break;
+
+            case ',':
+            case ':':
+                break;
+
+            default:
+
+                if (!isalnum((unsigned char)c) && c != '-' && c != '.' && c != '_')
+                {
+                    SAI_META_LOG_WARN("invalid character 0x%x in json object", c);
+                    return SAI_SERIALIZE_ERROR;
+                }
+
+                break;
+        }
+    }
+    while (depth > 0);
+
+    return (int)(buf - buffer);
+}
+
+static int sai_deserialize_attribute_data_view(
+        _In_ const char *buffer,
+        _In_ const sai_attr_metadata_t *meta,
+        _Out_ sai_deserialize_view_t *view)
+{
+    const char *buf = buffer;
+    int ret;
+
+    switch (meta->attrvaluetype)
+    {
+        case SAI_ATTR_VALUE_TYPE_UINT8_LIST:
+            EXPECT("{");
+            EXPECT_KEY("u8list");
+            EXPECT_CHECK(sai_deserialize_u8_list_view(buf, view), u8_list);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_CHARDATA:
+            EXPECT("{");
+            EXPECT_KEY("chardata");
+            EXPECT_QUOTE_CHECK(sai_deserialize_chardata_view(buf, view), chardata);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_ENCRYPT_KEY:
+            EXPECT("{");
+            EXPECT_KEY("encrypt_key");
+            EXPECT_QUOTE_CHECK(sai_deserialize_encrypt_key_view(buf, view), encrypt_key);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_AUTH_KEY:
+            EXPECT("{");
+            EXPECT_KEY("authkey");
+            EXPECT_QUOTE_CHECK(sai_deserialize_auth_key_view(buf, view), auth_key);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_MACSEC_SAK:
+            EXPECT("{");
+            EXPECT_KEY("macsecsak");
+            EXPECT_QUOTE_CHECK(sai_deserialize_macsec_sak_view(buf, view), macsec_sak);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_MACSEC_AUTH_KEY:
+            EXPECT("{");
+            EXPECT_KEY("macsecauthkey");
+            EXPECT_QUOTE_CHECK(sai_deserialize_macsec_auth_key_view(buf, view), macsec_auth_key);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_MACSEC_SALT:
+            EXPECT("{");
+            EXPECT_KEY("macsecsalt");
+            EXPECT_QUOTE_CHECK(sai_deserialize_macsec_salt_view(buf, view), macsec_salt);
+            break;
+
+        default:
+
+            /* value is not byte like, it will be validated when decoded */
+
+            memset(view, 0, sizeof(sai_deserialize_view_t));
+
+            return sai_deserialize_json_skip_object(buf);
+    }
+
+    EXPECT("}");
+
+    return (int)(buf - buffer);
+}
+
+int sai_deserialize_attribute_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_attribute_view_t *attribute_view)
+{
+    const char *buf = buffer;
+    const sai_attr_metadata_t *meta;
+    int ret;
+
+    EXPECT("{");
+
+    EXPECT_KEY("id");
+
+    EXPECT("\"");
+
+    meta = sai_metadata_get_attr_metadata_by_attr_id_name_ext(buf);
+
+    if (meta == NULL)
+    {
+        SAI_META_LOG_WARN("failed to deserialize attribute id '%.*s'", MAX_CHARS_PRINT, buf);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    buf += strlen(meta->attridname);
+
+    EXPECT("\"");
+
+    EXPECT_NEXT_KEY("value");
+
+    attribute_view->meta = meta;
+    attribute_view->value.data = buf;
+
+    EXPECT_CHECK(sai_deserialize_attribute_data_view(buf, meta, &attribute_view->data), attribute_data_view);
+
+    attribute_view->value.length = (size_t)(buf - attribute_view->value.data);
+    attribute_view->value.count = 0;
+
+    EXPECT("}");
+
+    return (int)(buf - buffer);
+}
+
+int sai_deserialize_view_attribute(
+        _In_ const sai_deserialize_attribute_view_t *attribute_view,
+        _Out_ sai_attribute_t *attribute,
+        _Inout_ sai_deserialize_arena_t *arena)
+{
+    int ret;
+
+    attribute->id = attribute_view->meta->attrid;
+
+    if (arena == NULL)
+    {
+        memset(&attribute->value, 0, sizeof(sai_attribute_value_t));
+    }
+
+    ret = sai_deserialize_attribute_value_ex(attribute_view->value.data, attribute_view->meta, &attribute->value, arena);
+
+    if (ret < 0 || (size_t)ret != attribute_view->value.length)
+    {
+        SAI_META_LOG_WARN("failed to deserialize attribute %s value view", attribute_view->meta->attridname);
+
+        if (arena == NULL)
+        {
+            sai_deserialize_free_attribute_value(attribute_view->meta, &attribute->value);
+        }
+
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    return ret;
+}
+
+/* Bulk serialize */
+
+/*
+ * Objects in bulk operation usually have the same attribute ids in the same
+ * order, so metadata resolved for attribute on given position is reused for
+ * next object when attribute id matches, lookup is done only on mismatch.
+ */
+
+#define SAI_SERIALIZE_BULK_META_CACHE_SIZE 64
+
+#define SAI_SERIALIZE_BULK_ATTR_CAPACITY 8
+
+#define SAI_SERIALIZE_BULK_MIN_OBJECT "{\"attributes\":[]}"
+
+static const sai_attr_metadata_t* sai_serialize_bulk_attr_metadata(
+        _Inout_ const sai_attr_metadata_t **cache,
+        _In_ uint32_t position,
+        _In_ sai_object_type_t object_type,
+        _In_ sai_attr_id_t attr_id)
+{
+    if (position >= SAI_SERIALIZE_BULK_META_CACHE_SIZE)
+    {
+        return sai_metadata_get_attr_metadata(object_type, attr_id);
+    }
+
+    if (cache[position] == NULL || cache[position]->attrid != attr_id)
+    {
+        cache[position] = sai_metadata_get_attr_metadata(object_type, attr_id);
+    }
+
+    return cache[position];
+}
+
+static const sai_attr_metadata_t* sai_deserialize_bulk_attr_metadata(
+        _Inout_ const sai_attr_metadata_t **cache,
+        _In_ uint32_t position,
+        _In_ sai_object_type_t object_type,
+        _In_ const char *buffer)
+{
+    const sai_attr_metadata_t *meta = NULL;
+    size_t len;
+
+    if (position < SAI_SERIALIZE_BULK_META_CACHE_SIZE && cache[position] != NULL)
+    {
+        meta = cache[position];
+
+        len = strlen(meta->attridname);
+
+        if (strncmp(buffer, meta->attridname, len) == 0 && buffer[len] == '"')
+        {
+            return meta;
+        }
+    }
+
+    meta = sai_metadata_get_attr_metadata_by_attr_id_name_ext(buffer);
+
+    if (meta == NULL || meta->objecttype != object_type)
+    {
+        SAI_META_LOG_WARN("attribute '%.*s' not found on object type %d", MAX_CHARS_PRINT, buffer, object_type);
+        return NULL;
+    }
+
+    if (position < SAI_SERIALIZE_BULK_META_CACHE_SIZE)
+    {
+        cache[position] = meta;
+    }
+
+    return meta;
+}
+
+int sai_serialize_bulk_create(
+        _Out_ char *buf,
+        _In_ size_t size,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_entry_t *object_key,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _In_ const sai_status_t *object_statuses)
+{
+    const sai_attr_metadata_t *cache[SAI_SERIALIZE_BULK_META_CACHE_SIZE];
+    const sai_attr_metadata_t *meta;
+    size_t pos = 0;
+    uint32_t idx;
+    uint32_t n;
+    int ret;
+
+    memset(cache, 0, sizeof(cache));
+
+    EMIT_N("{\"object_type\":\"");
+    EMIT_N_CHECK(sai_serialize_object_type_n(EMIT_N_BUF, EMIT_N_SIZE, object_type), object_type);
+    EMIT_N("\",\"mode\":\"");
+    EMIT_N_CHECK(sai_serialize_bulk_op_error_mode_n(EMIT_N_BUF, EMIT_N_SIZE, mode), bulk_op_error_mode);
+    EMIT_N("\",\"object_count\":");
+    EMIT_N_CHECK(sai_serialize_uint32_n(EMIT_N_BUF, EMIT_N_SIZE, object_count), uint32);
+    EMIT_N(",\"objects\":[");
+
+    for (idx = 0; idx < object_count; idx++)
+    {
+        if (idx != 0)
+        {
+            EMIT_N(",");
+        }
+
+        EMIT_N("{");
+
+        if (object_key != NULL)
+        {
+            EMIT_N("\"key\":");
+            EMIT_N_CHECK(sai_serialize_object_key_entry_n(EMIT_N_BUF, EMIT_N_SIZE, object_type, &object_key[idx]), object_key_entry);
+            EMIT_N(",");
+        }
+
+        if (object_statuses != NULL)
+        {
+            EMIT_N("\"status\":\"");
+            EMIT_N_CHECK(sai_serialize_status_n(EMIT_N_BUF, EMIT_N_SIZE, object_statuses[idx]), status);
+            EMIT_N("\",");
+        }
+
+        EMIT_N("\"attributes\":[");
+
+        for (n = 0; n < attr_count[idx]; n++)
+        {
+            if (n != 0)
+            {
+                EMIT_N(",");
+            }
+
+            meta = sai_serialize_bulk_attr_metadata(cache, n, object_type, attr_list[idx][n].id);
+
+            EMIT_N_CHECK(sai_serialize_attribute_n(EMIT_N_BUF, EMIT_N_SIZE, meta, &attr_list[idx][n]), attribute);
+        }
+
+        EMIT_N("]}");
+    }
+
+    EMIT_N("]}");
+
+    return (int)pos;
+}
+
+static int sai_deserialize_bulk_create_object(
+        _In_ const char *buffer,
+        _In_ sai_object_type_t object_type,
+        _Inout_ const sai_attr_metadata_t **cache,
+        _In_ uint32_t capacity,
+        _Out_ sai_object_key_entry_t *object_key,
+        _Out_ uint32_t *attr_count,
+        _Out_ sai_attribute_t **attr_list,
+        _Out_ sai_status_t *object_status,
+        _Inout_ sai_deserialize_arena_t *arena)
+{
+    const sai_attr_metadata_t *meta;
+    const char *buf = buffer;
+    sai_attribute_t *list;
+    sai_attribute_t *grow;
+    uint32_t n;
+    int ret;
+
+    EXPECT("{");
+
+    if (strncmp(buf, "\"key\":", 6) == 0)
+    {
+        EXPECT_KEY("key");
+        EXPECT_CHECK(sai_deserialize_object_key_entry_ex(buf, object_type, object_key, arena), object_key_entry);
+        EXPECT(",");
+    }
+
+    if (strncmp(buf, "\"status\":", 9) == 0)
+    {
+        EXPECT_KEY("status");
+        EXPECT_QUOTE_CHECK(sai_deserialize_status(buf, object_status), status);
+        EXPECT(",");
+    }
+
+    EXPECT_KEY("attributes");
+    EXPECT("[");
+
+    /*
+     * Capacity is attribute count of previous object, so list is usually
+     * allocated only once, it's doubled when object has more attributes.
+     */
+
+    list = sai_deserialize_arena_alloc(arena, capacity, sizeof(sai_attribute_t));
+
+    for (n = 0; list != NULL && *buf != ']'; n++)
+    {
+        if (n != 0)
+        {
+            EXPECT(",");
+        }
+
+        if (n == capacity)
+        {
+            capacity *= 2;
+
+            grow = sai_deserialize_arena_alloc(arena, capacity, sizeof(sai_attribute_t));
+
+            if (grow != NULL)
+            {
+                memcpy(grow, list, n * sizeof(sai_attribute_t));
+            }
+
+            list = grow;
+
+            if (list == NULL)
+            {
+                break;
+            }
+        }
+
+        EXPECT("{\"id\":\"");
+
+        meta = sai_deserialize_bulk_attr_metadata(cache, n, object_type, buf);
+
+        if (meta == NULL)
+        {
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        list[n].id = meta->attrid;
+
+        buf += strlen(meta->attridname);
+
+        EXPECT("\",\"value\":");
+        EXPECT_CHECK(sai_deserialize_attribute_value_ex(buf, meta, &list[n].value, arena), attribute_value);
+        EXPECT("}");
+    }
+
+    if (list == NULL)
+    {
+        SAI_META_LOG_ERROR("failed to allocate attribute list");
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    EXPECT("]");
+    EXPECT("}");
+
+    *attr_count = n;
+    *attr_list = list;
+
+    return (int)(buf - buffer);
+}
+
+int sai_deserialize_bulk_create(
+        _In_ const char *buffer,
+        _Out_ sai_object_type_t *object_type,
+        _Out_ uint32_t *object_count,
+        _Out_ sai_object_key_entry_t **object_key,
+        _Out_ uint32_t **attr_count,
+        _Out_ sai_attribute_t ***attr_list,
+        _Out_ sai_bulk_op_error_mode_t *mode,
+        _Out_ sai_status_t **object_statuses,
+        _Inout_ sai_deserialize_arena_t *arena)
+{
+    const sai_attr_metadata_t *cache[SAI_SERIALIZE_BULK_META_CACHE_SIZE];
+    const char *buf = buffer;
+    sai_object_key_entry_t *keys;
+    sai_attribute_t **lists;
+    sai_status_t *statuses;
+    uint32_t *counts;
+    uint32_t capacity;
+    uint32_t count;
+    uint32_t idx;
+    int ret;
+
+    if (arena == NULL)
+    {
+        SAI_META_LOG_WARN("arena is required to deserialize bulk create");
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    memset(cache, 0, sizeof(cache));
+
+    EXPECT("{");
+    EXPECT_KEY("object_type");
+    EXPECT_QUOTE_CHECK(sai_deserialize_object_type(buf, object_type), object_type);
+    EXPECT_NEXT_KEY("mode");
+    EXPECT_QUOTE_CHECK(sai_deserialize_bulk_op_error_mode(buf, mode), bulk_op_error_mode);
+    EXPECT_NEXT_KEY("object_count");
+    EXPECT_CHECK(sai_deserialize_uint32(buf, &count), uint32);
+    EXPECT_NEXT_KEY("objects");
+    EXPECT("[");
+
+    if (count > strlen(buf) / (sizeof(SAI_SERIALIZE_BULK_MIN_OBJECT) - 1))
+    {
+        SAI_META_LOG_WARN("object count %u exceeds buffer size", count);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    keys = sai_deserialize_arena_alloc(arena, count, sizeof(sai_object_key_entry_t));
+    counts = sai_deserialize_arena_alloc(arena, count, sizeof(uint32_t));
+    lists = sai_deserialize_arena_alloc(arena, count, sizeof(sai_attribute_t*));
+    statuses = sai_deserialize_arena_alloc(arena, count, sizeof(sai_status_t));
+
+    if (keys == NULL || counts == NULL || lists == NULL || statuses == NULL)
+    {
+        SAI_META_LOG_ERROR("failed to allocate bulk create lists");
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    for (idx = 0; idx < count; idx++)
+    {
+        if (idx != 0)
+        {
+            EXPECT(",");
+        }
+
+        statuses[idx] = SAI_STATUS_NOT_EXECUTED;
+
+        capacity = (idx == 0 || counts[idx - 1] == 0) ? SAI_SERIALIZE_BULK_ATTR_CAPACITY : counts[idx - 1];
+
+        ret = sai_deserialize_bulk_create_object(buf, *object_type, cache, capacity,
+                &keys[idx], &counts[idx], &lists[idx], &statuses[idx], arena);
+
+        if (ret < 0)
+        {
+            SAI_META_LOG_WARN("failed to deserialize bulk create object %u", idx);
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        buf += ret;
+    }
+
+    EXPECT("]");
+    EXPECT("}");
+
+    *object_count = count;
+    *object_key = keys;
+    *attr_count = counts;
+    *attr_list = lists;
+    *object_statuses = statuses;
+
+    return (int)(buf - buffer);
+}
+
+/* Deserialize stream */
+
+/*
+ * Stream only tracks json structure of pushed characters to find where each
+ * attribute ends, complete attribute is then deserialized from buffer by
+ * sai_deserialize_attribute_ex, so each character is copied and scanned once
+ * regardless of chunk boundaries.
+ *
+ * When attribute doesn't fit into buffer inside of list, which is last
+ * member of all enclosing objects, buffer is deserialized as attribute with
+ * list of complete items only, by replacing list count with number of
+ * buffered items and closing list and objects after last complete item.
+ * Remaining incomplete item is then moved to beginning of list and parsing
+ * resumes.
+ */
+
+#define SAI_DESERIALIZE_STREAM_MAX_LENGTH   (64 * 1024)
+#define SAI_DESERIALIZE_STREAM_MAX_DEPTH    32
+#define SAI_DESERIALIZE_STREAM_BUFFER_SIZE  4096
+#define SAI_DESERIALIZE_STREAM_LIST_KEY     ",\"list\":["
+
+void sai_deserialize_stream_init(
+        _Out_ sai_deserialize_stream_t *stream,
+        _In_ size_t max_length)
+{
+    memset(stream, 0, sizeof(sai_deserialize_stream_t));
+
+    stream->maxlength = (max_length == 0) ? SAI_DESERIALIZE_STREAM_MAX_LENGTH : max_length;
+
+    sai_deserialize_arena_init(&stream->arena, 0);
+}
+
+static int sai_deserialize_stream_list_count(
+        _Inout_ sai_deserialize_stream_t *stream)
+{
+    const char *buffer = (const char*)stream->buffer;
+    const char *buf;
+    size_t pos;
+    int ret;
+
+    /* list is preceded by "count":N,"list":[ */
+
+    pos = stream->listbegin - (sizeof(SAI_DESERIALIZE_STREAM_LIST_KEY) - 1);
+
+    while (pos > 0 && isdigit(buffer[pos - 1]))
+    {
+        pos--;
+    }
+
+    if (pos < sizeof("\"count\":") - 1)
+    {
+        SAI_META_LOG_WARN("list at offset %"PRIu64" is not preceded by count", stream->offset);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    stream->countbegin = pos;
+
+    buf = buffer + pos - (sizeof("\"count\":") - 1);
+
+    EXPECT_KEY("count");
+    EXPECT_CHECK(sai_deserialize_uint32(buf, &stream->listcount), uint32);
+    EXPECT(SAI_DESERIALIZE_STREAM_LIST_KEY);
+
+    if (buf != buffer + stream->listbegin)
+    {
+        SAI_META_LOG_WARN("list at offset %"PRIu64" is not preceded by count", stream->offset);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    return 0;
+}
+
+static int sai_deserialize_stream_emit_list(
+        _Inout_ sai_deserialize_stream_t *stream,
+        _In_ size_t end,
+        _In_ uint32_t items,
+        _In_ bool last,
+        _In_ sai_deserialize_stream_fn callback)
+{
+    char *buffer = (char*)stream->buffer;
+    char count[PRIMITIVE_BUFFER_SIZE];
+    char saved[SAI_DESERIALIZE_STREAM_MAX_DEPTH + 1];
+    size_t closing = stream->listdepth;
+    size_t shift;
+    size_t len;
+    uint32_t idx;
+    sai_attribute_t attr;
+    int ret;
+
+    if (items > stream->listcount - stream->listindex || (last && items != stream->listcount - stream->listindex))
+    {
+        SAI_META_LOG_WARN("attribute %"PRIu64" list has different number of items than count %u",
+                stream->count, stream->listcount);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    /* count of batch is never longer than count of whole list */
+
+    len = (size_t)sai_serialize_uint32(count, items);
+
+    memcpy(count + len, SAI_DESERIALIZE_STREAM_LIST_KEY, sizeof(SAI_DESERIALIZE_STREAM_LIST_KEY) - 1);
+
+    len += sizeof(SAI_DESERIALIZE_STREAM_LIST_KEY) - 1;
+
+    shift = stream->listbegin - stream->countbegin - len;
+
+    memmove(buffer + shift, buffer, stream->countbegin);
+    memcpy(buffer + stream->listbegin - len, count, len);
+
+    /* close list and objects after last complete item, remaining item is restored later */
+
+    memcpy(saved, buffer + end, closing + 1);
+
+    if (!last)
+    {
+        buffer[end] = ']';
+
+        for (idx = 1; idx < stream->listdepth; idx++)
+        {
+            buffer[end + idx] = '}';
+        }
+    }
+
+    buffer[end + closing] = 0;
+
+    ret = sai_deserialize_attribute_ex(buffer + shift, &attr, &stream->arena);
+
+    if (ret < 0 || (size_t)ret != end + closing - shift)
+    {
+        SAI_META_LOG_WARN("failed to deserialize attribute %"PRIu64" list items from %u: '%.*s'",
+                stream->count, stream->listindex, MAX_CHARS_PRINT, buffer + shift);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    memcpy(buffer + end, saved, closing + 1);
+    memmove(buffer, buffer + shift, stream->countbegin);
+
+    stream->listmore = !last;
+
+    ret = callback(stream, &attr);
+
+    stream->listmore = 0;
+
+    sai_deserialize_arena_reset(&stream->arena);
+
+    stream->listindex += items;
+
+    if (ret < 0)
+    {
+        SAI_META_LOG_NOTICE("stream callback stopped deserialize at attribute %"PRIu64, stream->count);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    return 0;
+}
+
+static int sai_deserialize_stream_split(
+        _Inout_ sai_deserialize_stream_t *stream,
+        _In_ sai_deserialize_stream_fn callback)
+{
+    char *buffer = (char*)stream->buffer;
+
+    if (!stream->listsplit && sai_deserialize_stream_list_count(stream) < 0)
+    {
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    stream->listsplit = 1;
+
+    if (sai_deserialize_stream_emit_list(stream, stream->itemsend, stream->listitems, false, callback) < 0)
+    {
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    /* move incomplete item after comma to beginning of list */
+
+    memmove(buffer + stream->listbegin, buffer + stream->itemsend + 1, stream->length - stream->itemsend - 1);
+
+    stream->length -= stream->itemsend + 1 - stream->listbegin;
+    stream->listitems = 0;
+
+    return 0;
+}
+
+static int sai_deserialize_stream_append(
+        _Inout_ sai_deserialize_stream_t *stream,
+        _In_ const char *data,
+        _In_ size_t size,
+        _In_ sai_deserialize_stream_fn callback)
+{
+    size_t capacity = stream->capacity;
+    char *buffer;
+
+    if (size > stream->maxlength - stream->length)
+    {
+        /* list can be split only after complete item */
+
+        if (stream->listdepth == 0 || stream->listitems == 0)
+        {
+            SAI_META_LOG_WARN("attribute at offset %"PRIu64" is longer than %u characters",
+                    stream->offset, (uint32_t)stream->maxlength);
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        if (sai_deserialize_stream_split(stream, callback) < 0)
+        {
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        if (size > stream->maxlength - stream->length)
+        {
+            SAI_META_LOG_WARN("list item at offset %"PRIu64" is longer than %u characters",
+                    stream->offset, (uint32_t)stream->maxlength);
+            return SAI_SERIALIZE_ERROR;
+        }
+    }
+
+    /* extra characters are needed for closing brackets of split list and '\0' */
+
+    if (stream->length + size + SAI_DESERIALIZE_STREAM_MAX_DEPTH >= capacity)
+    {
+        if (capacity == 0)
+        {
+            capacity = SAI_DESERIALIZE_STREAM_BUFFER_SIZE;
+        }
+
+        while (stream->length + size + SAI_DESERIALIZE_STREAM_MAX_DEPTH >= capacity)
+        {
+            capacity *= 2;
+        }
+
+        buffer = (char*)realloc(stream->buffer, capacity);
+
+        if (buffer == NULL)
+        {
+            SAI_META_LOG_ERROR("failed to allocate stream buffer of %u characters", (uint32_t)capacity);
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        stream->buffer = buffer;
+        stream->capacity = capacity;
+    }
+
+    memcpy((char*)stream->buffer + stream->length, data, size);
+
+    stream->length += size;
+
+    return 0;
+}
+
+static int sai_deserialize_stream_emit(
+        _Inout_ sai_deserialize_stream_t *stream,
+        _In_ sai_deserialize_stream_fn callback)
+{
+    sai_attribute_t attr;
+    char *buffer = (char*)stream->buffer;
+    int ret;
+
+    if (stream->listsplit)
+    {
+        /* remaining list items, last item is followed by end of list and objects */
+
+        ret = sai_deserialize_stream_emit_list(stream, stream->length - stream->listdepth,
+                stream->listitems + 1, true, callback);
+    }
+    else
+    {
+        buffer[stream->length] = 0;
+
+        ret = sai_deserialize_attribute_ex(buffer, &attr, &stream->arena);
+
+        if (ret < 0 || (size_t)ret != stream->length)
+        {
+            SAI_META_LOG_WARN("failed to deserialize attribute %"PRIu64": '%.*s'",
+                    stream->count, MAX_CHARS_PRINT, buffer);
+            return SAI_SERIALIZE_ERROR;
+        }
+
+        ret = callback(stream, &attr);
+
+        sai_deserialize_arena_reset(&stream->arena);
+
+        if (ret < 0)
+        {
+            SAI_META_LOG_NOTICE("stream callback stopped deserialize at attribute %"PRIu64, stream->count);
+        }
+    }
+
+    stream->length = 0;
+    stream->listdepth = 0;
+    stream->listsplit = 0;
+    stream->listitems = 0;
+    stream->listindex = 0;
+    stream->count++;
+
+    return (ret < 0) ? SAI_SERIALIZE_ERROR : 0;
+}
+
+int sai_deserialize_stream_push(
+        _Inout_ sai_deserialize_stream_t *stream,
+        _In_ const char *data,
+        _In_ size_t size,
+        _In_ sai_deserialize_stream_fn callback,
+        _In_ sai_pointer_t context)
+{
+    const char *begin = (stream->depth != 0) ? data : NULL;
+    size_t idx;
+    int count = 0;
+
+    stream->context = context;
+
+    for (idx = 0; idx < size; idx++)
+    {
+        char c = data[idx];
+
+        if (stream->instring)
+        {
+            stream->instring = (c != '"');
+            continue;
+        }
+
+        if (stream->depth == 0)
+        {
+            /* between attributes only separators and single level array brackets are allowed */
+
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ',')
+            {
+                continue;
+            }
+
+            if (c == '[' || c == ']')
+            {
+                if (stream->inarray == (c == '['))
+                {
+                    SAI_META_LOG_WARN("unmatched '%c' at offset %"PRIu64, c, stream->offset + idx);
+                    return SAI_SERIALIZE_ERROR;
+                }
+
+                stream->inarray = (c == '[');
+                continue;
+            }
+
+            if (c != '{')
+            {
+                SAI_META_LOG_WARN("unexpected character 0x%x between attributes at offset %"PRIu64,
+                        (unsigned char)c, stream->offset + idx);
+                return SAI_SERIALIZE_ERROR;
+            }
+
+            begin = data + idx;
+        }
+        else if (stream->listdepth != 0 && stream->depth < stream->listdepth && c != '}')
+        {
+            /* list can be split only when followed by end of enclosing objects */
+
+            if (stream->listsplit)
+            {
+                SAI_META_LOG_WARN("unexpected '%c' after split list at offset %"PRIu64, c, stream->offset + idx);
+                return SAI_SERIALIZE_ERROR;
+            }
+
+            stream->listdepth = 0;
+        }
+
+        switch (c)
+        {
+            case '{':
+            case '[':
+
+                if (stream->depth == SAI_DESERIALIZE_STREAM_MAX_DEPTH)
+                {
+                    SAI_META_LOG_WARN("attribute at offset %"PRIu64" nested deeper than %d",
+                            stream->offset + idx, SAI_DESERIALIZE_STREAM_MAX_DEPTH);
+                    return SAI_SERIALIZE_ERROR;
+                }
+
+                /* only array which is enclosed by objects only can be split */
+
+                if (c == '[' && stream->listdepth == 0 &&
+                        stream->nesting == (uint32_t)((1ULL << stream->depth) - 1))
+                {
+                    stream->listdepth = stream->depth + 1;
+                    stream->listbegin = stream->length + (size_t)(data + idx + 1 - begin);
+                    stream->listitems = 0;
+                }
+
+                stream->nesting = (stream->nesting << 1) | (c == '{');
+                stream->depth++;
+                break;
+
+            case '}':
+            case ']':
+
+                if ((stream->nesting & 1) != (uint32_t)(c == '}'))
+                {
+                    SAI_META_LOG_WARN("unexpected '%c' at offset %"PRIu64, c, stream->offset + idx);
+                    return SAI_SERIALIZE_ERROR;
+                }
+
+                stream->nesting >>= 1;
+                stream->depth--;
+
+                if (stream->depth == 0)
+                {
+                    if (sai_deserialize_stream_append(stream, begin, (size_t)(data + idx + 1 - begin), callback) < 0 ||
+                            sai_deserialize_stream_emit(stream, callback) < 0)
+                    {
+                        return SAI_SERIALIZE_ERROR;
+                    }
+
+                    begin = NULL;
+                    count++;
+                }
+
+                break;
+
+            case ',':
+
+                if (stream->depth == stream->listdepth)
+                {
+                    /* item boundary, list can be split here when buffer is full */
+
+                    if (sai_deserialize_stream_append(stream, begin, (size_t)(data + idx + 1 - begin), callback) < 0)
+                    {
+                        return SAI_SERIALIZE_ERROR;
+                    }
+
+                    begin = data + idx + 1;
+
+                    stream->itemsend = stream->length - 1;
+                    stream->listitems++;
+                }
+
+                break;
+
+            case '"':
+
+                stream->instring = 1;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (begin != NULL && sai_deserialize_stream_append(stream, begin, (size_t)(data + size - begin), callback) < 0)
+    {
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    stream->offset += size;
+
+    return count;
+}
+
+int sai_deserialize_stream_finish(
+        _In_ const sai_deserialize_stream_t *stream)
+{
+    if (stream->depth != 0)
+    {
+        SAI_META_LOG_WARN("stream ended inside of attribute %"PRIu64, stream->count);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    if (stream->inarray)
+    {
+        SAI_META_LOG_WARN("stream ended inside of array after %"PRIu64" attributes", stream->count);
+        return SAI_SERIALIZE_ERROR;
+    }
+
+    return 0;
+}
+
+void sai_deserialize_stream_free(
+        _Inout_ sai_deserialize_stream_t *stream)
+{
+    free(stream->buffer);
+
+    sai_deserialize_arena_free(&stream->arena);
+
+    stream->buffer = NULL;
+    stream->length = 0;
+    stream->capacity = 0;
+}
@@ -46,6 +46,261 @@
  */
 #define SAI_CHARDATA_LENGTH 32
 
+/**
+ * @def SAI_SERIALIZE_BINARY_MAGIC
+ *
+ * Magic number at the beginning of binary serialized object ("SAIB").
+ */
+#define SAI_SERIALIZE_BINARY_MAGIC 0x42494153
+
+/**
+ * @def SAI_SERIALIZE_BINARY_VERSION
+ *
+ * Version of binary serialized object format. Objects with newer version are
+ * rejected, attributes unknown to reader are skipped.
+ */
+#define SAI_SERIALIZE_BINARY_VERSION 1
+
+/**
+ * @brief Deserialize arena.
+ *
+ * Bump allocator used by deserialize methods with "_ex" suffix to allocate
+ * lists. All lists allocated from arena are released at once by
+ * sai_deserialize_arena_reset or sai_deserialize_arena_free, so they must not
+ * be passed to any of sai_deserialize_free_* methods.
+ */
+typedef struct _sai_deserialize_arena_t
+{
+    /**
+     * @brief Opaque list of memory blocks, current block is first.
+     */
+    sai_pointer_t blocks;
+
+    /**
+     * @brief Minimum size of single memory block.
+     */
+    size_t blocksize;
+
+    /**
+     * @brief Number of bytes used in current memory block.
+     */
+    size_t used;
+
+    /**
+     * @brief Capacity of current memory block.
+     */
+    size_t capacity;
+
+    /**
+     * @brief Number of allocations served by arena since initialization.
+     */
+    size_t allocations;
+
+    /**
+     * @brief Number of memory blocks allocated since initialization.
+     */
+    size_t blockcount;
+
+} sai_deserialize_arena_t;
+
+/**
+ * @brief Deserialize view.
+ *
+ * View points to value inside serialized buffer, it is created by
+ * deserialize methods with "_view" suffix, which validate value in place
+ * without allocating memory. Value is decoded only when requested by
+ * sai_deserialize_view_* methods, so source buffer must outlive the view.
+ */
+typedef struct _sai_deserialize_view_t
+{
+    /**
+     * @brief Pointer to value in source buffer, NULL if list is null.
+     */
+    const char *data;
+
+    /**
+     * @brief Number of characters of value in source buffer.
+     */
+    size_t length;
+
+    /**
+     * @brief Number of items or bytes in value.
+     */
+    uint32_t count;
+
+} sai_deserialize_view_t;
+
+/**
+ * @brief Deserialize attribute view.
+ */
+typedef struct _sai_deserialize_attribute_view_t
+{
+    /**
+     * @brief Attribute metadata.
+     */
+    const sai_attr_metadata_t *meta;
+
+    /**
+     * @brief Serialized attribute value, count is not used.
+     */
+    sai_deserialize_view_t value;
+
+    /**
+     * @brief Items of u8 list, characters of chardata or bytes of key.
+     *
+     * For other attribute value types data is NULL.
+     */
+    sai_deserialize_view_t data;
+
+} sai_deserialize_attribute_view_t;
+
+/**
+ * @brief Deserialize stream.
+ *
+ * Push style deserializer of attribute sequence, like json array of
+ * attributes or attributes separated by new lines. Input can be pushed in
+ * chunks of any size, and memory usage is bounded by stream maximum length
+ * regardless of input size.
+ *
+ * Attribute is buffered until it's complete, when it gets longer than
+ * maximum length inside of list, which is last member of its enclosing
+ * objects, list items buffered so far are deserialized and passed to
+ * callback, and parsing resumes inside of list. Other attributes must fit
+ * into maximum length.
+ */
+typedef struct _sai_deserialize_stream_t
+{
+    /**
+     * @brief Buffer holding incomplete attribute.
+     */
+    sai_pointer_t buffer;
+
+    /**
+     * @brief Number of characters in buffer.
+     */
+    size_t length;
+
+    /**
+     * @brief Size of allocated buffer.
+     */
+    size_t capacity;
+
+    /**
+     * @brief Maximum number of buffered characters.
+     */
+    size_t maxlength;
+
+    /**
+     * @brief Nesting depth of incomplete attribute, zero between attributes.
+     */
+    uint32_t depth;
+
+    /**
+     * @brief Bit for each nesting level, set for object and clear for array.
+     */
+    uint32_t nesting;
+
+    /**
+     * @brief Non zero when inside of string.
+     */
+    uint32_t instring;
+
+    /**
+     * @brief Non zero when inside of top level array.
+     */
+    uint32_t inarray;
+
+    /**
+     * @brief Nesting depth of list which can be split, zero if none.
+     */
+    uint32_t listdepth;
+
+    /**
+     * @brief Non zero when list was already split.
+     */
+    uint32_t listsplit;
+
+    /**
+     * @brief Buffer offset of list count, valid when list was split.
+     */
+    size_t countbegin;
+
+    /**
+     * @brief Buffer offset of first list item.
+     */
+    size_t listbegin;
+
+    /**
+     * @brief Buffer offset of comma after last complete list item.
+     */
+    size_t itemsend;
+
+    /**
+     * @brief Number of complete list items in buffer.
+     */
+    uint32_t listitems;
+
+    /**
+     * @brief Index of first buffered list item in whole list.
+     *
+     * During callback it's index of first list item passed to callback,
+     * zero if attribute was not split.
+     */
+    uint32_t listindex;
+
+    /**
+     * @brief Non zero during callback when more batches of split list follow.
+     */
+    uint32_t listmore;
+
+    /**
+     * @brief Count of whole list, valid when list was split.
+     */
+    uint32_t listcount;
+
+    /**
+     * @brief User context passed to sai_deserialize_stream_push.
+     */
+    sai_pointer_t context;
+
+    /**
+     * @brief Number of characters pushed to stream.
+     */
+    uint64_t offset;
+
+    /**
+     * @brief Number of deserialized attributes.
+     */
+    uint64_t count;
+
+    /**
+     * @brief Arena for lists of attribute passed to callback.
+     */
+    sai_deserialize_arena_t arena;
+
+} sai_deserialize_stream_t;
+
+/**
+ * @brief Deserialize stream callback.
+ *
+ * Attribute and its lists are valid only during callback.
+ *
+ * Attribute which is longer than stream maximum length is passed in
+ * several calls when it ends with a list, like port list or u8 list. Each
+ * call gets next batch of list items in place of whole list, other members
+ * of attribute value are the same in each call. Batch position is given by
+ * stream listindex and listmore members.
+ *
+ * @param[in] stream Deserialize stream, with user context.
+ * @param[in] attr Deserialized attribute.
+ *
+ * @return Zero or positive number to continue, negative number to stop
+ * deserialize, in that case push returns #SAI_SERIALIZE_ERROR.
+ */
+typedef int (*sai_deserialize_stream_fn)(
+        _In_ const sai_deserialize_stream_t *stream,
+        _In_ const sai_attribute_t *attr);
+
 /**
  * @brief Is char allowed.
  *
@@ -805,6 +1060,23 @@ int sai_deserialize_enum_list(
         _In_ const sai_enum_metadata_t *meta,
         _Out_ sai_s32_list_t *s32_list);
 
+/**
+ * @brief Deserialize enum list using arena.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] meta Enum metadata.
+ * @param[out] s32_list Deserialized value.
+ * @param[inout] arena Arena for list allocation, or NULL to use calloc.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_enum_list_ex(
+        _In_ const char *buffer,
+        _In_ const sai_enum_metadata_t *meta,
+        _Out_ sai_s32_list_t *s32_list,
+        _Inout_ sai_deserialize_arena_t *arena);
+
 /**
  * @brief Serialize attribute id.
  *
@@ -867,6 +1139,25 @@ int sai_deserialize_attribute(
         _In_ const char *buffer,
         _Out_ sai_attribute_t *attribute);
 
+/**
+ * @brief Deserialize SAI attribute using arena.
+ *
+ * All lists of attribute value are allocated from arena. When arena is NULL,
+ * lists are allocated using calloc and they are released on failure, so
+ * attribute never holds memory when error is returned.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] attribute Deserialized value.
+ * @param[inout] arena Arena for list allocations, or NULL to use calloc.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_attribute_ex(
+        _In_ const char *buffer,
+        _Out_ sai_attribute_t *attribute,
+        _Inout_ sai_deserialize_arena_t *arena);
+
 /**
  * @brief Free SAI attribute.
  *
@@ -877,6 +1168,1771 @@ void sai_free_attribute(
         _In_ const sai_attr_metadata_t *meta,
         _In_ const sai_attribute_t *attribute);
 
+/**
+ * @brief Serialize bool value with length bounded output.
+ *
+ * Works like snprintf, at most size characters including '\0' are written to
+ * buffer, and output is always terminated with '\0' when size is not zero.
+ * Buffer can be NULL when size is zero, then only output length is computed.
+ * When returned value is greater or equal to size, output was truncated.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] flag Bool flag to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_bool_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ bool flag);
+
+/**
+ * @brief Serialize char data value with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] data Data to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_chardata_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const char data[SAI_CHARDATA_LENGTH]);
+
+/**
+ * @brief Serialize 8 bit unsigned integer with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] u8 Value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_uint8_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint8_t u8);
+
+/**
+ * @brief Serialize 8 bit signed integer with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] s8 Value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_int8_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ int8_t s8);
+
+/**
+ * @brief Serialize 16 bit unsigned integer with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] u16 Value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_uint16_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint16_t u16);
+
+/**
+ * @brief Serialize 16 bit signed integer with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] s16 Value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_int16_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ int16_t s16);
+
+/**
+ * @brief Serialize 32 bit unsigned integer with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] u32 Value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_uint32_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint32_t u32);
+
+/**
+ * @brief Serialize 32 bit signed integer with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] s32 Value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_int32_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ int32_t s32);
+
+/**
+ * @brief Serialize 64 bit unsigned integer with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] u64 Value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_uint64_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint64_t u64);
+
+/**
+ * @brief Serialize 64 bit signed integer with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] s64 Value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_int64_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ int64_t s64);
+
+/**
+ * @brief Serialize sai_size_t with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] value Value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_size_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ sai_size_t value);
+
+/**
+ * @brief Serialize object ID with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] oid Object ID to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_object_id_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ sai_object_id_t oid);
+
+/**
+ * @brief Serialize MAC address with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] mac MAC address to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_mac_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_mac_t mac);
+
+/**
+ * @brief Serialize encrypt_key with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] sak Encrypt key to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_encrypt_key_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_encrypt_key_t sak);
+
+/**
+ * @brief Serialize auth_key with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] auth Auth key to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_auth_key_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_auth_key_t auth);
+
+/**
+ * @brief Serialize macsec_sak with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] sak MACsec SAK to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_macsec_sak_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_sak_t sak);
+
+/**
+ * @brief Serialize macsec_auth_key with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] auth MACsec auth key to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_macsec_auth_key_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_auth_key_t auth);
+
+/**
+ * @brief Serialize macsec_salt with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] salt MACsec salt to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_macsec_salt_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_salt_t salt);
+
+/**
+ * @brief Serialize enum value with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] meta Enum metadata for serialization info.
+ * @param[in] value Enum value to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_enum_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _In_ int32_t value);
+
+/**
+ * @brief Serialize IPv4 address with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] ip4 IP address to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_ip4_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ sai_ip4_t ip4);
+
+/**
+ * @brief Serialize IPv6 address with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] ip6 IP address to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_ip6_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip6_t ip6);
+
+/**
+ * @brief Serialize IP address with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] ip_address IP address to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_ip_address_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip_address_t *ip_address);
+
+/**
+ * @brief Serialize IP prefix with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] ip_prefix IP prefix to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_ip_prefix_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip_prefix_t *ip_prefix);
+
+/**
+ * @brief Serialize IPv4 mask with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] ip4_mask IPv4 mask to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_ip4_mask_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ sai_ip4_t ip4_mask);
+
+/**
+ * @brief Serialize IPv6 mask with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] ip6_mask IPv6 mask to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_ip6_mask_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip6_t ip6_mask);
+
+/**
+ * @brief Serialize pointer with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] pointer Pointer to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_pointer_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_pointer_t pointer);
+
+/**
+ * @brief Serialize enum list with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] meta Enum metadata used to serialize.
+ * @param[in] s32_list List of enum values to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_enum_list_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _In_ const sai_s32_list_t *s32_list);
+
+/**
+ * @brief Serialize attribute id with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] meta Attribute metadata.
+ * @param[in] attr_id Attribute id to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_attr_id_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_attr_metadata_t *meta,
+        _In_ sai_attr_id_t attr_id);
+
+/**
+ * @brief Serialize SAI attribute with length bounded output.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] meta Attribute metadata.
+ * @param[in] attribute Attribute to be serialized.
+ *
+ * @return Number of characters that would be written to buffer excluding '\0'
+ * if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_attribute_n(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const sai_attr_metadata_t *meta,
+        _In_ const sai_attribute_t *attribute);
+
+/**
+ * @brief Get length of serialized SAI attribute value.
+ *
+ * Computes exact number of characters excluding '\0' that
+ * sai_serialize_attribute_value will produce, without writing any output.
+ *
+ * @param[in] meta Attribute metadata.
+ * @param[in] value Attribute value to be examined.
+ *
+ * @return Length of serialized attribute value, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_attribute_value_length(
+        _In_ const sai_attr_metadata_t *meta,
+        _In_ const sai_attribute_value_t *value);
+
+/**
+ * @brief Serialize bool value to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] flag Bool value to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_bool(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ bool flag);
+
+/**
+ * @brief Deserialize bool value from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] flag Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_bool(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ bool *flag);
+
+/**
+ * @brief Serialize char data value to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] data Char data value to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_chardata(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const char data[SAI_CHARDATA_LENGTH]);
+
+/**
+ * @brief Deserialize char data value from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] data Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_chardata(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ char data[SAI_CHARDATA_LENGTH]);
+
+/**
+ * @brief Serialize 8 bit unsigned integer to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] u8 Integer to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_uint8(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ uint8_t u8);
+
+/**
+ * @brief Deserialize 8 bit unsigned integer from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] u8 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_uint8(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ uint8_t *u8);
+
+/**
+ * @brief Serialize 8 bit signed integer to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] s8 Integer to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_int8(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ int8_t s8);
+
+/**
+ * @brief Deserialize 8 bit signed integer from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] s8 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_int8(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ int8_t *s8);
+
+/**
+ * @brief Serialize 16 bit unsigned integer to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] u16 Integer to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_uint16(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ uint16_t u16);
+
+/**
+ * @brief Deserialize 16 bit unsigned integer from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] u16 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_uint16(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ uint16_t *u16);
+
+/**
+ * @brief Serialize 16 bit signed integer to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] s16 Integer to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_int16(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ int16_t s16);
+
+/**
+ * @brief Deserialize 16 bit signed integer from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] s16 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_int16(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ int16_t *s16);
+
+/**
+ * @brief Serialize 32 bit unsigned integer to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] u32 Integer to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_uint32(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ uint32_t u32);
+
+/**
+ * @brief Deserialize 32 bit unsigned integer from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] u32 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_uint32(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ uint32_t *u32);
+
+/**
+ * @brief Serialize 32 bit signed integer to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] s32 Integer to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_int32(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ int32_t s32);
+
+/**
+ * @brief Deserialize 32 bit signed integer from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] s32 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_int32(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ int32_t *s32);
+
+/**
+ * @brief Serialize 64 bit unsigned integer to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] u64 Integer to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_uint64(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ uint64_t u64);
+
+/**
+ * @brief Deserialize 64 bit unsigned integer from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] u64 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_uint64(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ uint64_t *u64);
+
+/**
+ * @brief Serialize 64 bit signed integer to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] s64 Integer to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_int64(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ int64_t s64);
+
+/**
+ * @brief Deserialize 64 bit signed integer from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] s64 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_int64(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ int64_t *s64);
+
+/**
+ * @brief Serialize sai_size_t to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] value Sai_size_t to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_size(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ sai_size_t value);
+
+/**
+ * @brief Deserialize sai_size_t from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] value Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_size(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_size_t *value);
+
+/**
+ * @brief Serialize object id to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] oid Object id to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_object_id(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ sai_object_id_t oid);
+
+/**
+ * @brief Deserialize object id from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] oid Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_object_id(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_object_id_t *oid);
+
+/**
+ * @brief Serialize MAC address to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] mac MAC address to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_mac(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_mac_t mac);
+
+/**
+ * @brief Deserialize MAC address from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] mac Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_mac(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_mac_t mac);
+
+/**
+ * @brief Serialize SAI encrypt key to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] sak SAI encrypt key to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_encrypt_key(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_encrypt_key_t sak);
+
+/**
+ * @brief Deserialize SAI encrypt key from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] sak Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_encrypt_key(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_encrypt_key_t sak);
+
+/**
+ * @brief Serialize SAI authentication key to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] auth SAI authentication key to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_auth_key(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_auth_key_t auth);
+
+/**
+ * @brief Deserialize SAI authentication key from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] auth Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_auth_key(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_auth_key_t auth);
+
+/**
+ * @brief Serialize SAI MACsec SAK to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] sak SAI MACsec SAK to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_macsec_sak(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_sak_t sak);
+
+/**
+ * @brief Deserialize SAI MACsec SAK from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] sak Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_macsec_sak(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_macsec_sak_t sak);
+
+/**
+ * @brief Serialize SAI MACsec authentication key to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] auth SAI MACsec authentication key to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_macsec_auth_key(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_auth_key_t auth);
+
+/**
+ * @brief Deserialize SAI MACsec authentication key from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] auth Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_macsec_auth_key(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_macsec_auth_key_t auth);
+
+/**
+ * @brief Serialize SAI MACsec salt to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] salt SAI MACsec salt to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_macsec_salt(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_macsec_salt_t salt);
+
+/**
+ * @brief Deserialize SAI MACsec salt from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] salt Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_macsec_salt(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_macsec_salt_t salt);
+
+/**
+ * @brief Serialize enum value to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] meta Enum metadata, not used by binary format.
+ * @param[in] value Enum value to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_enum(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _In_ int32_t value);
+
+/**
+ * @brief Deserialize enum value from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[in] meta Enum metadata, not used by binary format.
+ * @param[out] value Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_enum(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _Out_ int32_t *value);
+
+/**
+ * @brief Serialize IPv4 address to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] ip4 IPv4 address to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_ip4(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ sai_ip4_t ip4);
+
+/**
+ * @brief Deserialize IPv4 address from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] ip4 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_ip4(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_ip4_t *ip4);
+
+/**
+ * @brief Serialize IPv6 address to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] ip6 IPv6 address to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_ip6(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip6_t ip6);
+
+/**
+ * @brief Deserialize IPv6 address from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] ip6 Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_ip6(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_ip6_t ip6);
+
+/**
+ * @brief Serialize IP address to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] ip_address IP address to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_ip_address(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip_address_t *ip_address);
+
+/**
+ * @brief Deserialize IP address from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] ip_address Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_ip_address(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_ip_address_t *ip_address);
+
+/**
+ * @brief Serialize IP prefix to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] ip_prefix IP prefix to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_ip_prefix(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_ip_prefix_t *ip_prefix);
+
+/**
+ * @brief Deserialize IP prefix from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] ip_prefix Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_ip_prefix(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_ip_prefix_t *ip_prefix);
+
+/**
+ * @brief Serialize pointer to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] pointer Pointer to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_pointer(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_pointer_t pointer);
+
+/**
+ * @brief Deserialize pointer from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] pointer Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_pointer(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_pointer_t *pointer);
+
+/**
+ * @brief Serialize enum list to binary format.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] meta Enum metadata, not used by binary format.
+ * @param[in] list Enum list to be serialized.
+ *
+ * @return Number of bytes needed to serialize value, value is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_enum_list(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _In_ const sai_s32_list_t *list);
+
+/**
+ * @brief Deserialize enum list from binary format.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[in] meta Enum metadata, not used by binary format.
+ * @param[out] list Deserialized value.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_enum_list(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _Out_ sai_s32_list_t *list);
+
+/**
+ * @brief Deserialize enum list from binary format using arena.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[in] meta Enum metadata, not used by binary format.
+ * @param[out] list Deserialized value.
+ * @param[inout] arena Arena for list allocation, or NULL to use calloc.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_enum_list_ex(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_enum_metadata_t *meta,
+        _Out_ sai_s32_list_t *list,
+        _Inout_ sai_deserialize_arena_t *arena);
+
+/**
+ * @brief Free enum list allocated by deserialize.
+ *
+ * @param[in] meta Enum metadata.
+ * @param[inout] list Enum list to be freed.
+ */
+void sai_deserialize_free_enum_list(
+        _In_ const sai_enum_metadata_t *meta,
+        _Inout_ sai_s32_list_t *list);
+
+/**
+ * @brief Serialize SAI attribute to binary format.
+ *
+ * Attribute is serialized as 32 bit attribute id, 32 bit value length and
+ * value, so reader can skip attributes which are not known to it.
+ *
+ * @param[out] buffer Output buffer for serialized value.
+ * @param[in] size Size of output buffer.
+ * @param[in] meta Attribute metadata.
+ * @param[in] attribute Attribute to be serialized.
+ *
+ * @return Number of bytes needed to serialize attribute, attribute is written
+ * only when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_attribute(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_attr_metadata_t *meta,
+        _In_ const sai_attribute_t *attribute);
+
+/**
+ * @brief Deserialize SAI attribute from binary format.
+ *
+ * Memory allocated for attribute value lists must be released by
+ * sai_deserialize_free_attribute.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[in] object_type Object type of attribute.
+ * @param[out] attribute Deserialized attribute.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_attribute(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ sai_object_type_t object_type,
+        _Out_ sai_attribute_t *attribute);
+
+/**
+ * @brief Deserialize SAI attribute from binary format using arena.
+ *
+ * When arena is NULL, lists are allocated using calloc and they are released
+ * on failure.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[in] object_type Object type of attribute.
+ * @param[out] attribute Deserialized attribute.
+ * @param[inout] arena Arena for list allocations, or NULL to use calloc.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_attribute_ex(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _In_ sai_object_type_t object_type,
+        _Out_ sai_attribute_t *attribute,
+        _Inout_ sai_deserialize_arena_t *arena);
+
+/**
+ * @brief Free SAI attribute allocated by deserialize.
+ *
+ * @param[in] meta Attribute metadata.
+ * @param[inout] attribute Attribute to be freed.
+ */
+void sai_deserialize_free_attribute(
+        _In_ const sai_attr_metadata_t *meta,
+        _Inout_ sai_attribute_t *attribute);
+
+/**
+ * @brief Serialize SAI object to binary format.
+ *
+ * Object is serialized as #SAI_SERIALIZE_BINARY_MAGIC,
+ * #SAI_SERIALIZE_BINARY_VERSION, object meta key, attribute count and
+ * attributes.
+ *
+ * @param[out] buffer Output buffer for serialized object.
+ * @param[in] size Size of output buffer.
+ * @param[in] meta_key Object meta key.
+ * @param[in] attr_count Number of attributes.
+ * @param[in] attr_list List of object attributes.
+ *
+ * @return Number of bytes needed to serialize object, object is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_binary_object(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const sai_object_meta_key_t *meta_key,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list);
+
+/**
+ * @brief Deserialize SAI object from binary format.
+ *
+ * Attributes unknown to this version of metadata are skipped. Attribute list
+ * is allocated and must be released by sai_deserialize_free_binary_object.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] size Size of input buffer.
+ * @param[out] meta_key Object meta key.
+ * @param[out] attr_count Number of deserialized attributes.
+ * @param[out] attr_list Deserialized attribute list.
+ *
+ * @return Number of bytes consumed from buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_object(
+        _In_ const uint8_t *buffer,
+        _In_ size_t size,
+        _Out_ sai_object_meta_key_t *meta_key,
+        _Out_ uint32_t *attr_count,
+        _Out_ sai_attribute_t **attr_list);
+
+/**
+ * @brief Free SAI object allocated by binary deserialize.
+ *
+ * @param[inout] meta_key Object meta key.
+ * @param[in] attr_count Number of attributes.
+ * @param[inout] attr_list Attribute list to be freed.
+ */
+void sai_deserialize_free_binary_object(
+        _Inout_ sai_object_meta_key_t *meta_key,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list);
+
+/**
+ * @brief Convert binary serialized SAI object to json.
+ *
+ * Json object has format {"key":<meta key>,"attributes":[<attribute>,...]}.
+ *
+ * @param[out] json Output buffer for json.
+ * @param[in] json_size Size of json buffer including '\0'.
+ * @param[in] buffer Binary serialized object.
+ * @param[in] size Size of binary serialized object.
+ *
+ * @return Number of characters that would be written to json buffer
+ * excluding '\0' if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_binary_object_to_json(
+        _Out_ char *json,
+        _In_ size_t json_size,
+        _In_ const uint8_t *buffer,
+        _In_ size_t size);
+
+/**
+ * @brief Convert json SAI object to binary format.
+ *
+ * @param[out] buffer Output buffer for binary serialized object.
+ * @param[in] size Size of output buffer.
+ * @param[in] json Json object produced by sai_deserialize_binary_object_to_json.
+ *
+ * @return Number of bytes needed to serialize object, object is written only
+ * when it fits in buffer, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_json_object_to_binary(
+        _Out_ uint8_t *buffer,
+        _In_ size_t size,
+        _In_ const char *json);
+
+/**
+ * @brief Initialize deserialize arena.
+ *
+ * No memory is allocated until first list is deserialized.
+ *
+ * @param[out] arena Arena to be initialized.
+ * @param[in] block_size Minimum size of single memory block, larger lists
+ * get dedicated block. Zero selects default size.
+ */
+void sai_deserialize_arena_init(
+        _Out_ sai_deserialize_arena_t *arena,
+        _In_ size_t block_size);
+
+/**
+ * @brief Allocate zeroed memory for list.
+ *
+ * @param[inout] arena Arena to allocate from, or NULL to use calloc.
+ * @param[in] count Number of list items.
+ * @param[in] size Size of single list item.
+ *
+ * @return Pointer to zeroed memory or NULL on failure.
+ */
+void *sai_deserialize_arena_alloc(
+        _Inout_ sai_deserialize_arena_t *arena,
+        _In_ size_t count,
+        _In_ size_t size);
+
+/**
+ * @brief Release all lists allocated from arena.
+ *
+ * First memory block is kept, so next batch of deserialize calls don't need
+ * to allocate memory if it fits in that block.
+ *
+ * @param[inout] arena Arena to be reset.
+ */
+void sai_deserialize_arena_reset(
+        _Inout_ sai_deserialize_arena_t *arena);
+
+/**
+ * @brief Release all memory blocks of arena.
+ *
+ * @param[inout] arena Arena to be freed.
+ */
+void sai_deserialize_arena_free(
+        _Inout_ sai_deserialize_arena_t *arena);
+
+/**
+ * @brief Deserialize view of encrypt key.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] view View of key bytes in input buffer.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_encrypt_key_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view);
+
+/**
+ * @brief Deserialize view of authentication key.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] view View of key bytes in input buffer.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_auth_key_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view);
+
+/**
+ * @brief Deserialize view of MACsec SAK.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] view View of key bytes in input buffer.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_macsec_sak_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view);
+
+/**
+ * @brief Deserialize view of MACsec authentication key.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] view View of key bytes in input buffer.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_macsec_auth_key_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view);
+
+/**
+ * @brief Deserialize view of MACsec salt.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] view View of salt bytes in input buffer.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_macsec_salt_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view);
+
+/**
+ * @brief Decode bytes of key view.
+ *
+ * @param[in] view View created by one of key view methods.
+ * @param[out] data Output buffer for bytes.
+ * @param[in] size Size of output buffer.
+ *
+ * @return Number of decoded bytes, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_view_bytes(
+        _In_ const sai_deserialize_view_t *view,
+        _Out_ uint8_t *data,
+        _In_ size_t size);
+
+/**
+ * @brief Deserialize view of chardata.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] view View of characters in input buffer.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_chardata_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view);
+
+/**
+ * @brief Decode chardata view.
+ *
+ * @param[in] view View created by sai_deserialize_chardata_view.
+ * @param[out] data Decoded chardata.
+ *
+ * @return Number of characters in chardata, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_view_chardata(
+        _In_ const sai_deserialize_view_t *view,
+        _Out_ char data[SAI_CHARDATA_LENGTH]);
+
+/**
+ * @brief Deserialize view of uint8 array.
+ *
+ * Array is in format [1,2,3] or null, this is how void pointer buffers
+ * like packet of packet event notification are serialized.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[in] count Number of items in array.
+ * @param[out] view View of array items in input buffer.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_uint8_array_view(
+        _In_ const char *buffer,
+        _In_ uint32_t count,
+        _Out_ sai_deserialize_view_t *view);
+
+/**
+ * @brief Deserialize view of u8 list.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] view View of list items in input buffer.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_u8_list_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_view_t *view);
+
+/**
+ * @brief Decode u8 list view into user provided list.
+ *
+ * When list is too small, list count is set to required number of items
+ * and error is returned. Null list sets only list count.
+ *
+ * @param[in] view View created by sai_deserialize_u8_list_view or
+ * sai_deserialize_uint8_array_view.
+ * @param[inout] list List with allocated buffer, count is size of buffer.
+ *
+ * @return Number of decoded items, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_view_u8_list(
+        _In_ const sai_deserialize_view_t *view,
+        _Inout_ sai_u8_list_t *list);
+
+/**
+ * @brief Deserialize view of SAI attribute.
+ *
+ * Attribute id is deserialized and structure of value is validated, but
+ * value is not decoded. For u8 list, chardata and key values data view is
+ * also created.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] attribute_view Deserialized attribute view.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_attribute_view(
+        _In_ const char *buffer,
+        _Out_ sai_deserialize_attribute_view_t *attribute_view);
+
+/**
+ * @brief Decode attribute view.
+ *
+ * @param[in] attribute_view View created by sai_deserialize_attribute_view.
+ * @param[out] attribute Decoded attribute.
+ * @param[inout] arena Arena for list allocations, or NULL to use calloc.
+ *
+ * @return Number of characters of value consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_view_attribute(
+        _In_ const sai_deserialize_attribute_view_t *attribute_view,
+        _Out_ sai_attribute_t *attribute,
+        _Inout_ sai_deserialize_arena_t *arena);
+
+/**
+ * @brief Serialize bulk create operation.
+ *
+ * Bulk create is serialized as json object {"object_type":<object type>,
+ * "mode":<mode>,"object_count":<count>,"objects":[{"key":<key>,
+ * "status":<status>,"attributes":[<attribute>,...]},...]}. Attribute metadata
+ * is resolved once per attribute position, so objects which have the same
+ * attribute ids in the same order share metadata lookup.
+ *
+ * @param[out] buffer Output buffer for serialized bulk create.
+ * @param[in] size Size of output buffer including '\0'.
+ * @param[in] object_type Object type of all objects.
+ * @param[in] object_count Number of objects.
+ * @param[in] object_key List of object keys, or NULL if keys are not known
+ * yet (object ids are assigned by create).
+ * @param[in] attr_count List of attribute counts for each object.
+ * @param[in] attr_list List of attribute lists for each object.
+ * @param[in] mode Bulk operation error handling mode.
+ * @param[in] object_statuses List of object statuses, or NULL if operation
+ * was not executed yet.
+ *
+ * @return Number of characters that would be written to buffer excluding
+ * '\0' if buffer was large enough, or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_serialize_bulk_create(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_entry_t *object_key,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _In_ const sai_status_t *object_statuses);
+
+/**
+ * @brief Deserialize bulk create operation.
+ *
+ * All lists, including object keys, attribute counts, attribute lists and
+ * object statuses are allocated from arena and they are released by arena
+ * reset. Missing keys are zeroed and missing statuses are set to
+ * #SAI_STATUS_NOT_EXECUTED.
+ *
+ * @param[in] buffer Input buffer to be examined.
+ * @param[out] object_type Object type of all objects.
+ * @param[out] object_count Number of objects.
+ * @param[out] object_key List of object keys.
+ * @param[out] attr_count List of attribute counts for each object.
+ * @param[out] attr_list List of attribute lists for each object.
+ * @param[out] mode Bulk operation error handling mode.
+ * @param[out] object_statuses List of object statuses.
+ * @param[inout] arena Arena for all allocations, must not be NULL.
+ *
+ * @return Number of characters consumed from the buffer,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_bulk_create(
+        _In_ const char *buffer,
+        _Out_ sai_object_type_t *object_type,
+        _Out_ uint32_t *object_count,
+        _Out_ sai_object_key_entry_t **object_key,
+        _Out_ uint32_t **attr_count,
+        _Out_ sai_attribute_t ***attr_list,
+        _Out_ sai_bulk_op_error_mode_t *mode,
+        _Out_ sai_status_t **object_statuses,
+        _Inout_ sai_deserialize_arena_t *arena);
+
+/**
+ * @brief Initialize deserialize stream.
+ *
+ * @param[out] stream Stream to be initialized.
+ * @param[in] max_length Maximum number of buffered characters, zero selects
+ * default of 64 KB.
+ */
+void sai_deserialize_stream_init(
+        _Out_ sai_deserialize_stream_t *stream,
+        _In_ size_t max_length);
+
+/**
+ * @brief Push chunk of input to deserialize stream.
+ *
+ * Attributes can be separated by white space and commas, and they can be
+ * enclosed in matched, not nested square brackets. Attribute can be split
+ * between chunks at any position. Push fails as soon as incomplete attribute gets longer than
+ * maximum length and it can't be split, without waiting for its end. After
+ * error stream can be only freed, batches of split attribute passed to
+ * callback before error should be discarded.
+ *
+ * @param[inout] stream Deserialize stream.
+ * @param[in] data Chunk of input, it don't need to be NULL terminated.
+ * @param[in] size Size of chunk.
+ * @param[in] callback Callback called for each attribute completed by chunk.
+ * @param[in] context User context, available to callback as stream context.
+ *
+ * @return Number of attributes completed by this chunk,
+ * or #SAI_SERIALIZE_ERROR on error.
+ */
+int sai_deserialize_stream_push(
+        _Inout_ sai_deserialize_stream_t *stream,
+        _In_ const char *data,
+        _In_ size_t size,
+        _In_ sai_deserialize_stream_fn callback,
+        _In_ sai_pointer_t context);
+
+/**
+ * @brief Finish deserialize stream.
+ *
+ * @param[in] stream Deserialize stream.
+ *
+ * @return Zero if input ended between attributes, or #SAI_SERIALIZE_ERROR
+ * if last attribute or top level array is incomplete.
+ */
+int sai_deserialize_stream_finish(
+        _In_ const sai_deserialize_stream_t *stream);
+
+/**
+ * @brief Release memory of deserialize stream.
+ *
+ * @param[inout] stream Deserialize stream.
+ */
+void sai_deserialize_stream_free(
+        _Inout_ sai_deserialize_stream_t *stream);
+
 /**
  * @}
  */
@@ -0,0 +1,1003 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saiserializeperf.c
+ *
+ * @brief   This module defines SAI Serialize performance test
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <arpa/inet.h>
+#include <sai.h>
+
+#include "saimetadata.h"
+
+#define PRIMITIVE_BUFFER_SIZE 128
+#define DEFAULT_ITERATIONS 1000000
+
+/*
+ * Each test is executed given number of iterations and average time of
+ * single operation is printed. Functions named perf_printf_* are reference
+ * implementations using printf family functions, they show how fast serialize
+ * was before specialized formatting was introduced. Functions named
+ * perf_sscanf_*, perf_inet_pton_* and perf_inet_ntop_* are reference
+ * implementations of hex and ip address parsing and formatting. Functions
+ * named perf_linear_* and perf_binary_search_* are reference implementations
+ * using linear and binary search.
+ */
+
+typedef void (*perf_fn_t)(uint32_t idx);
+
+static char perf_buf[PRIMITIVE_BUFFER_SIZE * 4];
+
+static volatile int perf_sink;
+
+static uint32_t perf_iterations = DEFAULT_ITERATIONS;
+
+static uint64_t perf_value(
+        _In_ uint32_t idx)
+{
+    /* spread values over whole range, so different lengths are tested */
+
+    return ((uint64_t)idx * UINT64_C(0x9E3779B97F4A7C15)) >> (idx % 64);
+}
+
+static void perf_run(
+        _In_ const char *name,
+        _In_ perf_fn_t fn)
+{
+    uint32_t idx;
+
+    clock_t start = clock();
+
+    for (idx = 0; idx < perf_iterations; idx++)
+    {
+        fn(idx);
+    }
+
+    clock_t end = clock();
+
+    double ns = (double)(end - start) * 1e9 / CLOCKS_PER_SEC / perf_iterations;
+
+    printf("%-40s %10.1f ns/op\n", name, ns);
+}
+
+static void perf_printf_uint64(
+        _In_ uint32_t idx)
+{
+    perf_sink = sprintf(perf_buf, "%"PRIu64, perf_value(idx));
+}
+
+static void perf_serialize_uint64(
+        _In_ uint32_t idx)
+{
+    perf_sink = sai_serialize_uint64(perf_buf, perf_value(idx));
+}
+
+static void perf_printf_int32(
+        _In_ uint32_t idx)
+{
+    perf_sink = sprintf(perf_buf, "%d", (int32_t)perf_value(idx));
+}
+
+static void perf_serialize_int32(
+        _In_ uint32_t idx)
+{
+    perf_sink = sai_serialize_int32(perf_buf, (int32_t)perf_value(idx));
+}
+
+static void perf_printf_object_id(
+        _In_ uint32_t idx)
+{
+    perf_sink = sprintf(perf_buf, "oid:0x%"PRIx64, perf_value(idx));
+}
+
+static void perf_serialize_object_id(
+        _In_ uint32_t idx)
+{
+    perf_sink = sai_serialize_object_id(perf_buf, perf_value(idx));
+}
+
+static void perf_printf_mac(
+        _In_ uint32_t idx)
+{
+    uint64_t v = perf_value(idx);
+
+    const uint8_t *mac = (const uint8_t*)&v;
+
+    perf_sink = sprintf(perf_buf, "%02X:%02X:%02X:%02X:%02X:%02X",
+            mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
+
+static void perf_serialize_mac(
+        _In_ uint32_t idx)
+{
+    uint64_t v = perf_value(idx);
+
+    perf_sink = sai_serialize_mac(perf_buf, (const uint8_t*)&v);
+}
+
+static void perf_printf_ip4(
+        _In_ uint32_t idx)
+{
+    sai_ip4_t ip4 = (sai_ip4_t)perf_value(idx);
+
+    perf_sink = (inet_ntop(AF_INET, &ip4, perf_buf, INET_ADDRSTRLEN) != NULL);
+}
+
+static void perf_serialize_ip4(
+        _In_ uint32_t idx)
+{
+    perf_sink = sai_serialize_ip4(perf_buf, (sai_ip4_t)perf_value(idx));
+}
+
+static void perf_ip6(
+        _In_ uint32_t idx,
+        _Out_ sai_ip6_t ip6)
+{
+    uint64_t hi = perf_value(idx);
+    uint64_t lo = perf_value(idx + 1);
+
+    /* every other address has zero run in the middle, to exercise "::" */
+
+    memcpy(ip6, &hi, 8);
+    memcpy(ip6 + 8, &lo, 8);
+
+    if (idx % 2)
+    {
+        memset(ip6 + 4, 0, 8);
+    }
+}
+
+static void perf_inet_ntop_ip6(
+        _In_ uint32_t idx)
+{
+    sai_ip6_t ip6;
+
+    perf_ip6(idx, ip6);
+
+    perf_sink = (inet_ntop(AF_INET6, ip6, perf_buf, INET6_ADDRSTRLEN) != NULL);
+}
+
+static void perf_serialize_ip6(
+        _In_ uint32_t idx)
+{
+    sai_ip6_t ip6;
+
+    perf_ip6(idx, ip6);
+
+    perf_sink = sai_serialize_ip6(perf_buf, ip6);
+}
+
+/*
+ * Text tables contain serialized values used as input for deserialize tests,
+ * so time spent on formatting is not measured.
+ */
+
+#define PERF_TEXT_COUNT 256
+
+static char perf_mac_text[PERF_TEXT_COUNT][PRIMITIVE_BUFFER_SIZE];
+
+static char perf_ip6_text[PERF_TEXT_COUNT][PRIMITIVE_BUFFER_SIZE];
+
+static char perf_encrypt_key_text[PERF_TEXT_COUNT][PRIMITIVE_BUFFER_SIZE];
+
+static void perf_text_create(void)
+{
+    uint32_t idx;
+
+    for (idx = 0; idx < PERF_TEXT_COUNT; idx++)
+    {
+        uint64_t v = perf_value(idx);
+
+        sai_encrypt_key_t key;
+        sai_ip6_t ip6;
+
+        perf_ip6(idx, ip6);
+
+        memcpy(key, ip6, 16);
+        memcpy(key + 16, ip6, 16);
+
+        sai_serialize_mac(perf_mac_text[idx], (const uint8_t*)&v);
+        sai_serialize_ip6(perf_ip6_text[idx], ip6);
+        sai_serialize_encrypt_key(perf_encrypt_key_text[idx], key);
+    }
+}
+
+static void perf_sscanf_mac(
+        _In_ uint32_t idx)
+{
+    unsigned int mac[6];
+
+    perf_sink = sscanf(perf_mac_text[idx % PERF_TEXT_COUNT], "%2x:%2x:%2x:%2x:%2x:%2x",
+            &mac[0], &mac[1], &mac[2], &mac[3], &mac[4], &mac[5]);
+}
+
+static void perf_deserialize_mac(
+        _In_ uint32_t idx)
+{
+    sai_mac_t mac;
+
+    perf_sink = sai_deserialize_mac(perf_mac_text[idx % PERF_TEXT_COUNT], mac);
+}
+
+static void perf_inet_pton_ip6(
+        _In_ uint32_t idx)
+{
+    sai_ip6_t ip6;
+
+    perf_sink = inet_pton(AF_INET6, perf_ip6_text[idx % PERF_TEXT_COUNT], ip6);
+}
+
+static void perf_deserialize_ip6(
+        _In_ uint32_t idx)
+{
+    sai_ip6_t ip6;
+
+    perf_sink = sai_deserialize_ip6(perf_ip6_text[idx % PERF_TEXT_COUNT], ip6);
+}
+
+static void perf_sscanf_encrypt_key(
+        _In_ uint32_t idx)
+{
+    const char *buf = perf_encrypt_key_text[idx % PERF_TEXT_COUNT];
+
+    unsigned int byte = 0;
+    int len = 0;
+    int i;
+
+    for (i = 0; i < 32; i++, buf += len)
+    {
+        if (sscanf(buf, i ? ":%2x%n" : "%2x%n", &byte, &len) != 1)
+        {
+            break;
+        }
+    }
+
+    perf_sink = i + (int)byte;
+}
+
+static void perf_deserialize_encrypt_key(
+        _In_ uint32_t idx)
+{
+    sai_encrypt_key_t key;
+
+    perf_sink = sai_deserialize_encrypt_key(perf_encrypt_key_text[idx % PERF_TEXT_COUNT], key);
+}
+
+static void perf_serialize_route_entry(
+        _In_ uint32_t idx)
+{
+    sai_route_entry_t re;
+
+    re.switch_id = perf_value(idx);
+    re.vr_id = perf_value(idx + 1);
+    re.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    re.destination.addr.ip4 = (sai_ip4_t)perf_value(idx);
+    re.destination.mask.ip4 = htonl(0xffffff00);
+
+    perf_sink = sai_serialize_route_entry(perf_buf, &re);
+}
+
+/*
+ * Enum dump contains quoted names of all values of all enums, as they would
+ * appear in serialized attributes.
+ */
+
+typedef struct _perf_enum_entry_t
+{
+    const sai_enum_metadata_t *meta;
+
+    int32_t value;
+
+    char name[PRIMITIVE_BUFFER_SIZE];
+
+} perf_enum_entry_t;
+
+static perf_enum_entry_t *perf_enum_dump;
+
+static uint32_t perf_enum_dump_count;
+
+static void perf_enum_dump_create(void)
+{
+    size_t i;
+    size_t j;
+
+    for (i = 0; i < sai_metadata_all_enums_count; i++)
+    {
+        perf_enum_dump_count += (uint32_t)sai_metadata_all_enums[i]->valuescount;
+    }
+
+    perf_enum_dump = (perf_enum_entry_t*)calloc(perf_enum_dump_count, sizeof(perf_enum_entry_t));
+
+    if (perf_enum_dump == NULL)
+    {
+        fprintf(stderr, "failed to allocate enum dump\n");
+        exit(EXIT_FAILURE);
+    }
+
+    perf_enum_entry_t *entry = perf_enum_dump;
+
+    for (i = 0; i < sai_metadata_all_enums_count; i++)
+    {
+        const sai_enum_metadata_t *meta = sai_metadata_all_enums[i];
+
+        for (j = 0; j < meta->valuescount; j++, entry++)
+        {
+            entry->meta = meta;
+            entry->value = meta->values[j];
+
+            sprintf(entry->name, "%s\"", meta->valuesnames[j]);
+        }
+    }
+}
+
+static const perf_enum_entry_t* perf_enum_entry(
+        _In_ uint32_t idx)
+{
+    /* spread lookups over all enums, so they don't stay in cache */
+
+    return &perf_enum_dump[(uint32_t)perf_value(idx + 1) % perf_enum_dump_count];
+}
+
+static void perf_linear_serialize_enum(
+        _In_ uint32_t idx)
+{
+    const perf_enum_entry_t *entry = perf_enum_entry(idx);
+
+    size_t i;
+
+    for (i = 0; i < entry->meta->valuescount; i++)
+    {
+        if (entry->meta->values[i] == entry->value)
+        {
+            perf_sink = (int)strlen(strcpy(perf_buf, entry->meta->valuesnames[i]));
+            return;
+        }
+    }
+}
+
+static void perf_serialize_enum(
+        _In_ uint32_t idx)
+{
+    const perf_enum_entry_t *entry = perf_enum_entry(idx);
+
+    perf_sink = sai_serialize_enum(perf_buf, entry->meta, entry->value);
+}
+
+static void perf_linear_deserialize_enum(
+        _In_ uint32_t idx)
+{
+    const perf_enum_entry_t *entry = perf_enum_entry(idx);
+
+    size_t i;
+
+    for (i = 0; i < entry->meta->valuescount; i++)
+    {
+        size_t len = strlen(entry->meta->valuesnames[i]);
+
+        if (strncmp(entry->meta->valuesnames[i], entry->name, len) == 0 &&
+                sai_serialize_is_char_allowed(entry->name[len]))
+        {
+            perf_sink = entry->meta->values[i];
+            return;
+        }
+    }
+}
+
+static void perf_deserialize_enum(
+        _In_ uint32_t idx)
+{
+    const perf_enum_entry_t *entry = perf_enum_entry(idx);
+
+    int32_t value;
+
+    perf_sink = sai_deserialize_enum(entry->name, entry->meta, &value);
+}
+
+/*
+ * Attributes with lists are deserialized using calloc for each list and using
+ * arena, which is reset after each batch of attributes.
+ */
+
+#define PERF_ATTR_COUNT 64
+#define PERF_ATTR_BATCH 256
+
+static char perf_attr_buf[PERF_ATTR_COUNT][PRIMITIVE_BUFFER_SIZE * 4];
+
+static const sai_attr_metadata_t *perf_attr_meta[PERF_ATTR_COUNT];
+
+static sai_deserialize_arena_t perf_arena;
+
+static void perf_attr_create(void)
+{
+    sai_object_id_t oids[2];
+    uint32_t lanes[4];
+    sai_attribute_t attr;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0; i < PERF_ATTR_COUNT; i++)
+    {
+        if (i % 2)
+        {
+            for (j = 0; j < 2; j++)
+            {
+                oids[j] = perf_value(i + j);
+            }
+
+            attr.id = SAI_PORT_ATTR_INGRESS_MIRROR_SESSION;
+            attr.value.objlist.count = 2;
+            attr.value.objlist.list = oids;
+        }
+        else
+        {
+            for (j = 0; j < 4; j++)
+            {
+                lanes[j] = (uint32_t)perf_value(i + j);
+            }
+
+            attr.id = SAI_PORT_ATTR_HW_LANE_LIST;
+            attr.value.u32list.count = 4;
+            attr.value.u32list.list = lanes;
+        }
+
+        perf_attr_meta[i] = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_PORT, attr.id);
+
+        if (sai_serialize_attribute(perf_attr_buf[i], perf_attr_meta[i], &attr) < 0)
+        {
+            fprintf(stderr, "failed to serialize attribute %s\n", perf_attr_meta[i]->attridname);
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+static void perf_deserialize_attribute(
+        _In_ uint32_t idx)
+{
+    sai_attribute_t attr;
+
+    perf_sink = sai_deserialize_attribute(perf_attr_buf[idx % PERF_ATTR_COUNT], &attr);
+
+    sai_deserialize_free_attribute(perf_attr_meta[idx % PERF_ATTR_COUNT], &attr);
+}
+
+static void perf_deserialize_attribute_arena(
+        _In_ uint32_t idx)
+{
+    sai_attribute_t attr;
+
+    perf_sink = sai_deserialize_attribute_ex(perf_attr_buf[idx % PERF_ATTR_COUNT], &attr, &perf_arena);
+
+    if ((idx + 1) % PERF_ATTR_BATCH == 0)
+    {
+        sai_deserialize_arena_reset(&perf_arena);
+    }
+}
+
+/*
+ * Attribute dump contains all attributes serialized with zero value, so
+ * attribute id name lookup is spread over all attribute names.
+ */
+
+#define PERF_ATTR_DUMP_SIZE (PRIMITIVE_BUFFER_SIZE * 8)
+#define PERF_ATTR_ID_PREFIX "{\"id\":\""
+
+static char *perf_attr_dump;
+
+static uint32_t perf_attr_dump_count;
+
+static void perf_attr_dump_create(void)
+{
+    size_t i;
+
+    perf_attr_dump = (char*)calloc(sai_metadata_attr_sorted_by_id_name_count, PERF_ATTR_DUMP_SIZE);
+
+    if (perf_attr_dump == NULL)
+    {
+        fprintf(stderr, "failed to allocate attribute dump\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (i = 0; i < sai_metadata_attr_sorted_by_id_name_count; i++)
+    {
+        const sai_attr_metadata_t *meta = sai_metadata_attr_sorted_by_id_name[i];
+
+        sai_attribute_t attr;
+
+        memset(&attr, 0, sizeof(attr));
+
+        attr.id = meta->attrid;
+
+        char *buf = perf_attr_dump + (size_t)perf_attr_dump_count * PERF_ATTR_DUMP_SIZE;
+
+        int len = sai_serialize_attribute_value_length(meta, &attr.value);
+
+        if (len < 0 || (size_t)len + strlen(meta->attridname) + sizeof(PERF_ATTR_ID_PREFIX "\",\"value\":}") > PERF_ATTR_DUMP_SIZE)
+        {
+            continue;
+        }
+
+        if (sai_serialize_attribute(buf, meta, &attr) < 0)
+        {
+            /* attribute which can't be serialized with zero value */
+            continue;
+        }
+
+        perf_attr_dump_count++;
+    }
+}
+
+static const char* perf_attr_dump_entry(
+        _In_ uint32_t idx)
+{
+    return perf_attr_dump + (size_t)((uint32_t)perf_value(idx + 1) % perf_attr_dump_count) * PERF_ATTR_DUMP_SIZE;
+}
+
+static void perf_binary_search_attr_id_name(
+        _In_ uint32_t idx)
+{
+    const char *name = perf_attr_dump_entry(idx) + sizeof(PERF_ATTR_ID_PREFIX) - 1;
+
+    size_t first = 0;
+    size_t last = sai_metadata_attr_sorted_by_id_name_count;
+
+    while (first < last)
+    {
+        size_t middle = first + (last - first) / 2;
+
+        size_t len;
+
+        const char *attridname = sai_metadata_attr_sorted_by_id_name[middle]->attridname;
+
+        for (len = 0; attridname[len] == name[len] && attridname[len] != 0; len++)
+        {
+        }
+
+        int res = (sai_serialize_is_char_allowed(name[len]) ? 0 : (unsigned char)name[len]) - (unsigned char)attridname[len];
+
+        if (res == 0)
+        {
+            perf_sink = (int)middle;
+            return;
+        }
+
+        if (res > 0)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+}
+
+static void perf_get_attr_metadata_by_attr_id_name(
+        _In_ uint32_t idx)
+{
+    const sai_attr_metadata_t *meta = sai_metadata_get_attr_metadata_by_attr_id_name_ext(perf_attr_dump_entry(idx) + sizeof(PERF_ATTR_ID_PREFIX) - 1);
+
+    perf_sink = (int)meta->attrid;
+}
+
+static void perf_deserialize_attribute_dump(
+        _In_ uint32_t idx)
+{
+    sai_attribute_t attr;
+
+    perf_sink = sai_deserialize_attribute_ex(perf_attr_dump_entry(idx), &attr, &perf_arena);
+
+    if ((idx + 1) % PERF_ATTR_BATCH == 0)
+    {
+        sai_deserialize_arena_reset(&perf_arena);
+    }
+}
+
+/*
+ * Bulk create of route entries, bulk functions process whole bulk once per
+ * PERF_BULK_COUNT iterations, so printed time is per single object. Functions
+ * named perf_loop_* are reference implementations serializing each attribute
+ * separately with metadata lookup for each attribute.
+ */
+
+#define PERF_BULK_COUNT 1024
+#define PERF_BULK_ATTR_COUNT 2
+
+static sai_object_key_entry_t perf_bulk_key[PERF_BULK_COUNT];
+
+static sai_attribute_t perf_bulk_attr[PERF_BULK_COUNT][PERF_BULK_ATTR_COUNT];
+
+static const sai_attribute_t *perf_bulk_attr_list[PERF_BULK_COUNT];
+
+static uint32_t perf_bulk_attr_count[PERF_BULK_COUNT];
+
+static sai_status_t perf_bulk_status[PERF_BULK_COUNT];
+
+static char perf_bulk_key_text[PERF_BULK_COUNT][PRIMITIVE_BUFFER_SIZE * 2];
+
+static char perf_bulk_attr_text[PERF_BULK_COUNT][PERF_BULK_ATTR_COUNT][PRIMITIVE_BUFFER_SIZE];
+
+static char *perf_bulk_buf;
+
+static size_t perf_bulk_size;
+
+static size_t perf_bulk_pos;
+
+static void perf_bulk_create(void)
+{
+    const sai_attr_metadata_t *meta;
+    uint32_t idx;
+    uint32_t n;
+    int ret;
+
+    for (idx = 0; idx < PERF_BULK_COUNT; idx++)
+    {
+        sai_route_entry_t *re = &perf_bulk_key[idx].route_entry;
+
+        re->switch_id = perf_value(0);
+        re->vr_id = perf_value(1);
+        re->destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        re->destination.addr.ip4 = (sai_ip4_t)perf_value(idx);
+        re->destination.mask.ip4 = htonl(0xffffff00);
+
+        perf_bulk_attr[idx][0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+        perf_bulk_attr[idx][0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+        perf_bulk_attr[idx][1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+        perf_bulk_attr[idx][1].value.oid = perf_value(idx);
+
+        perf_bulk_attr_list[idx] = perf_bulk_attr[idx];
+        perf_bulk_attr_count[idx] = PERF_BULK_ATTR_COUNT;
+        perf_bulk_status[idx] = SAI_STATUS_SUCCESS;
+
+        sai_serialize_object_key_entry(perf_bulk_key_text[idx], SAI_OBJECT_TYPE_ROUTE_ENTRY, &perf_bulk_key[idx]);
+
+        for (n = 0; n < PERF_BULK_ATTR_COUNT; n++)
+        {
+            meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_ROUTE_ENTRY, perf_bulk_attr[idx][n].id);
+
+            sai_serialize_attribute(perf_bulk_attr_text[idx][n], meta, &perf_bulk_attr[idx][n]);
+        }
+    }
+
+    ret = sai_serialize_bulk_create(NULL, 0, SAI_OBJECT_TYPE_ROUTE_ENTRY, PERF_BULK_COUNT, perf_bulk_key,
+            perf_bulk_attr_count, perf_bulk_attr_list, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, perf_bulk_status);
+
+    perf_bulk_size = (size_t)ret + 1;
+    perf_bulk_buf = (char*)malloc(perf_bulk_size);
+
+    if (ret < 0 || perf_bulk_buf == NULL)
+    {
+        fprintf(stderr, "failed to create bulk buffer\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void perf_loop_serialize_bulk_create(
+        _In_ uint32_t idx)
+{
+    const sai_attr_metadata_t *meta;
+    uint32_t i = idx % PERF_BULK_COUNT;
+    uint32_t n;
+
+    if (i == 0)
+    {
+        perf_bulk_pos = 0;
+    }
+
+    perf_bulk_pos += (size_t)sai_serialize_object_key_entry_n(perf_bulk_buf + perf_bulk_pos, perf_bulk_size - perf_bulk_pos,
+            SAI_OBJECT_TYPE_ROUTE_ENTRY, &perf_bulk_key[i]);
+
+    for (n = 0; n < PERF_BULK_ATTR_COUNT; n++)
+    {
+        meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_ROUTE_ENTRY, perf_bulk_attr[i][n].id);
+
+        perf_bulk_pos += (size_t)sai_serialize_attribute_n(perf_bulk_buf + perf_bulk_pos, perf_bulk_size - perf_bulk_pos,
+                meta, &perf_bulk_attr[i][n]);
+    }
+}
+
+static void perf_serialize_bulk_create(
+        _In_ uint32_t idx)
+{
+    if (idx % PERF_BULK_COUNT == 0)
+    {
+        perf_sink = sai_serialize_bulk_create(perf_bulk_buf, perf_bulk_size, SAI_OBJECT_TYPE_ROUTE_ENTRY,
+                PERF_BULK_COUNT, perf_bulk_key, perf_bulk_attr_count, perf_bulk_attr_list,
+                SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, perf_bulk_status);
+    }
+}
+
+static void perf_loop_deserialize_bulk_create(
+        _In_ uint32_t idx)
+{
+    sai_object_key_entry_t key;
+    sai_attribute_t attr;
+    uint32_t i = idx % PERF_BULK_COUNT;
+    uint32_t n;
+
+    if (i == 0)
+    {
+        sai_deserialize_arena_reset(&perf_arena);
+    }
+
+    perf_sink = sai_deserialize_object_key_entry_ex(perf_bulk_key_text[i], SAI_OBJECT_TYPE_ROUTE_ENTRY, &key, &perf_arena);
+
+    for (n = 0; n < PERF_BULK_ATTR_COUNT; n++)
+    {
+        perf_sink = sai_deserialize_attribute_ex(perf_bulk_attr_text[i][n], &attr, &perf_arena);
+    }
+}
+
+static void perf_deserialize_bulk_create(
+        _In_ uint32_t idx)
+{
+    sai_object_type_t object_type;
+    uint32_t object_count;
+    sai_object_key_entry_t *object_key;
+    uint32_t *attr_count;
+    sai_attribute_t **attr_list;
+    sai_bulk_op_error_mode_t mode;
+    sai_status_t *object_statuses;
+
+    if (idx % PERF_BULK_COUNT == 0)
+    {
+        sai_deserialize_arena_reset(&perf_arena);
+
+        perf_sink = sai_deserialize_bulk_create(perf_bulk_buf, &object_type, &object_count, &object_key,
+                &attr_count, &attr_list, &mode, &object_statuses, &perf_arena);
+    }
+}
+
+/*
+ * Create validation of route entry with bulk route entry attributes and ACL
+ * entry with all attributes allowed on create. Functions named
+ * perf_loop_validate_* are reference implementations checking each attribute
+ * metadata and looking for duplicated and mandatory attributes using
+ * sai_metadata_get_attr_by_id. ACL entry list is large and reference is
+ * quadratic, so ACL entry tests run PERF_VALIDATE_ACL_DIVISOR times less
+ * iterations.
+ */
+
+#define PERF_VALIDATE_ACL_DIVISOR 100
+
+static sai_attribute_t *perf_acl_attr;
+
+static uint32_t perf_acl_attr_count;
+
+static void perf_acl_create(void)
+{
+    const sai_object_type_info_t *oi = sai_metadata_get_object_type_info(SAI_OBJECT_TYPE_ACL_ENTRY);
+    size_t idx;
+
+    perf_acl_attr = (sai_attribute_t*)calloc(oi->attrmetadatalength, sizeof(sai_attribute_t));
+
+    if (perf_acl_attr == NULL)
+    {
+        fprintf(stderr, "failed to create acl entry attributes\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (idx = 0; idx < oi->attrmetadatalength; idx++)
+    {
+        const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+        if (SAI_HAS_FLAG_READ_ONLY(md->flags))
+        {
+            continue;
+        }
+
+        perf_acl_attr[perf_acl_attr_count++].id = md->attrid;
+    }
+}
+
+static sai_status_t perf_loop_validate_create(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    const sai_object_type_info_t *oi = sai_metadata_get_object_type_info(object_type);
+    uint32_t i;
+    size_t idx;
+
+    for (i = 0; i < attr_count; i++)
+    {
+        const sai_attr_metadata_t *md = sai_metadata_get_attr_metadata(object_type, attr_list[i].id);
+
+        if (md == NULL)
+        {
+            return SAI_STATUS_UNKNOWN_ATTRIBUTE_0 + (sai_status_t)i;
+        }
+
+        if (SAI_HAS_FLAG_READ_ONLY(md->flags) || sai_metadata_get_attr_by_id(md->attrid, i, attr_list) != NULL)
+        {
+            return SAI_STATUS_INVALID_ATTRIBUTE_0 + (sai_status_t)i;
+        }
+    }
+
+    for (idx = 0; idx < oi->attrmetadatalength; idx++)
+    {
+        const sai_attr_metadata_t *md = oi->attrmetadata[idx];
+
+        if (!SAI_HAS_FLAG_MANDATORY_ON_CREATE(md->flags) ||
+                sai_metadata_get_attr_by_id(md->attrid, attr_count, attr_list) != NULL)
+        {
+            continue;
+        }
+
+        if (md->isconditional && !sai_metadata_is_condition_met(md, attr_count, attr_list))
+        {
+            continue;
+        }
+
+        return SAI_STATUS_MANDATORY_ATTRIBUTE_MISSING;
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void perf_loop_validate_create_route_entry(
+        _In_ uint32_t idx)
+{
+    uint32_t i = idx % PERF_BULK_COUNT;
+
+    perf_sink = perf_loop_validate_create(SAI_OBJECT_TYPE_ROUTE_ENTRY, perf_bulk_attr_count[i], perf_bulk_attr_list[i]);
+}
+
+static void perf_validate_create_route_entry(
+        _In_ uint32_t idx)
+{
+    sai_attr_id_t err;
+    uint32_t i = idx % PERF_BULK_COUNT;
+
+    perf_sink = sai_metadata_validate_create(SAI_OBJECT_TYPE_ROUTE_ENTRY, perf_bulk_attr_count[i], perf_bulk_attr_list[i], &err);
+}
+
+static void perf_loop_validate_create_acl_entry(
+        _In_ uint32_t idx)
+{
+    perf_sink = perf_loop_validate_create(SAI_OBJECT_TYPE_ACL_ENTRY, perf_acl_attr_count, perf_acl_attr);
+}
+
+static void perf_validate_create_acl_entry(
+        _In_ uint32_t idx)
+{
+    sai_attr_id_t err;
+
+    perf_sink = sai_metadata_validate_create(SAI_OBJECT_TYPE_ACL_ENTRY, perf_acl_attr_count, perf_acl_attr, &err);
+}
+
+int main(
+        _In_ int argc,
+        _In_ char **argv)
+{
+    if (argc > 1)
+    {
+        perf_iterations = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    printf("iterations: %u\n", perf_iterations);
+
+    perf_run("printf uint64", perf_printf_uint64);
+    perf_run("sai_serialize_uint64", perf_serialize_uint64);
+
+    perf_run("printf int32", perf_printf_int32);
+    perf_run("sai_serialize_int32", perf_serialize_int32);
+
+    perf_run("printf object_id", perf_printf_object_id);
+    perf_run("sai_serialize_object_id", perf_serialize_object_id);
+
+    perf_run("printf mac", perf_printf_mac);
+    perf_run("sai_serialize_mac", perf_serialize_mac);
+
+    perf_run("inet_ntop ip4", perf_printf_ip4);
+    perf_run("sai_serialize_ip4", perf_serialize_ip4);
+
+    perf_run("inet_ntop ip6", perf_inet_ntop_ip6);
+    perf_run("sai_serialize_ip6", perf_serialize_ip6);
+
+    perf_text_create();
+
+    perf_run("sscanf mac", perf_sscanf_mac);
+    perf_run("sai_deserialize_mac", perf_deserialize_mac);
+
+    perf_run("inet_pton ip6", perf_inet_pton_ip6);
+    perf_run("sai_deserialize_ip6", perf_deserialize_ip6);
+
+    perf_run("sscanf encrypt_key", perf_sscanf_encrypt_key);
+    perf_run("sai_deserialize_encrypt_key", perf_deserialize_encrypt_key);
+
+    perf_run("sai_serialize_route_entry", perf_serialize_route_entry);
+
+    perf_enum_dump_create();
+
+    printf("enum dump values: %u\n", perf_enum_dump_count);
+
+    perf_run("linear serialize enum", perf_linear_serialize_enum);
+    perf_run("sai_serialize_enum", perf_serialize_enum);
+
+    perf_run("linear deserialize enum", perf_linear_deserialize_enum);
+    perf_run("sai_deserialize_enum", perf_deserialize_enum);
+
+    free(perf_enum_dump);
+
+    perf_attr_create();
+
+    sai_deserialize_arena_init(&perf_arena, 0);
+
+    perf_run("sai_deserialize_attribute", perf_deserialize_attribute);
+    perf_run("sai_deserialize_attribute_ex arena", perf_deserialize_attribute_arena);
+
+    /* each list allocated from arena is single calloc without arena */
+
+    printf("%-40s %10.3f allocs/op\n", "sai_deserialize_attribute",
+            (double)perf_arena.allocations / perf_iterations);
+    printf("%-40s %10.3f allocs/op\n", "sai_deserialize_attribute_ex arena",
+            (double)perf_arena.blockcount / perf_iterations);
+
+    perf_attr_dump_create();
+
+    printf("attribute dump: %u, attribute names: %u\n", perf_attr_dump_count,
+            (uint32_t)sai_metadata_attr_sorted_by_id_name_count);
+
+    perf_run("binary search attr id name", perf_binary_search_attr_id_name);
+    perf_run("sai_metadata_get_attr_metadata_by_attr_id_name_ext", perf_get_attr_metadata_by_attr_id_name);
+
+    perf_run("sai_deserialize_attribute_ex all attributes", perf_deserialize_attribute_dump);
+
+    free(perf_attr_dump);
+
+    perf_bulk_create();
+
+    printf("bulk create objects: %u, time per object\n", PERF_BULK_COUNT);
+
+    perf_run("loop serialize bulk create", perf_loop_serialize_bulk_create);
+    perf_run("sai_serialize_bulk_create", perf_serialize_bulk_create);
+
+    perf_run("loop deserialize bulk create", perf_loop_deserialize_bulk_create);
+    perf_run("sai_deserialize_bulk_create", perf_deserialize_bulk_create);
+
+    free(perf_bulk_buf);
+
+    perf_run("loop validate create route entry", perf_loop_validate_create_route_entry);
+    perf_run("sai_metadata_validate_create route entry", perf_validate_create_route_entry);
+
+    perf_acl_create();
+
+    uint32_t iterations = perf_iterations;
+
+    perf_iterations = iterations / PERF_VALIDATE_ACL_DIVISOR + 1;
+
+    printf("acl entry attributes: %u, iterations: %u\n", perf_acl_attr_count, perf_iterations);
+
+    perf_run("loop validate create acl entry", perf_loop_validate_create_acl_entry);
+    perf_run("sai_metadata_validate_create acl entry", perf_validate_create_acl_entry);
+
+    perf_iterations = iterations;
+
+    free(perf_acl_attr);
+
+    sai_deserialize_arena_free(&perf_arena);
+
+    return 0;
+}
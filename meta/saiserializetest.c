@@ -189,6 +189,51 @@ void subtest_serialize_object_id(
     ASSERT_STR_EQ(buf, exp, res);
 }
 
+void test_serialize_integers()
+{
+    char buf[PRIMITIVE_BUFFER_SIZE];
+    int res;
+
+    res = sai_serialize_uint8(buf, 0);
+    ASSERT_STR_EQ(buf, "0", res);
+
+    res = sai_serialize_uint8(buf, 255);
+    ASSERT_STR_EQ(buf, "255", res);
+
+    res = sai_serialize_int8(buf, -128);
+    ASSERT_STR_EQ(buf, "-128", res);
+
+    res = sai_serialize_uint16(buf, 65535);
+    ASSERT_STR_EQ(buf, "65535", res);
+
+    res = sai_serialize_int16(buf, -32768);
+    ASSERT_STR_EQ(buf, "-32768", res);
+
+    res = sai_serialize_uint32(buf, 4294967295U);
+    ASSERT_STR_EQ(buf, "4294967295", res);
+
+    res = sai_serialize_int32(buf, -2147483647 - 1);
+    ASSERT_STR_EQ(buf, "-2147483648", res);
+
+    res = sai_serialize_int32(buf, 10);
+    ASSERT_STR_EQ(buf, "10", res);
+
+    res = sai_serialize_uint64(buf, UINT64_C(18446744073709551615));
+    ASSERT_STR_EQ(buf, "18446744073709551615", res);
+
+    res = sai_serialize_uint64(buf, UINT64_C(10000000000000000000));
+    ASSERT_STR_EQ(buf, "10000000000000000000", res);
+
+    res = sai_serialize_int64(buf, INT64_C(-9223372036854775807) - 1);
+    ASSERT_STR_EQ(buf, "-9223372036854775808", res);
+
+    res = sai_serialize_int64(buf, INT64_C(9223372036854775807));
+    ASSERT_STR_EQ(buf, "9223372036854775807", res);
+
+    res = sai_serialize_size(buf, 99);
+    ASSERT_STR_EQ(buf, "99", res);
+}
+
 void test_serialize_object_id()
 {
     subtest_serialize_object_id(0, "oid:0x0");
@@ -303,6 +348,19 @@ void test_deserialize_mac()
 
     res = sai_deserialize_mac("111:2::33:44:55:66", mac);
     ASSERT_TRUE(res < 0, "expected negative");
+
+    res = sai_deserialize_mac("ab:cd:ef:0a:bc:de", mac);
+    ASSERT_TRUE(res == 17, "expected 17 length");
+    ASSERT_TRUE(memcmp(mac, "\xab\xcd\xef\x0a\xbc\xde", 6) == 0, "expected equal");
+
+    res = sai_deserialize_mac("11:22:33:44:55", mac);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    res = sai_deserialize_mac("11-22-33-44-55-66", mac);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    res = sai_deserialize_mac("11:22:33:44:55:6\xe6", mac);
+    ASSERT_TRUE(res < 0, "expected negative");
 }
 
 void test_serialize_encrypt_key()
@@ -533,6 +591,15 @@ void test_serialize_enum()
             res = sai_serialize_enum(buf, emd, value);
 
             ASSERT_STR_EQ(buf, emd->valuesnames[j], res);
+
+            ASSERT_TRUE(sai_metadata_get_enum_value_short_name(emd, value) == emd->valuesshortnames[j], "expected true");
+
+            /* value between sparse enum values must not be found */
+
+            if (j > 0 && emd->values[j - 1] + 1 < value)
+            {
+                ASSERT_TRUE(sai_metadata_get_enum_value_name(emd, value - 1) == NULL, "expected NULL");
+            }
         }
     }
 }
@@ -554,6 +621,19 @@ void test_deserialize_enum()
     res = sai_deserialize_enum("SAI_OBJECT_TYPE_PORTS", &sai_metadata_enum_sai_object_type_t, &value);
     ASSERT_TRUE(res < 0, "expected negative number");
 
+    /* name which is prefix of other names */
+
+    res = sai_deserialize_enum("SAI_OBJECT_TYPE_PORT,", &sai_metadata_enum_sai_object_type_t, &value);
+    ASSERT_TRUE(res == strlen("SAI_OBJECT_TYPE_PORT"), "expected true");
+    ASSERT_TRUE(value == SAI_OBJECT_TYPE_PORT, "expected true");
+
+    res = sai_deserialize_enum("SAI_OBJECT_TYPE_PORT_POOL]", &sai_metadata_enum_sai_object_type_t, &value);
+    ASSERT_TRUE(res == strlen("SAI_OBJECT_TYPE_PORT_POOL"), "expected true");
+    ASSERT_TRUE(value == SAI_OBJECT_TYPE_PORT_POOL, "expected true");
+
+    res = sai_deserialize_enum("SAI_OBJECT_TYPE_POR", &sai_metadata_enum_sai_object_type_t, &value);
+    ASSERT_TRUE(res < 0, "expected negative number");
+
     res = sai_deserialize_enum("-1", &sai_metadata_enum_sai_object_type_t, &value);
     ASSERT_TRUE(res == strlen("-1"), "expected true");
     ASSERT_TRUE(value == -1, "expected true, value = %d", value);
@@ -578,6 +658,15 @@ void test_deserialize_enum()
 
             ASSERT_TRUE(res == (int)strlen(emd->valuesnames[j]), "expected true");
             ASSERT_TRUE(value == emd->values[j], "expected true");
+
+            char buf[PRIMITIVE_BUFFER_SIZE];
+
+            sprintf(buf, "%s\"", emd->valuesnames[j]);
+
+            res = sai_deserialize_enum(buf, emd, &value);
+
+            ASSERT_TRUE(res == (int)strlen(emd->valuesnames[j]), "expected true");
+            ASSERT_TRUE(value == emd->values[j], "expected true");
         }
     }
 }
@@ -645,6 +734,22 @@ void test_serialize_ip6()
 
     res = sai_serialize_ip6(buf, ip);
     ASSERT_STR_EQ(buf, "::1", res);
+
+    memset(ip, 0, 16);
+    res = sai_serialize_ip6(buf, ip);
+    ASSERT_STR_EQ(buf, "::", res);
+
+    memcpy(ip, "\0\0\0\0\0\0\0\0\0\0\xff\xff\x01\x02\x03\x04", 16);
+    res = sai_serialize_ip6(buf, ip);
+    ASSERT_STR_EQ(buf, "::ffff:1.2.3.4", res);
+
+    memcpy(ip, "\0\x01\0\0\0\0\0\x02\0\0\0\0\0\0\0\x03", 16);
+    res = sai_serialize_ip6(buf, ip);
+    ASSERT_STR_EQ(buf, "1:0:0:2::3", res);
+
+    memcpy(ip, "\0\x01\0\x02\0\x03\0\x04\0\x05\0\x06\0\x07\0\0", 16);
+    res = sai_serialize_ip6(buf, ip);
+    ASSERT_STR_EQ(buf, "1:2:3:4:5:6:7:0", res);
 }
 
 void test_deserialize_ip6()
@@ -694,6 +799,41 @@ void test_deserialize_ip6()
     buf = "1::456::3";
     res = sai_deserialize_ip6(buf, ip);
     ASSERT_TRUE(res < 0, "expected negative number");
+
+    buf = "::";
+    res = sai_deserialize_ip6(buf, ip);
+    ASSERT_TRUE(memcmp(ip, "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0", 16) == 0, "expected true");
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+
+    buf = "::ffff:1.2.3.4";
+    res = sai_deserialize_ip6(buf, ip);
+    ASSERT_TRUE(memcmp(ip, "\0\0\0\0\0\0\0\0\0\0\xff\xff\x01\x02\x03\x04", 16) == 0, "expected true");
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+
+    buf = "1:2:3:4:5:6:7::";
+    res = sai_deserialize_ip6(buf, ip);
+    ASSERT_TRUE(memcmp(ip, "\0\x01\0\x02\0\x03\0\x04\0\x05\0\x06\0\x07\0\0", 16) == 0, "expected true");
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+
+    buf = "1:2:3:4:5:6:7:8:9";
+    res = sai_deserialize_ip6(buf, ip);
+    ASSERT_TRUE(res < 0, "expected negative number");
+
+    buf = "1:2:3:4::5:6:7:8";
+    res = sai_deserialize_ip6(buf, ip);
+    ASSERT_TRUE(res < 0, "expected negative number");
+
+    buf = "12345::";
+    res = sai_deserialize_ip6(buf, ip);
+    ASSERT_TRUE(res < 0, "expected negative number");
+
+    buf = "::ffff:01.2.3.4";
+    res = sai_deserialize_ip6(buf, ip);
+    ASSERT_TRUE(res < 0, "expected negative number");
+
+    buf = "1:";
+    res = sai_deserialize_ip6(buf, ip);
+    ASSERT_TRUE(res < 0, "expected negative number");
 }
 
 void subtest_serialize_ip_addres_v4(
@@ -1723,6 +1863,824 @@ void test_deserialize_attribute()
     ASSERT_TRUE(res < 0, "expected negative");
 }
 
+void test_deserialize_attribute_arena()
+{
+    int res;
+    const char *buf;
+    sai_attribute_t attribute;
+    sai_deserialize_arena_t arena;
+
+    sai_deserialize_arena_init(&arena, 0);
+
+    buf = "{\"id\":\"SAI_PORT_ATTR_HW_LANE_LIST\",\"value\":{\"u32list\":{\"count\":2,\"list\":[1,2]}}}";
+    res = sai_deserialize_attribute_ex(buf, &attribute, &arena);
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+    ASSERT_TRUE(attribute.value.u32list.count == 2, "expected true");
+    ASSERT_TRUE(attribute.value.u32list.list[1] == 2, "expected true");
+
+    buf = "{\"id\":\"SAI_PORT_ATTR_INGRESS_MIRROR_SESSION\",\"value\":{\"objlist\":{\"count\":2,\"list\":[\"oid:0x1\",\"oid:0x2\"]}}}";
+    res = sai_deserialize_attribute_ex(buf, &attribute, &arena);
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+    ASSERT_TRUE(attribute.value.objlist.list[0] == 1, "expected true");
+
+    ASSERT_TRUE(arena.allocations == 2, "expected 2 allocations, got %u", (uint32_t)arena.allocations);
+    ASSERT_TRUE(arena.blockcount == 1, "expected 1 block, got %u", (uint32_t)arena.blockcount);
+
+    /* list larger than block gets dedicated block */
+
+    ASSERT_TRUE(sai_deserialize_arena_alloc(&arena, 1024, sizeof(uint64_t)) != NULL, "expected true");
+    ASSERT_TRUE(arena.blockcount == 2, "expected 2 blocks, got %u", (uint32_t)arena.blockcount);
+
+    sai_deserialize_arena_reset(&arena);
+    ASSERT_TRUE(arena.used == 0, "expected true");
+
+    /* failure after list allocation, memory is released by calloc path */
+
+    buf = "{\"id\":\"SAI_PORT_ATTR_INGRESS_MIRROR_SESSION\",\"value\":{\"objlist\":{\"count\":2,\"list\":[\"oid:0x1\",\"foo\"]}}}";
+    res = sai_deserialize_attribute(buf, &attribute);
+    ASSERT_TRUE(res < 0, "expected negative");
+    ASSERT_TRUE(attribute.value.objlist.list == NULL, "expected list to be released");
+
+    res = sai_deserialize_attribute_ex(buf, &attribute, &arena);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    sai_deserialize_arena_free(&arena);
+    ASSERT_TRUE(arena.blocks == NULL, "expected true");
+}
+
+void test_deserialize_view()
+{
+    int res;
+    const char *buf;
+    char chardata[SAI_CHARDATA_LENGTH];
+    uint8_t items[4];
+    sai_macsec_salt_t salt;
+    sai_u8_list_t list;
+    sai_deserialize_view_t view;
+    sai_deserialize_attribute_view_t attr_view;
+    sai_attribute_t attribute;
+
+    buf = "{\"count\":3,\"list\":[1,22,255]}";
+    res = sai_deserialize_u8_list_view(buf, &view);
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+    ASSERT_TRUE(view.count == 3, "expected true");
+    ASSERT_TRUE(view.data == buf + 19 && view.length == 8, "expected view inside buffer");
+
+    list.count = 2;
+    list.list = items;
+    res = sai_deserialize_view_u8_list(&view, &list);
+    ASSERT_TRUE(res < 0, "expected negative");
+    ASSERT_TRUE(list.count == 3, "expected required count");
+
+    res = sai_deserialize_view_u8_list(&view, &list);
+    ASSERT_TRUE(res == 3, "expected true");
+    ASSERT_TRUE(items[0] == 1 && items[1] == 22 && items[2] == 255, "expected true");
+
+    res = sai_deserialize_u8_list_view("{\"count\":3,\"list\":[1,256,3]}", &view);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    res = sai_deserialize_u8_list_view("{\"count\":3,\"list\":[1,2]}", &view);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    res = sai_deserialize_uint8_array_view("null", 7, &view);
+    ASSERT_TRUE(res == 4 && view.data == NULL && view.count == 7, "expected true");
+
+    res = sai_deserialize_chardata_view("eth0\"", &view);
+    ASSERT_TRUE(res == 4, "expected true");
+    res = sai_deserialize_view_chardata(&view, chardata);
+    ASSERT_TRUE(res == 4 && strcmp(chardata, "eth0") == 0, "expected true");
+
+    buf = "00:11:22:33:44:55:66:77:88:99:AA:bb";
+    res = sai_deserialize_macsec_salt_view(buf, &view);
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+    res = sai_deserialize_view_bytes(&view, salt, sizeof(salt));
+    ASSERT_TRUE(res == (int)sizeof(salt) && salt[10] == 0xAA && salt[11] == 0xBB, "expected true");
+
+    res = sai_deserialize_macsec_salt_view("00:11:22:33:44:55:66:77:88:99:AA", &view);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    res = sai_deserialize_macsec_salt_view("00:11:22:33:44:55:66:77:88:99:AA:BG", &view);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    buf = "{\"id\":\"SAI_SWITCH_ATTR_SLAVE_MDIO_ADDR_LIST\",\"value\":{\"u8list\":{\"count\":2,\"list\":[5,6]}}}";
+    res = sai_deserialize_attribute_view(buf, &attr_view);
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+    ASSERT_TRUE(attr_view.meta->attrid == SAI_SWITCH_ATTR_SLAVE_MDIO_ADDR_LIST, "expected true");
+    ASSERT_TRUE(attr_view.data.count == 2 && strncmp(attr_view.data.data, "5,6", 3) == 0, "expected true");
+
+    res = sai_deserialize_view_attribute(&attr_view, &attribute, NULL);
+    ASSERT_TRUE(res == (int)attr_view.value.length, "expected true");
+    ASSERT_TRUE(attribute.value.u8list.list[1] == 6, "expected true");
+    sai_deserialize_free_attribute(attr_view.meta, &attribute);
+
+    /* value of other types is only validated for structure */
+
+    buf = "{\"id\":\"SAI_PORT_ATTR_MTU\",\"value\":{\"u32\":9100}}";
+    res = sai_deserialize_attribute_view(buf, &attr_view);
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+    ASSERT_TRUE(attr_view.data.data == NULL, "expected true");
+
+    res = sai_deserialize_view_attribute(&attr_view, &attribute, NULL);
+    ASSERT_TRUE(res > 0 && attribute.value.u32 == 9100, "expected true");
+
+    res = sai_deserialize_attribute_view("{\"id\":\"SAI_PORT_ATTR_MTU\",\"value\":{\"u32\":[9100}}", &attr_view);
+    ASSERT_TRUE(res < 0, "expected negative");
+}
+
+int test_stream_callback(
+        _In_ const sai_deserialize_stream_t *stream,
+        _In_ const sai_attribute_t *attr)
+{
+    uint32_t *sum = (uint32_t*)stream->context;
+
+    if (attr->id == SAI_PORT_ATTR_HW_LANE_LIST)
+    {
+        *sum += attr->value.u32list.list[attr->value.u32list.count - 1];
+    }
+    else
+    {
+        *sum += attr->value.u32;
+    }
+
+    return (*sum > 100000) ? -1 : 0;
+}
+
+void test_deserialize_stream()
+{
+    int res;
+    const char *buf;
+    size_t len;
+    size_t chunk;
+    size_t pos;
+    uint32_t sum;
+    uint32_t count;
+    sai_deserialize_stream_t stream;
+
+    buf = "[{\"id\":\"SAI_PORT_ATTR_HW_LANE_LIST\",\"value\":{\"u32list\":{\"count\":2,\"list\":[1,20]}}},\n"
+        "{\"id\":\"SAI_PORT_ATTR_MTU\",\"value\":{\"u32\":9100}}, "
+        "{\"id\":\"SAI_PORT_ATTR_HW_LANE_LIST\",\"value\":{\"u32list\":{\"count\":1,\"list\":[300]}}}]\n";
+
+    len = strlen(buf);
+
+    /* attributes can be split at any position */
+
+    for (chunk = 1; chunk <= len; chunk++)
+    {
+        sai_deserialize_stream_init(&stream, 0);
+
+        sum = 0;
+        count = 0;
+
+        for (pos = 0; pos < len; pos += chunk)
+        {
+            res = sai_deserialize_stream_push(&stream, buf + pos, (len - pos < chunk) ? len - pos : chunk,
+                    test_stream_callback, &sum);
+
+            ASSERT_TRUE(res >= 0, "expected true, chunk %u", (uint32_t)chunk);
+
+            count += (uint32_t)res;
+        }
+
+        ASSERT_TRUE(sai_deserialize_stream_finish(&stream) == 0, "expected true");
+        ASSERT_TRUE(count == 3 && stream.count == 3, "expected 3 attributes, got %u", count);
+        ASSERT_TRUE(sum == 20 + 9100 + 300, "expected true, sum %u", sum);
+
+        sai_deserialize_stream_free(&stream);
+    }
+
+    /* list longer than buffer is passed in batches, each ending with its own item */
+
+    sai_deserialize_stream_init(&stream, 80);
+
+    sum = 0;
+    res = sai_deserialize_stream_push(&stream, buf, 64, test_stream_callback, &sum);
+    ASSERT_TRUE(res == 0, "expected true");
+
+    res = sai_deserialize_stream_push(&stream, buf + 64, len - 64, test_stream_callback, &sum);
+    ASSERT_TRUE(res == 3, "expected true, res %d", res);
+    ASSERT_TRUE(sum == 1 + 20 + 9100 + 300, "expected true, sum %u", sum);
+
+    sai_deserialize_stream_free(&stream);
+
+    /* incomplete attribute */
+
+    sai_deserialize_stream_init(&stream, 0);
+
+    res = sai_deserialize_stream_push(&stream, buf, 20, test_stream_callback, &sum);
+    ASSERT_TRUE(res == 0, "expected true");
+    ASSERT_TRUE(sai_deserialize_stream_finish(&stream) < 0, "expected negative");
+
+    sai_deserialize_stream_free(&stream);
+
+    /* invalid characters and mismatched brackets */
+
+    sai_deserialize_stream_init(&stream, 0);
+    res = sai_deserialize_stream_push(&stream, "[ x", 3, test_stream_callback, &sum);
+    ASSERT_TRUE(res < 0, "expected negative");
+    sai_deserialize_stream_free(&stream);
+
+    sai_deserialize_stream_init(&stream, 0);
+    res = sai_deserialize_stream_push(&stream, "{\"id\":[}", 9, test_stream_callback, &sum);
+    ASSERT_TRUE(res < 0, "expected negative");
+    sai_deserialize_stream_free(&stream);
+
+    sai_deserialize_stream_init(&stream, 0);
+    sum = 0;
+    res = sai_deserialize_stream_push(&stream, "]]]{\"id\":\"SAI_PORT_ATTR_MTU\",\"value\":{\"u32\":9100}}", 50,
+            test_stream_callback, &sum);
+    ASSERT_TRUE(res < 0 && sum == 0, "expected negative");
+    sai_deserialize_stream_free(&stream);
+
+    sai_deserialize_stream_init(&stream, 0);
+    res = sai_deserialize_stream_push(&stream, "[[[{\"id\":\"SAI_PORT_ATTR_MTU\",\"value\":{\"u32\":9100}}", 50,
+            test_stream_callback, &sum);
+    ASSERT_TRUE(res < 0 && sum == 0, "expected negative");
+    sai_deserialize_stream_free(&stream);
+
+    /* top level array must be closed */
+
+    sai_deserialize_stream_init(&stream, 0);
+    res = sai_deserialize_stream_push(&stream, "[{\"id\":\"SAI_PORT_ATTR_MTU\",\"value\":{\"u32\":9100}}", 48,
+            test_stream_callback, &sum);
+    ASSERT_TRUE(res == 1 && sum == 9100, "expected true");
+    ASSERT_TRUE(sai_deserialize_stream_finish(&stream) < 0, "expected negative");
+    res = sai_deserialize_stream_push(&stream, "]\n", 2, test_stream_callback, &sum);
+    ASSERT_TRUE(res == 0, "expected true");
+    ASSERT_TRUE(sai_deserialize_stream_finish(&stream) == 0, "expected true");
+    sai_deserialize_stream_free(&stream);
+
+    /* callback can stop deserialize */
+
+    sai_deserialize_stream_init(&stream, 0);
+    sum = 100000;
+    res = sai_deserialize_stream_push(&stream, buf, len, test_stream_callback, &sum);
+    ASSERT_TRUE(res < 0 && stream.count == 1, "expected negative");
+    sai_deserialize_stream_free(&stream);
+}
+
+void test_deserialize_stream_max_length()
+{
+    int res;
+    const char *attr;
+    size_t len;
+    size_t pos;
+    uint32_t sum;
+    sai_deserialize_stream_t stream;
+
+    attr = "{\"id\":\"SAI_PORT_ATTR_MTU\",\"value\":{\"u32\":9100}}";
+
+    len = strlen(attr);
+
+    /* attribute of exactly max length is accepted, and buffer is reused by next one */
+
+    sai_deserialize_stream_init(&stream, len);
+
+    sum = 0;
+
+    for (pos = 0; pos < 3; pos++)
+    {
+        res = sai_deserialize_stream_push(&stream, attr, len, test_stream_callback, &sum);
+        ASSERT_TRUE(res == 1, "expected true, res %d", res);
+    }
+
+    ASSERT_TRUE(sum == 3 * 9100 && stream.length == 0, "expected true, sum %u", sum);
+    ASSERT_TRUE(sai_deserialize_stream_finish(&stream) == 0, "expected true");
+
+    sai_deserialize_stream_free(&stream);
+
+    /* one character over max length fails, also when split in chunks */
+
+    sai_deserialize_stream_init(&stream, len - 1);
+
+    res = sai_deserialize_stream_push(&stream, attr, len, test_stream_callback, &sum);
+    ASSERT_TRUE(res < 0 && stream.count == 0, "expected negative");
+
+    sai_deserialize_stream_free(&stream);
+
+    sai_deserialize_stream_init(&stream, len - 1);
+
+    for (pos = 0; pos < len - 1; pos++)
+    {
+        res = sai_deserialize_stream_push(&stream, attr + pos, 1, test_stream_callback, &sum);
+        ASSERT_TRUE(res == 0, "expected true at %u", (uint32_t)pos);
+    }
+
+    res = sai_deserialize_stream_push(&stream, attr + pos, 1, test_stream_callback, &sum);
+    ASSERT_TRUE(res < 0 && stream.count == 0, "expected negative");
+
+    sai_deserialize_stream_free(&stream);
+
+    /* list is split only after complete item, so list head must fit */
+
+    sai_deserialize_stream_init(&stream, 64);
+
+    attr = "{\"id\":\"SAI_PORT_ATTR_HW_LANE_LIST\",\"value\":{\"u32list\":{\"count\":16,\"list\":[";
+
+    res = sai_deserialize_stream_push(&stream, attr, strlen(attr), test_stream_callback, &sum);
+    ASSERT_TRUE(res < 0 && stream.depth != 0, "expected negative");
+    ASSERT_TRUE(stream.length <= 64, "buffered %u characters", (uint32_t)stream.length);
+
+    sai_deserialize_stream_free(&stream);
+}
+
+typedef struct _test_stream_list_t
+{
+    uint32_t next;
+    uint32_t batches;
+    uint32_t attrs;
+
+} test_stream_list_t;
+
+int test_stream_list_callback(
+        _In_ const sai_deserialize_stream_t *stream,
+        _In_ const sai_attribute_t *attr)
+{
+    test_stream_list_t *ctx = (test_stream_list_t*)stream->context;
+    uint32_t list_index = stream->listindex;
+    uint32_t idx;
+
+    if (attr->id == SAI_PORT_ATTR_MTU)
+    {
+        ASSERT_TRUE(list_index == 0 && !stream->listmore, "expected not split");
+
+        ctx->attrs++;
+
+        return 0;
+    }
+
+    ASSERT_TRUE(list_index == ctx->next, "expected index %u, got %u", ctx->next, list_index);
+    ASSERT_TRUE(attr->value.u32list.count != 0, "expected items");
+
+    for (idx = 0; idx < attr->value.u32list.count; idx++)
+    {
+        ASSERT_TRUE(attr->value.u32list.list[idx] == 3 * (list_index + idx), "wrong item %u", list_index + idx);
+    }
+
+    ctx->next += attr->value.u32list.count;
+    ctx->batches++;
+
+    if (!stream->listmore)
+    {
+        ctx->attrs++;
+        ctx->next = 0;
+    }
+
+    return 0;
+}
+
+static char* test_stream_list(
+        _In_ uint32_t count,
+        _In_ uint32_t items)
+{
+    char *buf = (char*)malloc(64 + 16 * (size_t)items + 128);
+    char *ptr = buf;
+    uint32_t idx;
+
+    ptr += sprintf(ptr, "[{\"id\":\"SAI_PORT_ATTR_HW_LANE_LIST\",\"value\":{\"u32list\":{\"count\":%u,\"list\":[", count);
+
+    for (idx = 0; idx < items; idx++)
+    {
+        ptr += sprintf(ptr, (idx == 0) ? "%u" : ",%u", 3 * idx);
+    }
+
+    sprintf(ptr, "]}}},\n{\"id\":\"SAI_PORT_ATTR_MTU\",\"value\":{\"u32\":9100}}]\n");
+
+    return buf;
+}
+
+void test_deserialize_stream_split_list()
+{
+    int res;
+    char *buf;
+    char *bad;
+    char *end;
+    size_t len;
+    size_t pos;
+    size_t idx;
+    size_t chunk;
+    uint32_t count;
+    test_stream_list_t ctx;
+    sai_deserialize_stream_t stream;
+
+    const size_t chunks[] = { 1, 7, 100, 4096, 0 };
+
+    buf = test_stream_list(20000, 20000);
+
+    len = strlen(buf);
+
+    for (pos = 0; pos < sizeof(chunks)/sizeof(chunks[0]); pos++)
+    {
+        chunk = (chunks[pos] == 0) ? len : chunks[pos];
+
+        sai_deserialize_stream_init(&stream, 256);
+
+        memset(&ctx, 0, sizeof(ctx));
+
+        for (idx = 0, count = 0; idx < len; idx += chunk)
+        {
+            res = sai_deserialize_stream_push(&stream, buf + idx, (len - idx < chunk) ? len - idx : chunk,
+                    test_stream_list_callback, &ctx);
+
+            ASSERT_TRUE(res >= 0, "expected true, chunk %u", (uint32_t)chunk);
+
+            count += (uint32_t)res;
+        }
+
+        ASSERT_TRUE(sai_deserialize_stream_finish(&stream) == 0, "expected true");
+        ASSERT_TRUE(count == 2 && ctx.attrs == 2, "expected 2 attributes, got %u", count);
+        ASSERT_TRUE(ctx.batches > len / 256, "expected many batches, got %u", ctx.batches);
+
+        /* whole input is more than 100 KB, buffer never grows over initial size */
+
+        ASSERT_TRUE(stream.capacity <= 4096, "buffer grown to %u", (uint32_t)stream.capacity);
+
+        sai_deserialize_stream_free(&stream);
+    }
+
+    free(buf);
+
+    /* list count must match number of items also when list is split */
+
+    buf = test_stream_list(20001, 20000);
+
+    memset(&ctx, 0, sizeof(ctx));
+    sai_deserialize_stream_init(&stream, 256);
+    res = sai_deserialize_stream_push(&stream, buf, strlen(buf), test_stream_list_callback, &ctx);
+    ASSERT_TRUE(res < 0, "expected negative");
+    sai_deserialize_stream_free(&stream);
+
+    free(buf);
+
+    buf = test_stream_list(19999, 20000);
+
+    memset(&ctx, 0, sizeof(ctx));
+    sai_deserialize_stream_init(&stream, 256);
+    res = sai_deserialize_stream_push(&stream, buf, strlen(buf), test_stream_list_callback, &ctx);
+    ASSERT_TRUE(res < 0, "expected negative");
+    sai_deserialize_stream_free(&stream);
+
+    free(buf);
+
+    /* split list must be followed only by end of objects */
+
+    buf = test_stream_list(200, 200);
+
+    end = strstr(buf, "]}}}");
+    bad = (char*)malloc(strlen(buf) + 16);
+
+    sprintf(bad, "%.*s],\"x\":1}}}%s", (int)(end - buf), buf, end + 4);
+
+    memset(&ctx, 0, sizeof(ctx));
+    sai_deserialize_stream_init(&stream, 256);
+    res = sai_deserialize_stream_push(&stream, bad, strlen(bad), test_stream_list_callback, &ctx);
+    ASSERT_TRUE(res < 0 && ctx.batches != 0, "expected negative");
+    sai_deserialize_stream_free(&stream);
+
+    free(bad);
+    free(buf);
+}
+
+void test_serialize_bulk_create()
+{
+    int res;
+    char buf[LONG_BUFFER_SIZE];
+    char small[10];
+    uint32_t lanes[2][2] = { { 1, 2 }, { 3, 4 } };
+    sai_attribute_t attrs[2][2];
+    const sai_attribute_t *attr_list[2] = { attrs[0], attrs[1] };
+    uint32_t attr_count[2] = { 2, 1 };
+    sai_object_key_entry_t keys[2];
+    sai_status_t statuses[2] = { SAI_STATUS_SUCCESS, SAI_STATUS_FAILURE };
+    sai_deserialize_arena_t arena;
+
+    sai_object_type_t object_type;
+    uint32_t object_count;
+    sai_object_key_entry_t *out_keys;
+    uint32_t *out_attr_count;
+    sai_attribute_t **out_attr_list;
+    sai_bulk_op_error_mode_t mode;
+    sai_status_t *out_statuses;
+
+    uint32_t idx;
+
+    for (idx = 0; idx < 2; idx++)
+    {
+        keys[idx].object_id = idx + 1;
+
+        attrs[idx][0].id = SAI_PORT_ATTR_HW_LANE_LIST;
+        attrs[idx][0].value.u32list.count = 2;
+        attrs[idx][0].value.u32list.list = lanes[idx];
+
+        attrs[idx][1].id = SAI_PORT_ATTR_MTU;
+        attrs[idx][1].value.u32 = 9100;
+    }
+
+    res = sai_serialize_bulk_create(buf, sizeof(buf), SAI_OBJECT_TYPE_PORT, 2, keys,
+            attr_count, attr_list, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses);
+
+    ASSERT_STR_EQ(buf,
+            "{\"object_type\":\"SAI_OBJECT_TYPE_PORT\",\"mode\":\"SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR\",\"object_count\":2,\"objects\":["
+            "{\"key\":{\"object_id\":\"oid:0x1\"},\"status\":\"SAI_STATUS_SUCCESS\",\"attributes\":["
+            "{\"id\":\"SAI_PORT_ATTR_HW_LANE_LIST\",\"value\":{\"u32list\":{\"count\":2,\"list\":[1,2]}}},"
+            "{\"id\":\"SAI_PORT_ATTR_MTU\",\"value\":{\"u32\":9100}}]},"
+            "{\"key\":{\"object_id\":\"oid:0x2\"},\"status\":\"SAI_STATUS_FAILURE\",\"attributes\":["
+            "{\"id\":\"SAI_PORT_ATTR_HW_LANE_LIST\",\"value\":{\"u32list\":{\"count\":2,\"list\":[3,4]}}}]}]}", res);
+
+    ASSERT_TRUE(sai_serialize_bulk_create(small, sizeof(small), SAI_OBJECT_TYPE_PORT, 2, keys,
+                attr_count, attr_list, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses) == res, "expected same length");
+
+    sai_deserialize_arena_init(&arena, 0);
+
+    res = sai_deserialize_bulk_create(buf, &object_type, &object_count, &out_keys,
+            &out_attr_count, &out_attr_list, &mode, &out_statuses, &arena);
+
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+    ASSERT_TRUE(object_type == SAI_OBJECT_TYPE_PORT && object_count == 2, "expected true");
+    ASSERT_TRUE(mode == SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, "expected true");
+    ASSERT_TRUE(out_keys[1].object_id == 2, "expected true");
+    ASSERT_TRUE(out_statuses[1] == SAI_STATUS_FAILURE, "expected true");
+    ASSERT_TRUE(out_attr_count[0] == 2 && out_attr_count[1] == 1, "expected true");
+    ASSERT_TRUE(out_attr_list[0][1].id == SAI_PORT_ATTR_MTU && out_attr_list[0][1].value.u32 == 9100, "expected true");
+    ASSERT_TRUE(out_attr_list[1][0].value.u32list.list[1] == 4, "expected true");
+
+    /* keys and statuses are optional, attribute list grows for second object */
+
+    attr_count[0] = 1;
+    attr_count[1] = 2;
+
+    res = sai_serialize_bulk_create(buf, sizeof(buf), SAI_OBJECT_TYPE_PORT, 2, NULL,
+            attr_count, attr_list, SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, NULL);
+    ASSERT_TRUE(res > 0, "expected true");
+
+    res = sai_deserialize_bulk_create(buf, &object_type, &object_count, &out_keys,
+            &out_attr_count, &out_attr_list, &mode, &out_statuses, &arena);
+
+    ASSERT_TRUE(res == (int)strlen(buf), "expected true");
+    ASSERT_TRUE(out_keys[1].object_id == 0, "expected true");
+    ASSERT_TRUE(out_statuses[0] == SAI_STATUS_NOT_EXECUTED, "expected true");
+    ASSERT_TRUE(out_attr_count[1] == 2 && out_attr_list[1][1].value.u32 == 9100, "expected true");
+    ASSERT_TRUE(out_attr_list[1][0].value.u32list.list[0] == 3, "expected true");
+
+    /* attribute of other object type */
+
+    buf[0] = 0;
+    strcat(buf, "{\"object_type\":\"SAI_OBJECT_TYPE_PORT\",\"mode\":\"SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR\",\"object_count\":1,\"objects\":[");
+    strcat(buf, "{\"attributes\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_TYPE\",\"value\":{\"s32\":0}}]}]}");
+
+    res = sai_deserialize_bulk_create(buf, &object_type, &object_count, &out_keys,
+            &out_attr_count, &out_attr_list, &mode, &out_statuses, &arena);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    /* object count larger than objects in buffer */
+
+    res = sai_deserialize_bulk_create(
+            "{\"object_type\":\"SAI_OBJECT_TYPE_PORT\",\"mode\":\"SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR\",\"object_count\":100000,\"objects\":[]}",
+            &object_type, &object_count, &out_keys, &out_attr_count, &out_attr_list, &mode, &out_statuses, &arena);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    res = sai_deserialize_bulk_create(buf, &object_type, &object_count, &out_keys,
+            &out_attr_count, &out_attr_list, &mode, &out_statuses, NULL);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    sai_deserialize_arena_free(&arena);
+}
+
+void subtest_serialize_n_truncated(
+        _In_ const char *buf,
+        _In_ size_t size,
+        _In_ const char *expected,
+        _In_ int res)
+{
+    size_t len = strlen(expected);
+
+    ASSERT_TRUE(res == (int)len, "expected %zu, got %d", len, res);
+
+    if (size == 0)
+    {
+        return;
+    }
+
+    len = (len < size) ? len : (size - 1);
+
+    ASSERT_TRUE(strlen(buf) == len, "expected output truncated to %zu", len);
+    ASSERT_TRUE(strncmp(buf, expected, len) == 0, "expected prefix of %s", expected);
+}
+
+void test_serialize_n()
+{
+    char buf[PRIMITIVE_BUFFER_SIZE * 2];
+    char exp[PRIMITIVE_BUFFER_SIZE * 2];
+    int res;
+    size_t size;
+
+    res = sai_serialize_uint32_n(NULL, 0, 4294967295U);
+    ASSERT_TRUE(res == 10, "expected 10");
+
+    res = sai_serialize_uint32_n(buf, 5, 4294967295U);
+    subtest_serialize_n_truncated(buf, 5, "4294967295", res);
+
+    res = sai_serialize_uint32_n(buf, sizeof(buf), 4294967295U);
+    ASSERT_STR_EQ(buf, "4294967295", res);
+
+    res = sai_serialize_enum_n(buf, 4, &sai_metadata_enum_sai_object_type_t, SAI_OBJECT_TYPE_PORT);
+    subtest_serialize_n_truncated(buf, 4, "SAI_OBJECT_TYPE_PORT", res);
+
+    sai_route_entry_t re;
+
+    re.switch_id = 0x123;
+    re.vr_id = 0xfab;
+    re.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    re.destination.addr.ip4 = htonl(0x01020304);
+    re.destination.mask.ip4 = htonl(0xffffffff);
+
+    res = sai_serialize_route_entry(exp, &re);
+
+    for (size = 0; size <= strlen(exp) + 1; size++)
+    {
+        memset(buf, 'x', sizeof(buf));
+
+        res = sai_serialize_route_entry_n(buf, size, &re);
+        subtest_serialize_n_truncated(buf, size, exp, res);
+
+        ASSERT_TRUE(buf[size] == 'x', "expected no write after %zu", size);
+    }
+
+    re.destination.addr_family = 2;
+
+    res = sai_serialize_route_entry_n(buf, sizeof(buf), &re);
+    ASSERT_TRUE(res < 0, "expected negative number");
+
+    sai_s32_list_t list;
+    sai_object_type_t ot[2] = {SAI_OBJECT_TYPE_PORT, SAI_OBJECT_TYPE_LAG};
+
+    list.count = 2;
+    list.list = (int32_t *)&ot[0];
+
+    res = sai_serialize_enum_list(exp, &sai_metadata_enum_sai_object_type_t, &list);
+
+    for (size = 0; size <= strlen(exp) + 1; size++)
+    {
+        res = sai_serialize_enum_list_n(buf, size, &sai_metadata_enum_sai_object_type_t, &list);
+        subtest_serialize_n_truncated(buf, size, exp, res);
+    }
+
+    sai_attribute_t attribute = {0};
+    const sai_attr_metadata_t* amd;
+
+    amd = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_SWITCH, SAI_SWITCH_ATTR_NUMBER_OF_ACTIVE_PORTS);
+    attribute.id = SAI_SWITCH_ATTR_NUMBER_OF_ACTIVE_PORTS;
+    attribute.value.u32 = 3;
+
+    res = sai_serialize_attribute(exp, amd, &attribute);
+
+    for (size = 0; size <= strlen(exp) + 1; size++)
+    {
+        res = sai_serialize_attribute_n(buf, size, amd, &attribute);
+        subtest_serialize_n_truncated(buf, size, exp, res);
+    }
+
+    res = sai_serialize_attribute_value(exp, amd, &attribute.value);
+
+    ASSERT_TRUE(sai_serialize_attribute_value_length(amd, &attribute.value) == res, "expected %d", res);
+
+    sai_fdb_event_notification_data_t data;
+    memset(&data, 0, sizeof(data));
+
+    res = sai_serialize_fdb_event_notification(exp, 1, &data);
+
+    for (size = 0; size <= strlen(exp) + 1; size++)
+    {
+        res = sai_serialize_fdb_event_notification_n(buf, size, 1, &data);
+        subtest_serialize_n_truncated(buf, size, exp, res);
+    }
+}
+
+void test_serialize_binary()
+{
+    uint8_t buf[PRIMITIVE_BUFFER_SIZE * 2];
+    uint8_t exp[PRIMITIVE_BUFFER_SIZE * 2];
+    char json[PRIMITIVE_BUFFER_SIZE * 8];
+    int res;
+    int len;
+    uint32_t u32;
+    int16_t s16;
+    bool b;
+
+    /* primitives are little endian and written only when they fit */
+
+    memset(buf, 0xff, sizeof(buf));
+
+    res = sai_serialize_binary_uint32(buf, 3, 0x11223344);
+    ASSERT_TRUE(res == 4, "expected 4");
+    ASSERT_TRUE(buf[0] == 0xff, "expected no write");
+
+    res = sai_serialize_binary_uint32(buf, sizeof(buf), 0x11223344);
+    ASSERT_TRUE(res == 4, "expected 4");
+    ASSERT_TRUE(memcmp(buf, "\x44\x33\x22\x11", 4) == 0, "expected little endian");
+
+    res = sai_deserialize_binary_uint32(buf, 3, &u32);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    res = sai_deserialize_binary_uint32(buf, 4, &u32);
+    ASSERT_TRUE(res == 4, "expected 4");
+    ASSERT_TRUE(u32 == 0x11223344, "expected 0x11223344, got 0x%x", u32);
+
+    res = sai_serialize_binary_int16(buf, sizeof(buf), -2);
+    ASSERT_TRUE(res == 2, "expected 2");
+    ASSERT_TRUE(memcmp(buf, "\xfe\xff", 2) == 0, "expected little endian");
+
+    res = sai_deserialize_binary_int16(buf, 2, &s16);
+    ASSERT_TRUE(res == 2, "expected 2");
+    ASSERT_TRUE(s16 == -2, "expected -2, got %d", s16);
+
+    buf[0] = 2;
+
+    res = sai_deserialize_binary_bool(buf, 1, &b);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    /* object round trip */
+
+    sai_object_meta_key_t mk;
+    sai_object_meta_key_t dmk;
+    sai_attribute_t attrs[5];
+    sai_attribute_t *list;
+    uint32_t count;
+    uint32_t lanes[4] = {1, 2, 3, 4};
+    sai_object_id_t sessions[2] = {0x22, 0x33};
+
+    memset(&mk, 0, sizeof(mk));
+    memset(attrs, 0, sizeof(attrs));
+
+    mk.objecttype = SAI_OBJECT_TYPE_PORT;
+    mk.objectkey.key.object_id = 0x1000000000001;
+
+    attrs[0].id = SAI_PORT_ATTR_HW_LANE_LIST;
+    attrs[0].value.u32list.count = 4;
+    attrs[0].value.u32list.list = lanes;
+    attrs[1].id = SAI_PORT_ATTR_MTU;
+    attrs[1].value.u32 = 9100;
+    attrs[2].id = SAI_PORT_ATTR_MEDIA_TYPE;
+    attrs[2].value.s32 = SAI_PORT_MEDIA_TYPE_FIBER;
+    attrs[3].id = SAI_PORT_ATTR_INGRESS_MIRROR_SESSION;
+    attrs[3].value.objlist.count = 2;
+    attrs[3].value.objlist.list = sessions;
+    attrs[4].id = SAI_PORT_ATTR_ADMIN_STATE;
+    attrs[4].value.booldata = true;
+
+    len = sai_serialize_binary_object(NULL, 0, &mk, 5, attrs);
+    ASSERT_TRUE(len > 0 && len <= (int)sizeof(exp), "expected length in range, got %d", len);
+
+    res = sai_serialize_binary_object(exp, sizeof(exp), &mk, 5, attrs);
+    ASSERT_TRUE(res == len, "expected %d, got %d", len, res);
+
+    res = sai_deserialize_binary_object(exp, (size_t)len, &dmk, &count, &list);
+    ASSERT_TRUE(res == len, "expected %d, got %d", len, res);
+    ASSERT_TRUE(count == 5, "expected 5 attributes, got %u", count);
+    ASSERT_TRUE(dmk.objecttype == SAI_OBJECT_TYPE_PORT, "expected port");
+    ASSERT_TRUE(dmk.objectkey.key.object_id == mk.objectkey.key.object_id, "expected same oid");
+    ASSERT_TRUE(list[0].value.u32list.count == 4, "expected 4 lanes");
+    ASSERT_TRUE(memcmp(list[0].value.u32list.list, lanes, sizeof(lanes)) == 0, "expected same lanes");
+    ASSERT_TRUE(list[1].value.u32 == 9100, "expected 9100");
+    ASSERT_TRUE(list[2].value.s32 == SAI_PORT_MEDIA_TYPE_FIBER, "expected fiber");
+    ASSERT_TRUE(list[3].value.objlist.count == 2, "expected 2 sessions");
+    ASSERT_TRUE(list[3].value.objlist.list[1] == 0x33, "expected same sessions");
+    ASSERT_TRUE(list[4].value.booldata, "expected true");
+
+    sai_deserialize_free_binary_object(&dmk, count, list);
+
+    res = sai_deserialize_binary_object(exp, (size_t)len - 1, &dmk, &count, &list);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    /* newer version is rejected, but unknown attributes are skipped */
+
+    memcpy(buf, exp, (size_t)len);
+    buf[4] = SAI_SERIALIZE_BINARY_VERSION + 1;
+
+    res = sai_deserialize_binary_object(buf, (size_t)len, &dmk, &count, &list);
+    ASSERT_TRUE(res < 0, "expected negative");
+
+    memcpy(buf, exp, (size_t)len);
+    sai_serialize_binary_uint32(buf + len - 9, 4, 0x7fffffff);
+
+    res = sai_deserialize_binary_object(buf, (size_t)len, &dmk, &count, &list);
+    ASSERT_TRUE(res == len, "expected %d, got %d", len, res);
+    ASSERT_TRUE(count == 4, "expected 4 attributes, got %u", count);
+
+    sai_deserialize_free_binary_object(&dmk, count, list);
+
+    /* binary to json and back gives the same binary */
+
+    res = sai_deserialize_binary_object_to_json(json, sizeof(json), exp, (size_t)len);
+    ASSERT_TRUE(res == (int)strlen(json), "expected %d, got %d", (int)strlen(json), res);
+    ASSERT_TRUE(strstr(json, "\"SAI_PORT_ATTR_MTU\"") != NULL, "expected MTU in %s", json);
+
+    memset(buf, 0, sizeof(buf));
+
+    res = sai_deserialize_json_object_to_binary(buf, sizeof(buf), json);
+    ASSERT_TRUE(res == len, "expected %d, got %d", len, res);
+    ASSERT_TRUE(memcmp(buf, exp, (size_t)len) == 0, "expected same binary");
+}
+
 int main()
 {
 
@@ -1740,7 +2698,9 @@ int main()
     test_serialize_chardata();
     test_deserialize_chardata();
 
-    /* TODO test int/uint serialize/deserialize */
+    test_serialize_integers();
+
+    /* TODO test int/uint deserialize */
 
     test_serialize_object_id();
     test_deserialize_object_id();
@@ -1803,6 +2763,16 @@ int main()
     test_deserialize_attr_id();
     test_serialize_attribute();
     test_deserialize_attribute();
+    test_deserialize_attribute_arena();
+    test_deserialize_view();
+    test_serialize_bulk_create();
+    test_deserialize_stream();
+    test_deserialize_stream_max_length();
+    test_deserialize_stream_split_list();
+
+    test_serialize_n();
+
+    test_serialize_binary();
 
     return 0;
 }
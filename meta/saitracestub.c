@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saitracestub.c
+ *
+ * @brief   This module defines SAI Trace Test stub vendor library
+ */
+
+#define _GNU_SOURCE
+
+#include <time.h>
+#include <sai.h>
+
+/*
+ * Only route api is implemented, remove_route_entry is left NULL, and last
+ * call arguments are exported, so trace test can check that wrappers pass
+ * them unchanged.
+ */
+
+#define SAI_TRACE_STUB_CALL_NS 100000
+
+uint32_t sai_trace_stub_calls = 0;
+
+const sai_route_entry_t *sai_trace_stub_route_entry = NULL;
+
+uint32_t sai_trace_stub_attr_count = 0;
+
+const sai_attribute_t *sai_trace_stub_attr_list = NULL;
+
+static sai_status_t sai_trace_stub_create_route_entry(
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+{
+    struct timespec ts = { 0, SAI_TRACE_STUB_CALL_NS };
+
+    nanosleep(&ts, NULL);
+
+    sai_trace_stub_calls++;
+    sai_trace_stub_route_entry = route_entry;
+    sai_trace_stub_attr_count = attr_count;
+    sai_trace_stub_attr_list = attr_list;
+
+    return attr_count ? SAI_STATUS_SUCCESS : SAI_STATUS_INVALID_PARAMETER;
+}
+
+static sai_status_t sai_trace_stub_set_route_entry_attribute(
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ const sai_attribute_t *attr)
+{
+    sai_trace_stub_calls++;
+    sai_trace_stub_route_entry = route_entry;
+    sai_trace_stub_attr_count = 1;
+    sai_trace_stub_attr_list = attr;
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_route_api_t sai_trace_stub_route_api;
+
+sai_status_t sai_api_query(
+        _In_ sai_api_t api,
+        _Out_ void **api_method_table)
+{
+    if (api != SAI_API_ROUTE)
+    {
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    sai_trace_stub_route_api.create_route_entry = sai_trace_stub_create_route_entry;
+    sai_trace_stub_route_api.set_route_entry_attribute = sai_trace_stub_set_route_entry_attribute;
+
+    *api_method_table = &sai_trace_stub_route_api;
+
+    return SAI_STATUS_SUCCESS;
+}
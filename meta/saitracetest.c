@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saitracetest.c
+ *
+ * @brief   This module defines SAI Trace Test
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dlfcn.h>
+#include <sai.h>
+
+#include "saitraceutils.h"
+
+#define ASSERT_TRUE(x,fmt,...)                              \
+    if (!(x)){                                              \
+        fprintf(stderr,                                     \
+                "ASSERT TRUE FAILED(%s:%d): %s: " fmt "\n", \
+                __func__, __LINE__, #x, ##__VA_ARGS__);     \
+        exit(1);}
+
+static size_t find_fn(
+        _In_ const char *name)
+{
+    size_t idx = 0;
+
+    for (; idx < sai_trace_fn_info_count; idx++)
+    {
+        if (strcmp(sai_trace_fn_info[idx].name, name) == 0)
+        {
+            return idx;
+        }
+    }
+
+    fprintf(stderr, "function %s not found\n", name);
+
+    exit(1);
+}
+
+static void check_fn_info(
+        _In_ const char *name,
+        _In_ const char *api_name,
+        _In_ const char *objecttype,
+        _In_ const char *op)
+{
+    const sai_trace_fn_info_t *info = &sai_trace_fn_info[find_fn(name)];
+
+    ASSERT_TRUE(strcmp(info->api_name, api_name) == 0, "%s: api %s", name, info->api_name);
+    ASSERT_TRUE(strcmp(info->op, op) == 0, "%s: op %s", name, info->op);
+
+    if (objecttype == NULL)
+    {
+        ASSERT_TRUE(info->objecttype == NULL, "%s: object type %s", name, info->objecttype);
+    }
+    else
+    {
+        ASSERT_TRUE(info->objecttype && strcmp(info->objecttype, objecttype) == 0, "%s: object type", name);
+    }
+}
+
+void test_fn_info()
+{
+    check_fn_info("sai_api_query", "global", NULL, "api_query");
+    check_fn_info("create_route_entry", "route", "SAI_OBJECT_TYPE_ROUTE_ENTRY", "create");
+    check_fn_info("create_route_entries", "route", "SAI_OBJECT_TYPE_ROUTE_ENTRY", "bulk_create");
+    check_fn_info("set_port_attribute", "port", "SAI_OBJECT_TYPE_PORT", "set");
+    check_fn_info("get_port_stats_ext", "port", "SAI_OBJECT_TYPE_PORT", "get_stats_ext");
+    check_fn_info("remove_next_hop_group_members", "next_hop_group", "SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER", "bulk_remove");
+}
+
+static void* stub_dlsym(
+        _In_ const char *name)
+{
+    /* same handle as trace library, so stub globals are shared */
+
+    void *handle = dlopen(getenv(SAI_TRACE_LIBSAI_ENV), RTLD_NOW | RTLD_NOLOAD);
+
+    ASSERT_TRUE(handle != NULL, "is %s set to libsaitracestub.so? %s", SAI_TRACE_LIBSAI_ENV, dlerror());
+
+    void *sym = dlsym(handle, name);
+
+    ASSERT_TRUE(sym != NULL, "symbol %s not found in stub", name);
+
+    dlclose(handle);
+
+    return sym;
+}
+
+void test_global_api()
+{
+    /* stub library supports only route api */
+
+    void *table = NULL;
+
+    sai_status_t status = sai_api_query(SAI_API_PORT, &table);
+
+    ASSERT_TRUE(status == SAI_STATUS_NOT_SUPPORTED, "status %d", status);
+    ASSERT_TRUE(table == NULL, "table should not be wrapped on failure");
+
+    status = sai_api_query(SAI_API_ROUTE, &table);
+
+    ASSERT_TRUE(status == SAI_STATUS_SUCCESS, "status %d", status);
+    ASSERT_TRUE(table != NULL, "table should be set");
+    ASSERT_TRUE(table != stub_dlsym("sai_trace_stub_route_api"), "table should be replaced by wrapper table");
+
+    void *again = NULL;
+
+    status = sai_api_query(SAI_API_ROUTE, &again);
+
+    ASSERT_TRUE(status == SAI_STATUS_SUCCESS && again == table, "wrapper table should be reused");
+
+    sai_trace_stats_t stats;
+
+    status = sai_trace_get_stats(find_fn("sai_api_query"), &stats);
+
+    ASSERT_TRUE(status == SAI_STATUS_SUCCESS, "status %d", status);
+    ASSERT_TRUE(stats.calls == 3, "calls %u", (uint32_t)stats.calls);
+    ASSERT_TRUE(stats.errors == 1, "errors %u", (uint32_t)stats.errors);
+    ASSERT_TRUE(stats.max_ns >= stats.p99_ns, "percentile above max");
+
+    status = sai_trace_get_stats(sai_trace_fn_info_count, &stats);
+
+    ASSERT_TRUE(status == SAI_STATUS_INVALID_PARAMETER, "expected invalid parameter");
+}
+
+void test_wrapper_api()
+{
+    void *table = NULL;
+
+    sai_status_t status = sai_api_query(SAI_API_ROUTE, &table);
+
+    ASSERT_TRUE(status == SAI_STATUS_SUCCESS, "status %d", status);
+
+    const sai_route_api_t *api = (const sai_route_api_t*)table;
+
+    ASSERT_TRUE(api->create_route_entry != NULL, "implemented member should be wrapped");
+    ASSERT_TRUE(api->set_route_entry_attribute != NULL, "implemented member should be wrapped");
+    ASSERT_TRUE(api->remove_route_entry == NULL, "NULL member should stay NULL");
+    ASSERT_TRUE(api->get_route_entry_attribute == NULL, "NULL member should stay NULL");
+
+    uint32_t *calls = (uint32_t*)stub_dlsym("sai_trace_stub_calls");
+    const sai_route_entry_t **route_entry = (const sai_route_entry_t**)stub_dlsym("sai_trace_stub_route_entry");
+    uint32_t *attr_count = (uint32_t*)stub_dlsym("sai_trace_stub_attr_count");
+    const sai_attribute_t **attr_list = (const sai_attribute_t**)stub_dlsym("sai_trace_stub_attr_list");
+
+    sai_route_entry_t entry;
+    sai_attribute_t attrs[2];
+
+    memset(&entry, 0, sizeof(entry));
+    memset(attrs, 0, sizeof(attrs));
+
+    status = api->create_route_entry(&entry, 2, attrs);
+
+    ASSERT_TRUE(status == SAI_STATUS_SUCCESS, "status %d", status);
+    ASSERT_TRUE(*calls == 1, "vendor function not called, calls %u", *calls);
+    ASSERT_TRUE(*route_entry == &entry, "route entry changed");
+    ASSERT_TRUE(*attr_count == 2, "attr count changed %u", *attr_count);
+    ASSERT_TRUE(*attr_list == attrs, "attr list changed");
+
+    /* stub fails on empty attribute list */
+
+    status = api->create_route_entry(&entry, 0, NULL);
+
+    ASSERT_TRUE(status == SAI_STATUS_INVALID_PARAMETER, "status %d", status);
+    ASSERT_TRUE(*calls == 2 && *attr_count == 0 && *attr_list == NULL, "vendor function not called");
+
+    status = api->set_route_entry_attribute(&entry, &attrs[1]);
+
+    ASSERT_TRUE(status == SAI_STATUS_SUCCESS, "status %d", status);
+    ASSERT_TRUE(*calls == 3 && *route_entry == &entry && *attr_list == &attrs[1], "set arguments changed");
+
+    sai_trace_stats_t stats;
+
+    status = sai_trace_get_stats(find_fn("create_route_entry"), &stats);
+
+    ASSERT_TRUE(status == SAI_STATUS_SUCCESS, "status %d", status);
+    ASSERT_TRUE(stats.calls == 2, "calls %u", (uint32_t)stats.calls);
+    ASSERT_TRUE(stats.errors == 1, "errors %u", (uint32_t)stats.errors);
+
+    /* stub create sleeps 100 us, percentiles are taken from histogram buckets */
+
+    ASSERT_TRUE(stats.p50_ns >= 80000, "histogram not updated, p50 %u", (uint32_t)stats.p50_ns);
+    ASSERT_TRUE(stats.p99_ns >= stats.p50_ns, "p99 below p50");
+    ASSERT_TRUE(stats.max_ns >= stats.p99_ns, "percentile above max");
+    ASSERT_TRUE(stats.total_ns >= 2 * 80000, "total %u", (uint32_t)stats.total_ns);
+
+    status = sai_trace_get_stats(find_fn("set_route_entry_attribute"), &stats);
+
+    ASSERT_TRUE(status == SAI_STATUS_SUCCESS, "status %d", status);
+    ASSERT_TRUE(stats.calls == 1 && stats.errors == 0, "calls %u", (uint32_t)stats.calls);
+
+    status = sai_trace_get_stats(find_fn("remove_route_entry"), &stats);
+
+    ASSERT_TRUE(status == SAI_STATUS_SUCCESS, "status %d", status);
+    ASSERT_TRUE(stats.calls == 0 && stats.p50_ns == 0, "expected no calls");
+}
+
+void test_dump()
+{
+    ASSERT_TRUE(sai_trace_dump("/dev/null") == SAI_STATUS_SUCCESS, "dump failed");
+    ASSERT_TRUE(sai_trace_dump("/non/existing/dir/file") == SAI_STATUS_FAILURE, "expected failure");
+}
+
+int main()
+{
+    test_fn_info();
+
+    test_global_api();
+
+    test_wrapper_api();
+
+    test_dump();
+
+    return 0;
+}
@@ -0,0 +1,521 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saitraceutils.c
+ *
+ * @brief   This module defines SAI Trace Utils
+ */
+
+#define _GNU_SOURCE
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sai.h>
+#include "saitraceutils.h"
+
+#define SAI_TRACE_SUB_BUCKETS (1 << SAI_TRACE_HISTOGRAM_SUB_BUCKET_BITS)
+
+typedef struct _sai_trace_fn_stats_t
+{
+    uint64_t calls;
+    uint64_t errors;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t buckets[SAI_TRACE_HISTOGRAM_BUCKETS];
+
+} sai_trace_fn_stats_t;
+
+/*
+ * Each thread records into its own block, so traced calls don't take locks
+ * and don't share cache lines. Blocks are linked in lock free list which is
+ * only walked by readers, and are never freed, so statistics of exited
+ * threads are still reported.
+ */
+
+typedef struct _sai_trace_thread_t
+{
+    struct _sai_trace_thread_t *next;
+
+    /* sai_trace_fn_info_count pointers, stats are allocated on first call */
+
+    sai_trace_fn_stats_t **stats;
+
+} sai_trace_thread_t;
+
+typedef struct _sai_trace_dump_entry_t
+{
+    size_t fn_index;
+
+    sai_trace_stats_t stats;
+
+} sai_trace_dump_entry_t;
+
+static sai_trace_thread_t *sai_trace_threads = NULL;
+
+static __thread sai_trace_thread_t *sai_trace_thread = NULL;
+
+static pthread_once_t sai_trace_once = PTHREAD_ONCE_INIT;
+
+static void *sai_trace_handle = NULL;
+
+static sem_t sai_trace_dump_sem;
+
+static size_t sai_trace_bucket(
+        _In_ uint64_t ns)
+{
+    if (ns < SAI_TRACE_SUB_BUCKETS)
+    {
+        return (size_t)ns;
+    }
+
+    if (ns >> SAI_TRACE_HISTOGRAM_MAX_BITS)
+    {
+        return SAI_TRACE_HISTOGRAM_BUCKETS - 1;
+    }
+
+    int shift = 63 - __builtin_clzll(ns) - SAI_TRACE_HISTOGRAM_SUB_BUCKET_BITS;
+
+    return ((size_t)(shift + 1) << SAI_TRACE_HISTOGRAM_SUB_BUCKET_BITS) + (size_t)((ns >> shift) & (SAI_TRACE_SUB_BUCKETS - 1));
+}
+
+static uint64_t sai_trace_bucket_value(
+        _In_ size_t idx)
+{
+    /* highest value recorded in bucket */
+
+    if (idx < SAI_TRACE_SUB_BUCKETS)
+    {
+        return idx;
+    }
+
+    size_t shift = idx / SAI_TRACE_SUB_BUCKETS - 1;
+
+    return ((uint64_t)(SAI_TRACE_SUB_BUCKETS + idx % SAI_TRACE_SUB_BUCKETS + 1) << shift) - 1;
+}
+
+static sai_trace_thread_t* sai_trace_thread_register(void)
+{
+    sai_trace_thread_t *thread = calloc(1, sizeof(sai_trace_thread_t));
+
+    if (thread == NULL)
+    {
+        return NULL;
+    }
+
+    thread->stats = calloc(sai_trace_fn_info_count, sizeof(sai_trace_fn_stats_t*));
+
+    if (thread->stats == NULL)
+    {
+        free(thread);
+
+        return NULL;
+    }
+
+    thread->next = __atomic_load_n(&sai_trace_threads, __ATOMIC_RELAXED);
+
+    while (!__atomic_compare_exchange_n(&sai_trace_threads, &thread->next, thread, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    {
+        /* thread->next was updated to current head */
+    }
+
+    sai_trace_thread = thread;
+
+    return thread;
+}
+
+uint64_t sai_trace_begin(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+void sai_trace_end(
+        _In_ size_t fn_index,
+        _In_ uint64_t start,
+        _In_ sai_status_t status)
+{
+    uint64_t ns = sai_trace_begin() - start;
+
+    sai_trace_thread_t *thread = sai_trace_thread;
+
+    if (fn_index >= sai_trace_fn_info_count)
+    {
+        return;
+    }
+
+    if (thread == NULL && (thread = sai_trace_thread_register()) == NULL)
+    {
+        return;
+    }
+
+    sai_trace_fn_stats_t *stats = thread->stats[fn_index];
+
+    if (stats == NULL)
+    {
+        stats = calloc(1, sizeof(sai_trace_fn_stats_t));
+
+        if (stats == NULL)
+        {
+            return;
+        }
+
+        __atomic_store_n(&thread->stats[fn_index], stats, __ATOMIC_RELEASE);
+    }
+
+    /*
+     * Only owning thread writes its stats, so plain read and relaxed store
+     * is enough, readers will see each counter as whole value.
+     */
+
+    __atomic_store_n(&stats->calls, stats->calls + 1, __ATOMIC_RELAXED);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        __atomic_store_n(&stats->errors, stats->errors + 1, __ATOMIC_RELAXED);
+    }
+
+    __atomic_store_n(&stats->total_ns, stats->total_ns + ns, __ATOMIC_RELAXED);
+
+    if (ns > stats->max_ns)
+    {
+        __atomic_store_n(&stats->max_ns, ns, __ATOMIC_RELAXED);
+    }
+
+    size_t idx = sai_trace_bucket(ns);
+
+    __atomic_store_n(&stats->buckets[idx], stats->buckets[idx] + 1, __ATOMIC_RELAXED);
+}
+
+static void sai_trace_sum(
+        _In_ size_t fn_index,
+        _Out_ sai_trace_fn_stats_t *sum)
+{
+    memset(sum, 0, sizeof(sai_trace_fn_stats_t));
+
+    sai_trace_thread_t *thread = __atomic_load_n(&sai_trace_threads, __ATOMIC_ACQUIRE);
+
+    for (; thread != NULL; thread = thread->next)
+    {
+        const sai_trace_fn_stats_t *stats = __atomic_load_n(&thread->stats[fn_index], __ATOMIC_ACQUIRE);
+
+        if (stats == NULL || __atomic_load_n(&stats->calls, __ATOMIC_RELAXED) == 0)
+        {
+            continue;
+        }
+
+        sum->calls += __atomic_load_n(&stats->calls, __ATOMIC_RELAXED);
+        sum->errors += __atomic_load_n(&stats->errors, __ATOMIC_RELAXED);
+        sum->total_ns += __atomic_load_n(&stats->total_ns, __ATOMIC_RELAXED);
+
+        uint64_t max_ns = __atomic_load_n(&stats->max_ns, __ATOMIC_RELAXED);
+
+        if (max_ns > sum->max_ns)
+        {
+            sum->max_ns = max_ns;
+        }
+
+        size_t idx = 0;
+
+        for (; idx < SAI_TRACE_HISTOGRAM_BUCKETS; idx++)
+        {
+            sum->buckets[idx] += __atomic_load_n(&stats->buckets[idx], __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static uint64_t sai_trace_percentile(
+        _In_ const sai_trace_fn_stats_t *sum,
+        _In_ uint64_t count,
+        _In_ uint64_t percent)
+{
+    /* count is taken from buckets, since calls can be already incremented */
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = (count * percent + 99) / 100;
+
+    uint64_t seen = 0;
+
+    size_t idx = 0;
+
+    for (; idx < SAI_TRACE_HISTOGRAM_BUCKETS; idx++)
+    {
+        seen += sum->buckets[idx];
+
+        if (seen >= rank)
+        {
+            uint64_t value = sai_trace_bucket_value(idx);
+
+            return value < sum->max_ns ? value : sum->max_ns;
+        }
+    }
+
+    return sum->max_ns;
+}
+
+sai_status_t sai_trace_get_stats(
+        _In_ size_t fn_index,
+        _Out_ sai_trace_stats_t *stats)
+{
+    if (fn_index >= sai_trace_fn_info_count || stats == NULL)
+    {
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    sai_trace_fn_stats_t sum;
+
+    sai_trace_sum(fn_index, &sum);
+
+    uint64_t count = 0;
+
+    size_t idx = 0;
+
+    for (; idx < SAI_TRACE_HISTOGRAM_BUCKETS; idx++)
+    {
+        count += sum.buckets[idx];
+    }
+
+    stats->calls = sum.calls;
+    stats->errors = sum.errors;
+    stats->total_ns = sum.total_ns;
+    stats->max_ns = sum.max_ns;
+    stats->p50_ns = sai_trace_percentile(&sum, count, 50);
+    stats->p90_ns = sai_trace_percentile(&sum, count, 90);
+    stats->p99_ns = sai_trace_percentile(&sum, count, 99);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static int sai_trace_dump_entry_cmp(
+        _In_ const void *a,
+        _In_ const void *b)
+{
+    const sai_trace_dump_entry_t *ea = (const sai_trace_dump_entry_t*)a;
+    const sai_trace_dump_entry_t *eb = (const sai_trace_dump_entry_t*)b;
+
+    if (ea->stats.total_ns != eb->stats.total_ns)
+    {
+        return ea->stats.total_ns < eb->stats.total_ns ? 1 : -1;
+    }
+
+    return ea->fn_index < eb->fn_index ? -1 : (ea->fn_index > eb->fn_index);
+}
+
+sai_status_t sai_trace_dump(
+        _In_ const char *file_name)
+{
+    sai_trace_dump_entry_t *entries = calloc(sai_trace_fn_info_count + 1, sizeof(sai_trace_dump_entry_t));
+
+    if (entries == NULL)
+    {
+        return SAI_STATUS_NO_MEMORY;
+    }
+
+    FILE *file = (file_name == NULL) ? stderr : fopen(file_name, "a");
+
+    if (file == NULL)
+    {
+        free(entries);
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    size_t count = 0;
+
+    size_t idx = 0;
+
+    for (; idx < sai_trace_fn_info_count; idx++)
+    {
+        if (sai_trace_get_stats(idx, &entries[count].stats) == SAI_STATUS_SUCCESS && entries[count].stats.calls)
+        {
+            entries[count++].fn_index = idx;
+        }
+    }
+
+    qsort(entries, count, sizeof(sai_trace_dump_entry_t), sai_trace_dump_entry_cmp);
+
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+
+    fprintf(file, "sai trace report, pid %d, time %ld, %lu functions called\n",
+            (int)getpid(), (long)ts.tv_sec, (unsigned long)count);
+
+    fprintf(file, "%-16s %-40s %-32s %-16s %12s %10s %12s %10s %10s %10s %10s %10s\n",
+            "api", "function", "object type", "op", "calls", "errors",
+            "total_ms", "avg_us", "p50_us", "p90_us", "p99_us", "max_us");
+
+    for (idx = 0; idx < count; idx++)
+    {
+        const sai_trace_fn_info_t *info = &sai_trace_fn_info[entries[idx].fn_index];
+        const sai_trace_stats_t *stats = &entries[idx].stats;
+
+        const char *ot = info->objecttype ? info->objecttype : "-";
+
+        if (strncmp(ot, "SAI_OBJECT_TYPE_", 16) == 0)
+        {
+            ot += 16;
+        }
+
+        fprintf(file, "%-16s %-40s %-32s %-16s %12" PRIu64 " %10" PRIu64 " %12.3f %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+                info->api_name, info->name, ot, info->op, stats->calls, stats->errors,
+                (double)stats->total_ns / 1e6,
+                (double)stats->total_ns / (double)stats->calls / 1e3,
+                (double)stats->p50_ns / 1e3,
+                (double)stats->p90_ns / 1e3,
+                (double)stats->p99_ns / 1e3,
+                (double)stats->max_ns / 1e3);
+    }
+
+    free(entries);
+
+    if (file != stderr)
+    {
+        return fclose(file) == 0 ? SAI_STATUS_SUCCESS : SAI_STATUS_FAILURE;
+    }
+
+    fflush(file);
+
+    return SAI_STATUS_SUCCESS;
+}
+
+static void sai_trace_signal_handler(
+        _In_ int signo)
+{
+    /*
+     * Report can't be written from signal handler, since it allocates memory
+     * and uses buffered output, so only wake up dump thread, posting
+     * semaphore is signal safe.
+     */
+
+    sem_post(&sai_trace_dump_sem);
+}
+
+static void* sai_trace_dump_thread(
+        _In_ void *arg)
+{
+    while (1)
+    {
+        if (sem_wait(&sai_trace_dump_sem) != 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            break;
+        }
+
+        sai_trace_dump(getenv(SAI_TRACE_DUMP_FILE_ENV));
+    }
+
+    return NULL;
+}
+
+static void sai_trace_install_signal_handler(void)
+{
+    struct sigaction sa;
+
+    if (sigaction(SAI_TRACE_DUMP_SIGNAL, NULL, &sa) != 0 || sa.sa_handler != SIG_DFL)
+    {
+        /* application is using this signal */
+
+        return;
+    }
+
+    if (sem_init(&sai_trace_dump_sem, 0, 0) != 0)
+    {
+        return;
+    }
+
+    pthread_t thread;
+
+    if (pthread_create(&thread, NULL, sai_trace_dump_thread, NULL) != 0)
+    {
+        return;
+    }
+
+    pthread_detach(thread);
+
+    memset(&sa, 0, sizeof(sa));
+
+    sa.sa_handler = sai_trace_signal_handler;
+    sa.sa_flags = SA_RESTART;
+
+    sigemptyset(&sa.sa_mask);
+
+    sigaction(SAI_TRACE_DUMP_SIGNAL, &sa, NULL);
+}
+
+static void sai_trace_load(void)
+{
+    const char *name = getenv(SAI_TRACE_LIBSAI_ENV);
+
+    if (name == NULL)
+    {
+        name = SAI_TRACE_DEFAULT_LIBSAI;
+    }
+
+    sai_trace_handle = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+
+    if (sai_trace_handle == NULL)
+    {
+        fprintf(stderr, "sai trace: failed to load %s: %s\n", name, dlerror());
+    }
+    else if (dlsym(sai_trace_handle, "sai_trace_dump") != NULL)
+    {
+        /* trace library is installed under vendor library name */
+
+        fprintf(stderr, "sai trace: %s is trace library, set %s to vendor library\n", name, SAI_TRACE_LIBSAI_ENV);
+
+        dlclose(sai_trace_handle);
+
+        sai_trace_handle = NULL;
+    }
+
+    sai_trace_install_signal_handler();
+}
+
+void* sai_trace_dlsym(
+        _In_ const char *name)
+{
+    pthread_once(&sai_trace_once, sai_trace_load);
+
+    if (sai_trace_handle == NULL)
+    {
+        return NULL;
+    }
+
+    return dlsym(sai_trace_handle, name);
+}
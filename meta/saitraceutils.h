@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2014 Microsoft Open Technologies, Inc.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABILITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ *    Microsoft would like to thank the following companies for their review and
+ *    assistance with these files: Intel Corporation, Mellanox Technologies Ltd,
+ *    Dell Products, L.P., Facebook, Inc., Marvell International Ltd.
+ *
+ * @file    saitraceutils.h
+ *
+ * @brief   This module defines SAI Trace Utilities
+ */
+
+#ifndef __SAITRACEUTILS_H_
+#define __SAITRACEUTILS_H_
+
+#include <sai.h>
+
+/**
+ * @defgroup SAITRACEUTILS SAI - Trace Utilities Definitions
+ *
+ * @{
+ */
+
+/**
+ * @brief Environment variable with vendor SAI library path.
+ */
+#define SAI_TRACE_LIBSAI_ENV "SAI_TRACE_LIBSAI"
+
+/**
+ * @brief Environment variable with file name of signal triggered report.
+ */
+#define SAI_TRACE_DUMP_FILE_ENV "SAI_TRACE_DUMP_FILE"
+
+/**
+ * @brief Vendor SAI library loaded when environment variable is not set.
+ *
+ * When trace library is preloaded, vendor library is already loaded by
+ * application under this name.
+ */
+#ifndef SAI_TRACE_DEFAULT_LIBSAI
+#define SAI_TRACE_DEFAULT_LIBSAI "libsai.so"
+#endif
+
+/**
+ * @brief Signal which writes report.
+ */
+#define SAI_TRACE_DUMP_SIGNAL SIGUSR2
+
+/**
+ * @brief Number of histogram sub buckets per power of two, as bits.
+ *
+ * With 3 bits latency is recorded with at most 12.5% error.
+ */
+#define SAI_TRACE_HISTOGRAM_SUB_BUCKET_BITS 3
+
+/**
+ * @brief Max recorded latency, as power of two in nanoseconds.
+ *
+ * Longer calls are recorded in last bucket.
+ */
+#define SAI_TRACE_HISTOGRAM_MAX_BITS 40
+
+/**
+ * @brief Number of histogram buckets.
+ */
+#define SAI_TRACE_HISTOGRAM_BUCKETS ((SAI_TRACE_HISTOGRAM_MAX_BITS - SAI_TRACE_HISTOGRAM_SUB_BUCKET_BITS + 1) << SAI_TRACE_HISTOGRAM_SUB_BUCKET_BITS)
+
+/**
+ * @brief Traced function info.
+ */
+typedef struct _sai_trace_fn_info_t
+{
+    /**
+     * @brief Function name, like "create_route_entry".
+     */
+    const char *name;
+
+    /**
+     * @brief API name, like "route", "global" for global functions.
+     */
+    const char *api_name;
+
+    /**
+     * @brief Object type name, NULL if function is not object type specific.
+     */
+    const char *objecttype;
+
+    /**
+     * @brief Operation, like "create", "bulk_create" or "get_stats".
+     */
+    const char *op;
+
+} sai_trace_fn_info_t;
+
+/**
+ * @brief Traced function statistics summed over all threads.
+ */
+typedef struct _sai_trace_stats_t
+{
+    /**
+     * @brief Number of calls.
+     */
+    uint64_t calls;
+
+    /**
+     * @brief Number of calls which returned failure status.
+     */
+    uint64_t errors;
+
+    /**
+     * @brief Total time spent in calls, in nanoseconds.
+     */
+    uint64_t total_ns;
+
+    /**
+     * @brief Longest call, in nanoseconds.
+     */
+    uint64_t max_ns;
+
+    /**
+     * @brief Call latency median, in nanoseconds.
+     *
+     * Percentiles are taken from histogram and are 0 when no call was recorded.
+     */
+    uint64_t p50_ns;
+
+    /**
+     * @brief Call latency 90th percentile, in nanoseconds.
+     */
+    uint64_t p90_ns;
+
+    /**
+     * @brief Call latency 99th percentile, in nanoseconds.
+     */
+    uint64_t p99_ns;
+
+} sai_trace_stats_t;
+
+/**
+ * @brief Traced functions info, indexed by function index.
+ *
+ * Generated by parse.pl in saitrace.c.
+ */
+extern const sai_trace_fn_info_t sai_trace_fn_info[];
+
+/**
+ * @brief Number of traced functions.
+ */
+extern const size_t sai_trace_fn_info_count;
+
+/**
+ * @brief Find symbol in vendor SAI library.
+ *
+ * Library is loaded on first call.
+ *
+ * @param[in] name Symbol name
+ *
+ * @return Symbol address or NULL if library or symbol was not found
+ */
+extern void* sai_trace_dlsym(
+        _In_ const char *name);
+
+/**
+ * @brief Get time stamp before traced call.
+ *
+ * @return Monotonic time in nanoseconds
+ */
+extern uint64_t sai_trace_begin(void);
+
+/**
+ * @brief Record traced call.
+ *
+ * Updates calling thread statistics only, so there is no locking and no
+ * shared cache line between threads.
+ *
+ * @param[in] fn_index Function index
+ * @param[in] start Time stamp returned by sai_trace_begin
+ * @param[in] status Status returned by traced call
+ */
+extern void sai_trace_end(
+        _In_ size_t fn_index,
+        _In_ uint64_t start,
+        _In_ sai_status_t status);
+
+/**
+ * @brief Get function statistics.
+ *
+ * @param[in] fn_index Function index
+ * @param[out] stats Statistics summed over all threads
+ *
+ * @return #SAI_STATUS_SUCCESS on success, #SAI_STATUS_INVALID_PARAMETER on invalid index
+ */
+extern sai_status_t sai_trace_get_stats(
+        _In_ size_t fn_index,
+        _Out_ sai_trace_stats_t *stats);
+
+/**
+ * @brief Write report of all called functions.
+ *
+ * Functions are sorted by total time spent in call.
+ *
+ * @param[in] file_name File name, if NULL report is written to stderr
+ *
+ * @return #SAI_STATUS_SUCCESS on success, failure status code on error
+ */
+extern sai_status_t sai_trace_dump(
+        _In_ const char *file_name);
+
+/**
+ * @}
+ */
+#endif /** __SAITRACEUTILS_H_ */
@@ -60,18 +60,39 @@ sub CreateSerializeForEnums
         WriteSource "{";
         WriteSource "return sai_serialize_enum(buffer, &sai_metadata_enum_$key, $suffix);";
         WriteSource "}";
+
+        WriteHeader "extern int sai_serialize_${suffix}_n(";
+        WriteHeader "_Out_ char *buffer,";
+        WriteHeader "_In_ size_t size,";
+        WriteHeader "_In_ $key $suffix);\n";
+
+        WriteSource "int sai_serialize_${suffix}_n(";
+        WriteSource "_Out_ char *buffer,";
+        WriteSource "_In_ size_t size,";
+        WriteSource "_In_ $key $suffix)";
+        WriteSource "{";
+        WriteSource "return sai_serialize_enum_n(buffer, size, &sai_metadata_enum_$key, $suffix);";
+        WriteSource "}";
     }
 }
 
 #
-# we are using sprintf here, but in all cases it's const string passed, so
-# compiler will optimize this to strcpy, and no snprintf function will be
-# actually called, actual functions called will be those written by user in
-# saiserialize.c and optimization should focus on those functions
+# in all cases const string is emitted, so memcpy with known size is used
+# instead of sprintf, actual values are formatted by functions written by user
+# in saiserialize.c and optimization should focus on those functions
+#
+# each serialize method has also length bounded version with "_n" suffix,
+# which behaves like snprintf: it takes buffer size, writes at most size
+# characters including '\0' and returns number of characters that would be
+# written if buffer was large enough, so caller can allocate right sized
+# buffer instead of using large scratch buffer for long arrays
 #
-# TODO we need version with like snprintf to write only N characters since
-# right how we don't know how long output will be, for long arrays it can be
-# even kB
+# each serialize method has also binary version with "_binary_" infix, which
+# uses compact little endian encoding with fixed size values and no member
+# names, members are serialized in declaration order and lists are prefixed by
+# presence flag, since list count is serialized as separate member, binary
+# versions have the same size semantics as "_n" versions, but values are never
+# truncated, value is written only when it fits in buffer
 #
 # we will treat notification params as struct members and they will be
 # serialized as json object all consts printfs could be exchanged to memcpy for
@@ -122,11 +143,21 @@ sub EmitSerializeFunctionHeader
 
     my @keys = @{ $structInfoEx{keys} };
 
-    WriteHeader "extern int sai_serialize_$structBase(";
-    WriteHeader "_Out_ char *buf,";
+    my $fnName = GetSerializeFunctionName($refStructInfoEx, $structBase);
+
+    my $bufType = IsBinarySerialize($refStructInfoEx) ? "uint8_t" : "char";
 
-    WriteSource "int sai_serialize_$structBase(";
-    WriteSource "_Out_ char *buf,";
+    WriteHeader "extern int $fnName(";
+    WriteHeader "_Out_ $bufType *buf,";
+
+    WriteSource "int $fnName(";
+    WriteSource "_Out_ $bufType *buf,";
+
+    if (defined $structInfoEx{bounded} or defined $structInfoEx{binary})
+    {
+        WriteHeader "_In_ size_t size,";
+        WriteSource "_In_ size_t size,";
+    }
 
     if (defined $structInfoEx{union} and not defined $structInfoEx{extraparam})
     {
@@ -325,6 +356,7 @@ sub GetTypeInfoForSerialize
         $TypeInfo{amp} = "&";
         $TypeInfo{deamp} = "&";
         $TypeInfo{isattribute} = 1;
+        $TypeInfo{needfree} = 1;
 
         if (not defined $structInfoEx{membersHash}->{$name}{objects})
         {
@@ -352,6 +384,7 @@ sub GetTypeInfoForSerialize
     {
         $TypeInfo{amp} = "&";
         $TypeInfo{deamp} = "&";
+        $TypeInfo{needfree} = 1;
 
         # sai_s32_list_t enum !
     }
@@ -359,12 +392,14 @@ sub GetTypeInfoForSerialize
     {
         $TypeInfo{needQuote} = 1;
         $TypeInfo{deamp} = "&";
+        $TypeInfo{isenum} = 1;
     }
     elsif (defined $main::SAI_UNIONS{$type} and $type =~ /^sai_(\w+)_t$/)
     {
         $TypeInfo{union} = 1;
         $TypeInfo{amp} = "&";
         $TypeInfo{deamp} = "&";
+        $TypeInfo{needfree} = 1;
     }
     elsif ($type eq "char[32]")
     {
@@ -447,12 +482,111 @@ sub GetCounterNameAndType
     return ($countMemberName, $countType);
 }
 
+sub IsBoundedSerialize
+{
+    my $refStructInfoEx = shift;
+
+    return defined $refStructInfoEx->{bounded};
+}
+
+sub IsBinarySerialize
+{
+    my $refStructInfoEx = shift;
+
+    return defined $refStructInfoEx->{binary};
+}
+
+sub GetSerializeFunctionName
+{
+    my ($refStructInfoEx, $suffix) = @_;
+
+    return "sai_serialize_binary_$suffix" if IsBinarySerialize($refStructInfoEx);
+
+    return "sai_serialize_${suffix}_n" if IsBoundedSerialize($refStructInfoEx);
+
+    return "sai_serialize_$suffix";
+}
+
+sub GetDeserializeFunctionName
+{
+    my ($refStructInfoEx, $suffix) = @_;
+
+    return "sai_deserialize_binary_$suffix" if IsBinarySerialize($refStructInfoEx);
+
+    return "sai_deserialize_$suffix";
+}
+
+sub GetDeserializeCall
+{
+    #
+    # members which can hold lists are deserialized by "_ex" methods, so arena
+    # is passed down to every list allocation
+    #
+
+    my ($refStructInfoEx, $refTypeInfo, $suffix, $params) = @_;
+
+    my $fnName = GetDeserializeFunctionName($refStructInfoEx, $suffix);
+
+    return "$fnName($params)" if not defined $refTypeInfo->{needfree};
+
+    return "${fnName}_ex($params, arena)";
+}
+
+sub GetSerializeBufferParams
+{
+    my $refStructInfoEx = shift;
+
+    return "BIN_BUF, BIN_SIZE, " if IsBinarySerialize($refStructInfoEx);
+
+    return "EMIT_N_BUF, EMIT_N_SIZE, " if IsBoundedSerialize($refStructInfoEx);
+
+    return "buf, ";
+}
+
+sub GetEmitMacro
+{
+    my ($refStructInfoEx, $macro) = @_;
+
+    $macro =~ s/^EMIT/EMIT_N/ if IsBoundedSerialize($refStructInfoEx);
+
+    return $macro;
+}
+
+sub GetBinaryCall
+{
+    #
+    # binary format don't need enum names, so enums are serialized as int32
+    #
+
+    my ($refTypeInfo, $memberName, $deserialize) = @_;
+
+    return ($refTypeInfo->{suffix}, $memberName) if not defined $refTypeInfo->{isenum};
+
+    return ("int32", "(int32_t*)$memberName") if $deserialize;
+
+    return ("int32", "(int32_t)$memberName");
+}
+
 sub EmitSerializeHeader
 {
+    my $refStructInfoEx = shift;
+
     WriteSource "{";
-    WriteSource "char *begin_buf = buf;";
+
+    if (IsBoundedSerialize($refStructInfoEx) or IsBinarySerialize($refStructInfoEx))
+    {
+        WriteSource "size_t pos = 0;";
+    }
+    else
+    {
+        WriteSource "char *begin_buf = buf;";
+    }
+
     WriteSource "int ret;\n";
-    WriteSource "EMIT(\"{\");\n";
+
+    return if IsBinarySerialize($refStructInfoEx);
+
+    WriteSource GetEmitMacro($refStructInfoEx, "EMIT") . "(\"{\");\n";
 }
 
 sub WriteSkipForMask
@@ -492,20 +626,36 @@ sub EmitSerializeFooter
         WriteSource "}\n";
     }
 
-    WriteSource "EMIT(\"}\");\n";
+    if (IsBinarySerialize($refStructInfoEx))
+    {
+        WriteSource "return (int)pos;";
+        WriteSource "}";
+        return;
+    }
 
-    WriteSource "return (int)(buf - begin_buf);";
+    WriteSource GetEmitMacro($refStructInfoEx, "EMIT") . "(\"}\");\n";
+
+    if (IsBoundedSerialize($refStructInfoEx))
+    {
+        WriteSource "return (int)pos;";
+    }
+    else
+    {
+        WriteSource "return (int)(buf - begin_buf);";
+    }
 
     WriteSource "}";
 }
 
 sub GetEmitMacroName
 {
-    my $refTypeInfo = shift;
+    my ($refStructInfoEx, $refTypeInfo) = @_;
 
-    return "EMIT_QUOTE_CHECK" if $refTypeInfo->{needQuote};
+    return "BIN_CHECK" if IsBinarySerialize($refStructInfoEx);
 
-    return "EMIT_CHECK";
+    return GetEmitMacro($refStructInfoEx, "EMIT_QUOTE_CHECK") if $refTypeInfo->{needQuote};
+
+    return GetEmitMacro($refStructInfoEx, "EMIT_CHECK");
 }
 
 sub GetPassParamsForSerialize
@@ -545,11 +695,19 @@ sub EmitSerializePrimitive
 
     my $suffix = $refTypeInfo->{suffix};
 
-    my $emitMacro = GetEmitMacroName($refTypeInfo);
+    my $memberName = $refTypeInfo->{memberName};
+
+    ($suffix, $memberName) = GetBinaryCall($refTypeInfo, $memberName) if IsBinarySerialize($refStructInfoEx);
+
+    my $emitMacro = GetEmitMacroName($refStructInfoEx, $refTypeInfo);
 
     my $passParams = GetPassParamsForSerialize($refStructInfoEx, $refTypeInfo);
 
-    my $serializeCall = "sai_serialize_$suffix(buf, $passParams$refTypeInfo->{amp}$refTypeInfo->{memberName})";
+    my $fnName = GetSerializeFunctionName($refStructInfoEx, $suffix);
+
+    my $bufParams = GetSerializeBufferParams($refStructInfoEx);
+
+    my $serializeCall = "$fnName($bufParams$passParams$refTypeInfo->{amp}$memberName)";
 
     WriteSource "$emitMacro($serializeCall, $suffix);";
 }
@@ -560,9 +718,9 @@ sub GetEmitKeyMacroName
 
     my $firstKey = $refStructInfoEx->{keys}->[0];
 
-    return "EMIT_KEY" if ($firstKey eq $name) or defined $refStructInfoEx->{union};
+    return GetEmitMacro($refStructInfoEx, "EMIT_KEY") if ($firstKey eq $name) or defined $refStructInfoEx->{union};
 
-    return "EMIT_NEXT_KEY";
+    return GetEmitMacro($refStructInfoEx, "EMIT_NEXT_KEY");
 }
 
 sub EmitSerializeMemberKey
@@ -571,6 +729,8 @@ sub EmitSerializeMemberKey
 
     my $name = $refTypeInfo->{name};
 
+    return if IsBinarySerialize($refStructInfoEx); # binary format has no keys
+
     my $emitKeyMacro = GetEmitKeyMacroName($refStructInfoEx, $name);
 
     WriteSource "$emitKeyMacro(\"$name\");\n";
@@ -655,12 +815,61 @@ sub EmitSerializeValidOnlyFooter
     WriteSource $footer;
 }
 
+sub EmitSerializeBinaryArray
+{
+    my ($refStructInfoEx, $refTypeInfo) = @_;
+
+    my ($countMemberName, $countType, $staticArray) = GetCounterNameAndType($refStructInfoEx, $refTypeInfo);
+
+    my $memberName = $refTypeInfo->{memberName};
+
+    WriteSource "{";
+
+    if (not defined $staticArray)
+    {
+        # list count is serialized as separate member, so only presence flag
+        # is needed to distinguish empty list from NULL list
+
+        WriteSource "bool present = ($memberName != NULL && $countMemberName != 0);\n";
+        WriteSource "BIN_CHECK(sai_serialize_binary_bool(BIN_BUF, BIN_SIZE, present), bool);\n";
+        WriteSource "if (present)";
+        WriteSource "{";
+    }
+
+    WriteSource "$countType idx;\n";
+    WriteSource "for (idx = 0; idx < $countMemberName; idx++)";
+    WriteSource "{";
+
+    my $passParams = GetPassParamsForSerialize($refStructInfoEx, $refTypeInfo);
+
+    if ($refTypeInfo->{isattribute})
+    {
+        WriteSource "const sai_attr_metadata_t *meta =";
+        WriteSource "    sai_metadata_get_attr_metadata($refTypeInfo->{objectType}, $memberName\[idx\].id);\n";
+
+        $passParams = "meta, $passParams";
+    }
+
+    my ($suffix, $itemName) = GetBinaryCall($refTypeInfo, "$memberName\[idx\]");
+
+    WriteSource "BIN_CHECK(sai_serialize_binary_$suffix(BIN_BUF, BIN_SIZE, $passParams$refTypeInfo->{amp}$itemName), $suffix);";
+    WriteSource "}";
+
+    WriteSource "}" if not defined $staticArray;
+
+    WriteSource "}";
+}
+
 sub EmitSerializeArray
 {
     my ($refStructInfoEx, $refTypeInfo) = @_;
 
+    return EmitSerializeBinaryArray($refStructInfoEx, $refTypeInfo) if IsBinarySerialize($refStructInfoEx);
+
     my ($countMemberName, $countType, $staticArray) = GetCounterNameAndType($refStructInfoEx, $refTypeInfo);
 
+    my $emit = GetEmitMacro($refStructInfoEx, "EMIT");
+
     if (not defined $staticArray)
     {
         # if pointer is static array, then this check is not needed, since it
@@ -668,19 +877,19 @@ sub EmitSerializeArray
 
         WriteSource "if ($refTypeInfo->{memberName} == NULL || $countMemberName == 0)";
         WriteSource "{";
-        WriteSource "EMIT(\"null\");";
+        WriteSource "$emit(\"null\");";
         WriteSource "}";
         WriteSource "else";
     }
 
     WriteSource "{";
-    WriteSource "EMIT(\"[\");\n";
+    WriteSource "$emit(\"[\");\n";
     WriteSource "$countType idx;\n";
     WriteSource "for (idx = 0; idx < $countMemberName; idx++)";
     WriteSource "{";
     WriteSource "if (idx != 0)";
     WriteSource "{";
-    WriteSource "EMIT(\",\");";
+    WriteSource "$emit(\",\");";
     WriteSource "}\n";
 
     my $passParams = GetPassParamsForSerialize($refStructInfoEx, $refTypeInfo);
@@ -695,14 +904,18 @@ sub EmitSerializeArray
 
     my $suffix = $refTypeInfo->{suffix};
 
-    my $serializeCall = "sai_serialize_$suffix(buf, $passParams$refTypeInfo->{amp}$refTypeInfo->{memberName}\[idx\])";
+    my $fnName = GetSerializeFunctionName($refStructInfoEx, $suffix);
+
+    my $bufParams = GetSerializeBufferParams($refStructInfoEx);
 
-    my $emitMacro = GetEmitMacroName($refTypeInfo);
+    my $serializeCall = "$fnName($bufParams$passParams$refTypeInfo->{amp}$refTypeInfo->{memberName}\[idx\])";
+
+    my $emitMacro = GetEmitMacroName($refStructInfoEx, $refTypeInfo);
 
     WriteSource "$emitMacro($serializeCall, $suffix);";
 
     WriteSource "}\n";
-    WriteSource "EMIT(\"]\");";
+    WriteSource "$emit(\"]\");";
     WriteSource "}";
 }
 
@@ -774,7 +987,7 @@ sub ProcessMembersForSerialize
 
     EmitSerializeFunctionHeader($refStructInfoEx);
 
-    EmitSerializeHeader;
+    EmitSerializeHeader($refStructInfoEx);
 
     my %processedMembers = ();
 
@@ -826,6 +1039,16 @@ sub CreateSerializeStructs
         next if defined $structInfoEx{containsfnpointer};
 
         ProcessMembersForSerialize(\%structInfoEx);
+
+        $structInfoEx{bounded} = 1;
+
+        ProcessMembersForSerialize(\%structInfoEx);
+
+        delete $structInfoEx{bounded};
+
+        $structInfoEx{binary} = 1;
+
+        ProcessMembersForSerialize(\%structInfoEx);
     }
 }
 
@@ -838,6 +1061,16 @@ sub CreateSerializeUnions
         my %unionInfoEx = ExtractStructInfoEx($unionTypeName, "union_");
 
         ProcessMembersForSerialize(\%unionInfoEx);
+
+        $unionInfoEx{bounded} = 1;
+
+        ProcessMembersForSerialize(\%unionInfoEx);
+
+        delete $unionInfoEx{bounded};
+
+        $unionInfoEx{binary} = 1;
+
+        ProcessMembersForSerialize(\%unionInfoEx);
     }
 }
 
@@ -848,6 +1081,18 @@ sub CreateSerializeNotifications
     for my $ntfName (sort keys %main::NOTIFICATIONS)
     {
         ProcessMembersForSerialize($main::NOTIFICATIONS{$ntfName});
+
+        my %ntfInfoEx = %{ $main::NOTIFICATIONS{$ntfName} };
+
+        $ntfInfoEx{bounded} = 1;
+
+        ProcessMembersForSerialize(\%ntfInfoEx);
+
+        my %ntfBinaryInfoEx = %{ $main::NOTIFICATIONS{$ntfName} };
+
+        $ntfBinaryInfoEx{binary} = 1;
+
+        ProcessMembersForSerialize(\%ntfBinaryInfoEx);
     }
 }
 
@@ -855,7 +1100,7 @@ sub CreateSerializeEmitMacros
 {
     WriteSectionComment "Emit macros";
 
-    WriteSource "#define EMIT(x)        buf += sprintf(buf, x)";
+    WriteSource "#define EMIT(x)        { memcpy(buf, x, sizeof(x)); buf += sizeof(x) - 1; }";
     WriteSource "#define EMIT_QUOTE     EMIT(\"\\\"\")";
     WriteSource "#define EMIT_KEY(k)    EMIT(\"\\\"\" k \"\\\":\")";
     WriteSource "#define EMIT_NEXT_KEY(k) { EMIT(\",\"); EMIT_KEY(k); }";
@@ -867,6 +1112,40 @@ sub CreateSerializeEmitMacros
     WriteSource "    buf += ret; }";
     WriteSource "#define EMIT_QUOTE_CHECK(expr, suffix) {\\";
     WriteSource "    EMIT_QUOTE; EMIT_CHECK(expr, suffix); EMIT_QUOTE; }";
+
+    # length bounded versions, pos is total length of output, and if buffer
+    # is too small, then output is truncated and always terminated with '\0'
+
+    WriteSource "#define EMIT_N_BUF     ((pos < size) ? (buf + pos) : NULL)";
+    WriteSource "#define EMIT_N_SIZE    ((pos < size) ? (size - pos) : 0)";
+    WriteSource "#define EMIT_N(x) {                                                     \\";
+    WriteSource "    if (pos + sizeof(x) <= size) { memcpy(buf + pos, x, sizeof(x)); }   \\";
+    WriteSource "    else if (pos < size) {                                              \\";
+    WriteSource "        memcpy(buf + pos, x, size - pos - 1); buf[size - 1] = 0; }      \\";
+    WriteSource "    pos += sizeof(x) - 1; }";
+    WriteSource "#define EMIT_N_QUOTE     EMIT_N(\"\\\"\")";
+    WriteSource "#define EMIT_N_KEY(k)    EMIT_N(\"\\\"\" k \"\\\":\")";
+    WriteSource "#define EMIT_N_NEXT_KEY(k) { EMIT_N(\",\"); EMIT_N_KEY(k); }";
+    WriteSource "#define EMIT_N_CHECK(expr, suffix) {                               \\";
+    WriteSource "    ret = (expr);                                                  \\";
+    WriteSource "    if (ret < 0) {                                                 \\";
+    WriteSource "        SAI_META_LOG_WARN(\"failed to serialize \" #suffix \"\");      \\";
+    WriteSource "        return SAI_SERIALIZE_ERROR; }                              \\";
+    WriteSource "    pos += (size_t)ret; }";
+    WriteSource "#define EMIT_N_QUOTE_CHECK(expr, suffix) {\\";
+    WriteSource "    EMIT_N_QUOTE; EMIT_N_CHECK(expr, suffix); EMIT_N_QUOTE; }";
+
+    # binary versions, pos is total length of output, and value is written
+    # only when it fits in buffer
+
+    WriteSource "#define BIN_BUF        ((pos < size) ? (buf + pos) : NULL)";
+    WriteSource "#define BIN_SIZE       ((pos < size) ? (size - pos) : 0)";
+    WriteSource "#define BIN_CHECK(expr, suffix) {                                  \\";
+    WriteSource "    ret = (expr);                                                  \\";
+    WriteSource "    if (ret < 0) {                                                 \\";
+    WriteSource "        SAI_META_LOG_WARN(\"failed to serialize binary \" #suffix \"\"); \\";
+    WriteSource "        return SAI_SERIALIZE_ERROR; }                              \\";
+    WriteSource "    pos += (size_t)ret; }";
 }
 
 #
@@ -877,10 +1156,9 @@ sub CreateDeserializeEmitMacros
 {
     WriteSectionComment "Expect macros";
 
-    # TODO each expect should free memory current object recursivly on exit
-    # since we know that memory was allocated with zero (except that user one
-    # provided then we need to release memory, actually only in places where we
-    # have count and not const count
+    # expect macros return on failure without releasing memory, lists
+    # allocated so far are released by deserialize wrapper which calls free
+    # method, or they are owned by arena
 
     WriteSource "#define EXPECT(x) { \\";
     WriteSource "    if (strncmp(buf, x, sizeof(x) - 1) == 0) { buf += sizeof(x) - 1; } \\";
@@ -898,6 +1176,15 @@ sub CreateDeserializeEmitMacros
     WriteSource "    buf += ret; }";
     WriteSource "#define EXPECT_QUOTE_CHECK(expr, suffix) {\\";
     WriteSource "    EXPECT_QUOTE; EXPECT_CHECK(expr, suffix); EXPECT_QUOTE; }";
+
+    # binary versions, deserialize methods never consume more than size
+
+    WriteSource "#define BIN_EXPECT_CHECK(expr, suffix) {                           \\";
+    WriteSource "    ret = (expr);                                                  \\";
+    WriteSource "    if (ret < 0) {                                                 \\";
+    WriteSource "        SAI_META_LOG_WARN(\"failed to deserialize binary \" #suffix \"\"); \\";
+    WriteSource "        return SAI_SERIALIZE_ERROR; }                              \\";
+    WriteSource "    pos += (size_t)ret; }";
 }
 
 sub EmitDeserializeFunctionHeader
@@ -912,11 +1199,25 @@ sub EmitDeserializeFunctionHeader
 
     my @keys = @{ $structInfoEx{keys} };
 
-    WriteHeader "extern int sai_deserialize_$structBase(";
-    WriteHeader "_In_ const char *buf,";
+    my $fnName = GetDeserializeFunctionName($refStructInfoEx, $structBase);
 
-    WriteSource "int sai_deserialize_$structBase(";
-    WriteSource "_In_ const char *buf,";
+    WriteHeader "extern int ${fnName}_ex(";
+    WriteSource "int ${fnName}_ex(";
+
+    if (IsBinarySerialize($refStructInfoEx))
+    {
+        WriteHeader "_In_ const uint8_t *buf,";
+        WriteHeader "_In_ size_t size,";
+
+        WriteSource "_In_ const uint8_t *buf,";
+        WriteSource "_In_ size_t size,";
+    }
+    else
+    {
+        WriteHeader "_In_ const char *buf,";
+
+        WriteSource "_In_ const char *buf,";
+    }
 
     if (defined $structInfoEx{union} and not defined $structInfoEx{extraparam})
     {
@@ -939,15 +1240,10 @@ sub EmitDeserializeFunctionHeader
 
             LogDebug "$structName $structBase $name $type";
 
-            my $last = 1 if $keys[-1] eq $name;
-
-            my $end = (defined $last) ? ")" : ",";
-            my $endheader = (defined $last) ? ");" : ",";
-
             # TODO pointers
 
-            WriteSource "_Out_ $type $name$end";
-            WriteHeader "_Out_ $type $name$endheader";
+            WriteSource "_Out_ $type $name,";
+            WriteHeader "_Out_ $type $name,";
         }
     }
     else
@@ -963,14 +1259,98 @@ sub EmitDeserializeFunctionHeader
             }
         }
 
-        WriteHeader "_Out_ $structName *$structBase);\n";
-        WriteSource "_Out_ $structName *$structBase)";
+        WriteHeader "_Out_ $structName *$structBase,";
+        WriteSource "_Out_ $structName *$structBase,";
+    }
+
+    WriteHeader "_Inout_ sai_deserialize_arena_t *arena);\n";
+    WriteSource "_Inout_ sai_deserialize_arena_t *arena)";
+}
+
+sub EmitDeserializeWrapper
+{
+    #
+    # wrapper allocates lists using calloc and in case of failure releases
+    # lists which were allocated before failure, so caller don't need to care
+    # about partially deserialized object
+    #
+
+    my $refStructInfoEx = shift;
+
+    my $structName = $refStructInfoEx->{name};
+    my $structBase = $refStructInfoEx->{baseName};
+
+    my $fnName = GetDeserializeFunctionName($refStructInfoEx, $structBase);
+
+    my @params = ("_In_ const char *buf");
+
+    @params = ("_In_ const uint8_t *buf", "_In_ size_t size") if IsBinarySerialize($refStructInfoEx);
+
+    my $bufParams = (IsBinarySerialize($refStructInfoEx)) ? "buf, size, " : "buf, ";
+
+    my $passParams = "";
+
+    if (defined $refStructInfoEx->{extraparam})
+    {
+        for my $param (@{ $refStructInfoEx->{extraparam} })
+        {
+            push @params, "_In_ $param";
+
+            $passParams .= "$1, " if $param =~ /(\w+)$/;
+        }
+    }
+
+    WriteHeader "extern int $fnName(";
+    WriteSource "int $fnName(";
+
+    for my $param (@params)
+    {
+        WriteHeader "$param,";
+        WriteSource "$param,";
     }
+
+    WriteHeader "_Out_ $structName *$structBase);\n";
+    WriteSource "_Out_ $structName *$structBase)";
+
+    WriteSource "{";
+    WriteSource "int ret;\n";
+    WriteSource "memset($structBase, 0, sizeof($structName));\n";
+    WriteSource "ret = ${fnName}_ex($bufParams$passParams$structBase, NULL);\n";
+    WriteSource "if (ret < 0)";
+    WriteSource "{";
+    WriteSource "sai_deserialize_free_$structBase($passParams$structBase);";
+    WriteSource "}\n";
+    WriteSource "return ret;";
+    WriteSource "}";
+}
+
+sub EmitDeserializeAlloc
+{
+    my ($refTypeInfo, $countMemberName) = @_;
+
+    my $memberName = $refTypeInfo->{memberName};
+
+    WriteSource "$memberName = sai_deserialize_arena_alloc(arena, ($countMemberName), sizeof($refTypeInfo->{noptrtype}));\n";
+    WriteSource "if ($memberName == NULL)";
+    WriteSource "{";
+    WriteSource "SAI_META_LOG_ERROR(\"failed to allocate list\");";
+    WriteSource "return SAI_SERIALIZE_ERROR;";
+    WriteSource "}\n";
 }
 
 sub EmitDeserializeHeader
 {
+    my $refStructInfoEx = shift;
+
     WriteSource "{";
+
+    if (IsBinarySerialize($refStructInfoEx))
+    {
+        WriteSource "size_t pos = 0;";
+        WriteSource "int ret;\n";
+        return;
+    }
+
     WriteSource "const char *begin_buf = buf;";
     WriteSource "int ret;\n";
     WriteSource "EXPECT(\"{\");\n";
@@ -1022,6 +1402,8 @@ sub EmitDeserializeMemberKey
 
     my $name = $refTypeInfo->{name};
 
+    return if IsBinarySerialize($refStructInfoEx); # binary format has no keys
+
     my $expectKeyMacro = GetExpectKeyMacroName($refStructInfoEx, $name);
 
     WriteSource "$expectKeyMacro(\"$name\");\n";
@@ -1029,7 +1411,9 @@ sub EmitDeserializeMemberKey
 
 sub GetExpectMacroName
 {
-    my $refTypeInfo = shift;
+    my ($refStructInfoEx, $refTypeInfo) = @_;
+
+    return "BIN_EXPECT_CHECK" if IsBinarySerialize($refStructInfoEx);
 
     return "EXPECT_QUOTE_CHECK" if $refTypeInfo->{needQuote};
 
@@ -1073,13 +1457,22 @@ sub EmitDeserializePrimitive
 
     my $suffix = $refTypeInfo->{suffix};
 
-    my $emitMacro = GetExpectMacroName($refTypeInfo);
+    my $emitMacro = GetExpectMacroName($refStructInfoEx, $refTypeInfo);
 
     my $passParams = GetPassParamsForDeserialize($refStructInfoEx, $refTypeInfo);
 
     my $amp = $refTypeInfo->{deamp};
 
-    my $serializeCall = "sai_deserialize_$suffix(buf, $passParams$amp$refTypeInfo->{memberName})";
+    my $serializeCall = GetDeserializeCall($refStructInfoEx, $refTypeInfo, $suffix, "buf, $passParams$amp$refTypeInfo->{memberName}");
+
+    if (IsBinarySerialize($refStructInfoEx))
+    {
+        my ($binarySuffix, $memberName) = GetBinaryCall($refTypeInfo, "$amp$refTypeInfo->{memberName}", 1);
+
+        $suffix = $binarySuffix;
+
+        $serializeCall = GetDeserializeCall($refStructInfoEx, $refTypeInfo, $suffix, "buf + pos, size - pos, $passParams$memberName");
+    }
 
     WriteSource "$emitMacro($serializeCall, $suffix);";
 }
@@ -1105,6 +1498,13 @@ sub EmitDeserializeFooter
         WriteSource "}\n";
     }
 
+    if (IsBinarySerialize($refStructInfoEx))
+    {
+        WriteSource "return (int)pos;";
+        WriteSource "}";
+        return;
+    }
+
     WriteSource "EXPECT(\"}\");\n";
 
     WriteSource "return (int)(buf - begin_buf);";
@@ -1116,6 +1516,8 @@ sub EmitDeserializeArray
 {
     my ($refStructInfoEx, $refTypeInfo) = @_;
 
+    return EmitDeserializeBinaryArray($refStructInfoEx, $refTypeInfo) if IsBinarySerialize($refStructInfoEx);
+
     my ($countMemberName, $countType) = GetCounterNameAndType($refStructInfoEx, $refTypeInfo);
 
     if (not $countMemberName =~ /^$NUMBER_REGEX$/)
@@ -1138,7 +1540,7 @@ sub EmitDeserializeArray
 
     if (not $countMemberName =~ /^$NUMBER_REGEX$/)
     {
-        WriteSource "$refTypeInfo->{memberName} = calloc(($countMemberName), sizeof($refTypeInfo->{noptrtype}));\n";
+        EmitDeserializeAlloc($refTypeInfo, $countMemberName);
     }
 
     WriteSource "EXPECT(\"[\");\n";
@@ -1167,9 +1569,9 @@ sub EmitDeserializeArray
 
     my $suffix = $refTypeInfo->{suffix};
 
-    my $serializeCall = "sai_deserialize_$suffix(buf, $passParams$amp$refTypeInfo->{memberName}\[idx\])";
+    my $serializeCall = GetDeserializeCall($refStructInfoEx, $refTypeInfo, $suffix, "buf, $passParams$amp$refTypeInfo->{memberName}\[idx\]");
 
-    my $emitMacro = GetExpectMacroName($refTypeInfo);
+    my $emitMacro = GetExpectMacroName($refStructInfoEx, $refTypeInfo);
 
     WriteSource "$emitMacro($serializeCall, $suffix);";
 
@@ -1178,8 +1580,62 @@ sub EmitDeserializeArray
     WriteSource "}";
 }
 
-# TODO in case of failure we need to recursivly free memory that we allocated
-# to prevent memory leak
+sub EmitDeserializeBinaryArray
+{
+    my ($refStructInfoEx, $refTypeInfo) = @_;
+
+    my ($countMemberName, $countType) = GetCounterNameAndType($refStructInfoEx, $refTypeInfo);
+
+    my $memberName = $refTypeInfo->{memberName};
+
+    my $staticArray = ($countMemberName =~ /^$NUMBER_REGEX$/);
+
+    WriteSource "{";
+
+    if (not $staticArray)
+    {
+        WriteSource "bool present;\n";
+        WriteSource "BIN_EXPECT_CHECK(sai_deserialize_binary_bool(buf + pos, size - pos, &present), bool);\n";
+        WriteSource "if (!present)";
+        WriteSource "{";
+        WriteSource "$memberName = NULL;";
+        WriteSource "}";
+        WriteSource "else";
+        WriteSource "{";
+
+        # each list item takes at least one byte, so count can be validated
+        # before allocating memory
+
+        WriteSource "if ((size_t)($countMemberName) > size - pos)";
+        WriteSource "{";
+        WriteSource "SAI_META_LOG_WARN(\"list count %u exceeds binary buffer size\", (uint32_t)($countMemberName));";
+        WriteSource "return SAI_SERIALIZE_ERROR;";
+        WriteSource "}\n";
+        EmitDeserializeAlloc($refTypeInfo, $countMemberName);
+    }
+
+    WriteSource "$countType idx;\n";
+    WriteSource "for (idx = 0; idx < $countMemberName; idx++)";
+    WriteSource "{";
+
+    my $passParams = GetPassParamsForSerialize($refStructInfoEx, $refTypeInfo);
+
+    # attribute id is serialized as number, so object type is needed to find
+    # attribute metadata
+
+    $passParams = "$refTypeInfo->{objectType}, $passParams" if $refTypeInfo->{isattribute};
+
+    my ($suffix, $itemName) = GetBinaryCall($refTypeInfo, "$refTypeInfo->{deamp}$memberName\[idx\]", 1);
+
+    my $serializeCall = GetDeserializeCall($refStructInfoEx, $refTypeInfo, $suffix, "buf + pos, size - pos, $passParams$itemName");
+
+    WriteSource "BIN_EXPECT_CHECK($serializeCall, $suffix);";
+    WriteSource "}";
+
+    WriteSource "}" if not $staticArray;
+
+    WriteSource "}";
+}
 
 sub ProcessMembersForDeserialize
 {
@@ -1204,7 +1660,7 @@ sub ProcessMembersForDeserialize
 
     EmitDeserializeFunctionHeader($refStructInfoEx);
 
-    EmitDeserializeHeader();
+    EmitDeserializeHeader($refStructInfoEx);
 
     my %processedMembers = ();
 
@@ -1237,6 +1693,8 @@ sub ProcessMembersForDeserialize
     }
 
     EmitDeserializeFooter($refStructInfoEx);
+
+    EmitDeserializeWrapper($refStructInfoEx);
 }
 
 sub CreateDeserializeStructs
@@ -1256,6 +1714,10 @@ sub CreateDeserializeStructs
         next if defined $structInfoEx{containsfnpointer};
 
         ProcessMembersForDeserialize(\%structInfoEx);
+
+        $structInfoEx{binary} = 1;
+
+        ProcessMembersForDeserialize(\%structInfoEx);
     }
 }
 
@@ -1297,6 +1759,182 @@ sub CreateDeserializeUnions
         my %unionInfoEx = ExtractStructInfoEx($unionTypeName, "union_");
 
         ProcessMembersForDeserialize(\%unionInfoEx);
+
+        $unionInfoEx{binary} = 1;
+
+        ProcessMembersForDeserialize(\%unionInfoEx);
+    }
+}
+
+#
+# FREE - release memory allocated by deserialize methods
+#
+
+sub EmitFreeFunctionHeader
+{
+    my $refStructInfoEx = shift;
+
+    my $structName = $refStructInfoEx->{name};
+    my $structBase = $refStructInfoEx->{baseName};
+
+    WriteHeader "extern void sai_deserialize_free_$structBase(";
+    WriteSource "void sai_deserialize_free_$structBase(";
+
+    if (defined $refStructInfoEx->{extraparam})
+    {
+        for my $param (@{ $refStructInfoEx->{extraparam} })
+        {
+            WriteHeader "_In_ $param,";
+            WriteSource "_In_ $param,";
+        }
+    }
+
+    WriteHeader "_Inout_ $structName *$structBase);\n";
+    WriteSource "_Inout_ $structName *$structBase)";
+}
+
+sub EmitFreeItem
+{
+    my ($refStructInfoEx, $refTypeInfo, $itemName) = @_;
+
+    my $passParams = GetPassParamsForSerialize($refStructInfoEx, $refTypeInfo);
+
+    if ($refTypeInfo->{isattribute})
+    {
+        WriteSource "const sai_attr_metadata_t *meta =";
+        WriteSource "    sai_metadata_get_attr_metadata($refTypeInfo->{objectType}, $itemName.id);\n";
+
+        $passParams = "meta, $passParams";
+    }
+
+    WriteSource "sai_deserialize_free_$refTypeInfo->{suffix}($passParams&$itemName);";
+}
+
+sub EmitFreeArray
+{
+    my ($refStructInfoEx, $refTypeInfo) = @_;
+
+    my ($countMemberName, $countType) = GetCounterNameAndType($refStructInfoEx, $refTypeInfo);
+
+    my $memberName = $refTypeInfo->{memberName};
+
+    my $staticArray = ($countMemberName =~ /^$NUMBER_REGEX$/);
+
+    return if $staticArray and not defined $refTypeInfo->{needfree};
+
+    WriteSource "if ($memberName != NULL)" if not $staticArray;
+    WriteSource "{";
+
+    if (defined $refTypeInfo->{needfree})
+    {
+        WriteSource "$countType idx;\n";
+        WriteSource "for (idx = 0; idx < $countMemberName; idx++)";
+        WriteSource "{";
+
+        EmitFreeItem($refStructInfoEx, $refTypeInfo, "$memberName\[idx\]");
+
+        WriteSource "}\n";
+    }
+
+    if (not $staticArray)
+    {
+        WriteSource "free($memberName);\n";
+        WriteSource "$memberName = NULL;";
+    }
+
+    WriteSource "}";
+}
+
+sub ProcessMembersForFree
+{
+    my $refStructInfoEx = shift;
+
+    my $structName = $refStructInfoEx->{name};
+
+    return if defined $refStructInfoEx->{ismetadatastruct} and $structName ne "sai_object_meta_key_t";
+
+    LogDebug "Creating free for $structName";
+
+    EmitFreeFunctionHeader($refStructInfoEx);
+
+    WriteSource "{";
+
+    my %processedMembers = ();
+
+    $refStructInfoEx->{processed} = \%processedMembers;
+
+    my $else = "";
+
+    for my $name (@{ $refStructInfoEx->{keys} })
+    {
+        my $refTypeInfo = GetTypeInfoForSerialize($refStructInfoEx, $name);
+
+        next if not defined $refTypeInfo;
+
+        next if not IsTypeInfoValid($refStructInfoEx, $refTypeInfo);
+
+        $refStructInfoEx->{processed}{$name} = 1;
+
+        # only lists and structs can hold memory allocated by deserialize
+
+        next if not $refTypeInfo->{ispointer} and not defined $refTypeInfo->{needfree};
+
+        my $validonly = defined $refStructInfoEx->{membersHash}{$name}->{validonly};
+
+        if ($validonly)
+        {
+            my $condition = GetConditionForSerialize($refStructInfoEx, $refTypeInfo);
+
+            WriteSource "${else}if ($condition)";
+            WriteSource "{";
+
+            $else = "else " if defined $refStructInfoEx->{union};
+        }
+
+        if ($refTypeInfo->{ispointer})
+        {
+            EmitFreeArray($refStructInfoEx, $refTypeInfo);
+        }
+        else
+        {
+            EmitFreeItem($refStructInfoEx, $refTypeInfo, $refTypeInfo->{memberName});
+        }
+
+        WriteSource(($validonly) ? "}" : "");
+    }
+
+    WriteSource "}";
+}
+
+sub CreateFreeStructs
+{
+    WriteSectionComment "Free structs";
+
+    for my $struct (sort keys %main::ALL_STRUCTS)
+    {
+        # user defined deserialization
+
+        next if $struct eq "sai_ip_address_t";
+        next if $struct eq "sai_ip_prefix_t";
+        next if $struct eq "sai_attribute_t";
+
+        my %structInfoEx = ExtractStructInfoEx($struct, "struct_");
+
+        next if defined $structInfoEx{containsfnpointer};
+
+        ProcessMembersForFree(\%structInfoEx);
+    }
+}
+
+sub CreateFreeUnions
+{
+    WriteSectionComment "Free unions";
+
+    for my $unionTypeName (sort keys %main::SAI_UNIONS)
+    {
+        my %unionInfoEx = ExtractStructInfoEx($unionTypeName, "union_");
+
+        ProcessMembersForFree(\%unionInfoEx);
     }
 }
 
@@ -1320,6 +1958,10 @@ sub CreateSerializeMethods
 
     CreateDeserializeUnions();
 
+    CreateFreeStructs();
+
+    CreateFreeUnions();
+
     # TODO deserialize notifications
 }
 
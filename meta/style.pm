@@ -688,6 +688,7 @@ sub CheckMetadataSourceFiles
         next if $file eq "saimetadata.h";
         next if $file eq "saimetadata.c";
         next if $file eq "saimetadatatest.c";
+        next if $file eq "saitrace.c";
         next if $file eq "saimetadatasize.h";
         next if $file eq "saiattrversion.h";
         next if $file eq "sai_rpc_server.cpp";
@@ -846,6 +847,7 @@ sub GetWordsFromSources
     {
         next if $src =~ /saimetadata.c/;
         next if $src =~ /saimetadatatest.c/;
+        next if $src =~ /saitrace.c/;
         next if $src =~ /saiswig/;
         next if $src =~ /sai_rpc_server.cpp/;
 
@@ -41,6 +41,8 @@ our $HEADER_CONTENT = "";
 our $SOURCE_CONTENT = "";
 our $TEST_CONTENT = "";
 our $SWIG_CONTENT = "";
+our $CPP_HEADER_CONTENT = "";
+our $TRACE_CONTENT = "";
 
 my $identLevel = 0;
 
@@ -68,6 +70,19 @@ sub WriteHeader
     $HEADER_CONTENT .= $line;
 }
 
+sub WriteCppHeader
+{
+    my $content = shift;
+
+    my $ident = GetIdent($content);
+
+    my $line = $ident . $content . "\n";
+
+    $line = "\n" if $content eq "";
+
+    $CPP_HEADER_CONTENT .= $line;
+}
+
 sub WriteSource
 {
     my $content = shift;
@@ -81,6 +96,19 @@ sub WriteSource
     $SOURCE_CONTENT .= $line;
 }
 
+sub WriteTrace
+{
+    my $content = shift;
+
+    my $ident = GetIdent($content);
+
+    my $line = $ident . $content . "\n";
+
+    $line = "\n" if $content eq "";
+
+    $TRACE_CONTENT .= $line;
+}
+
 sub WriteTest
 {
     my $content = shift;
@@ -388,6 +416,8 @@ sub WriteMetaDataFiles
     WriteFile("saimetadata.c", $SOURCE_CONTENT);
     WriteFile("saimetadatatest.c", $TEST_CONTENT);
     WriteFile("saiswig.i", $SWIG_CONTENT);
+    WriteFile("saimetadata.hpp", $CPP_HEADER_CONTENT);
+    WriteFile("saitrace.c", $TRACE_CONTENT);
 }
 
 sub GetStructKeysInOrder
@@ -631,7 +661,7 @@ BEGIN
     WriteFile GetHeaderFiles GetMetaHeaderFiles GetExperimentalHeaderFiles GetCustomHeaderFiles GetMetadataSourceFiles ReadHeaderFile GetMetaSourceFiles
     GetNonObjectIdStructNames GetNonObjectIdStructNamesWithBulkApi IsSpecialObject GetStructLists GetStructKeysInOrder
     Trim ExitOnErrors ExitOnErrorsOrWarnings ProcessEnumInitializers
-    WriteHeader WriteSource WriteTest WriteSwig WriteMetaDataFiles WriteSectionComment WriteSourceSectionComment
+    WriteHeader WriteCppHeader WriteSource WriteTest WriteSwig WriteTrace WriteMetaDataFiles WriteSectionComment WriteSourceSectionComment
     $errors $warnings $NUMBER_REGEX
     $HEADER_CONTENT $SOURCE_CONTENT $TEST_CONTENT
     /;